@@ -6,6 +6,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstdint>
 
 #include "astro_core/base/algorithm.h"
 #include "astro_core/base/ctype.h"
@@ -81,5 +83,18 @@ LevenshteinDistance CalculateCaseInsensitiveLevenshteinDistance(
   return v0[target_length];
 }
 
+CaseInsensitiveLevenshteinCost::CaseInsensitiveLevenshteinCost(
+    const std::string_view pattern)
+    : pattern_length_(pattern.size()) {
+  assert(pattern.size() <= kMaxPatternLength);
+
+  for (size_t i = 0; i < pattern_length_; ++i) {
+    match_masks_[uint8_t(ToLowerASCII(pattern[i]))] |= uint64_t(1) << i;
+  }
+  for (int ch = 'A'; ch <= 'Z'; ++ch) {
+    match_masks_[ch] = match_masks_[ToLowerASCII(ch)];
+  }
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
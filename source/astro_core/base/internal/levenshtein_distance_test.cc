@@ -4,6 +4,10 @@
 
 #include "astro_core/base/levenshtein_distance.h"
 
+#include <random>
+#include <string>
+
+#include "astro_core/base/algorithm.h"
 #include "astro_core/unittest/test.h"
 
 namespace astro_core {
@@ -30,4 +34,49 @@ TEST(base, CalculateCaseInsensitiveLevenshteinDistance) {
             LevenshteinDistance::Insertion(1));
 }
 
+TEST(base, CaseInsensitiveLevenshteinCost) {
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("")(""), 0);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("")("World!"), 6);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("Hello")(""), 5);
+
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("foo")("FOO"), 0);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("foo")("bar"), 3);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("Hello")("World"), 4);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("distance")("distnce"), 1);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost("distnce")("distance"), 1);
+
+  // Pattern of the maximum length.
+  const std::string pattern(CaseInsensitiveLevenshteinCost::kMaxPatternLength,
+                            'a');
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost(pattern)(pattern), 0);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost(pattern)("A"), 63);
+  EXPECT_EQ(CaseInsensitiveLevenshteinCost(pattern)(pattern + "bb"), 2);
+}
+
+// Compare the cost with the one calculated by the dynamic programming.
+TEST(base, CaseInsensitiveLevenshteinCostRandom) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> length_distribution(0, 70);
+  std::uniform_int_distribution<int> char_distribution(0, 5);
+
+  auto random_string = [&](const size_t max_length) {
+    std::string str(Min(size_t(length_distribution(rng)), max_length), ' ');
+    for (char& ch : str) {
+      ch = "aAbB1-"[char_distribution(rng)];
+    }
+    return str;
+  };
+
+  for (int i = 0; i < 2000; ++i) {
+    const std::string pattern =
+        random_string(CaseInsensitiveLevenshteinCost::kMaxPatternLength);
+    const std::string str = random_string(256);
+
+    EXPECT_EQ(
+        CaseInsensitiveLevenshteinCost(pattern)(str),
+        CalculateCaseInsensitiveLevenshteinDistance(str, pattern).GetCost())
+        << "pattern: " << pattern << ", str: " << str;
+  }
+}
+
 }  // namespace astro_core
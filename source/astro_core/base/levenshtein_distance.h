@@ -7,9 +7,14 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string_view>
 
+#include "astro_core/base/ctype.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
@@ -89,5 +94,84 @@ auto CalculateCaseInsensitiveLevenshteinDistance(std::string_view source,
                                                  std::string_view target)
     -> LevenshteinDistance;
 
+// Calculator of the case-insensitive Levenshtein cost between a pattern and
+// many strings.
+//
+// Only the final cost of the distance is calculated, which allows to use the
+// bit-parallel algorithm of Myers in the formulation of Hyyrö: the column of
+// the distance matrix is stored as bit vectors of vertical deltas, and the
+// calculation takes a constant number of operations per character of the
+// string. This is much faster than the dynamic programming of the
+// CalculateCaseInsensitiveLevenshteinDistance() when the same pattern is
+// compared against many strings.
+//
+// The pattern is limited to kMaxPatternLength characters. The length of the
+// string is not limited.
+//
+// References:
+//
+//   G. Myers. A fast bit-vector algorithm for approximate string matching based
+//   on dynamic programming. Journal of the ACM, 46(3):395-415, 1999.
+//
+//   H. Hyyrö. Explaining and extending the bit-parallel approximate string
+//   matching algorithm of Myers. Technical report A-2001-10, University of
+//   Tampere, 2001.
+class CaseInsensitiveLevenshteinCost {
+ public:
+  static constexpr size_t kMaxPatternLength = 64;
+
+  // The pattern is to be not longer than the kMaxPatternLength.
+  // The pattern is not stored, it is allowed to be destroyed after the
+  // construction.
+  explicit CaseInsensitiveLevenshteinCost(std::string_view pattern);
+
+  // Calculate the cost of the Levenshtein distance between the pattern and the
+  // given string.
+  inline auto operator()(const std::string_view str) const -> int {
+    if (pattern_length_ == 0) {
+      return int(str.size());
+    }
+
+    const uint64_t last_bit = uint64_t(1) << (pattern_length_ - 1);
+
+    // Vertical positive and negative deltas of the current column.
+    uint64_t vp = ~uint64_t(0);
+    uint64_t vn = 0;
+
+    int cost = int(pattern_length_);
+
+    for (const char ch : str) {
+      const uint64_t eq = match_masks_[uint8_t(ch)];
+      const uint64_t xv = eq | vn;
+      const uint64_t xh = (((eq & vp) + vp) ^ vp) | eq;
+
+      // Horizontal positive and negative deltas.
+      uint64_t hp = vn | ~(xh | vp);
+      uint64_t hn = vp & xh;
+
+      // At most one of the deltas is set, and which one is hard to predict.
+      cost += int((hp & last_bit) != 0) - int((hn & last_bit) != 0);
+
+      // The first row of the matrix is the distance from an empty pattern,
+      // which increases by one with every character of the string.
+      hp = (hp << 1) | 1;
+      hn <<= 1;
+
+      vp = hn | ~(xv | hp);
+      vn = hp & xv;
+    }
+
+    return cost;
+  }
+
+ private:
+  // Bit i of the mask of a character is set if the character matches the
+  // i-th character of the pattern. The masks of the upper and lower case of a
+  // letter are the same.
+  std::array<uint64_t, 256> match_masks_{};
+
+  size_t pattern_length_{0};
+};
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -0,0 +1,209 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Micro-benchmarking framework.
+//
+// A benchmark is a function which performs the measured operation in a loop
+// over the benchmark state:
+//
+//   BENCHMARK(OrbitalState, Predict) {
+//     const OrbitalState orbital_state = ...;
+//
+//     for (auto _ : state) {
+//       DoNotOptimize(orbital_state.Predict(time));
+//     }
+//   }
+//
+// The code outside of the loop is not timed, and is used to prepare data for
+// the measured operation. The runner invokes the benchmark with an increasing
+// number of iterations until the loop runs for long enough to give a stable
+// measurement.
+//
+// All benchmarks are compiled into the astro_core_benchmark executable. It
+// reports the time per iteration of every benchmark to the console, and can
+// write them as JSON for comparing runs. The JSON follows the schema of the
+// Google Benchmark, so the tools made for it can be used to compare the runs:
+//
+//   $ astro_core_benchmark --benchmark_out=before.json
+//   $ astro_core_benchmark --benchmark_out=after.json
+//   $ compare.py benchmarks before.json after.json
+//
+// See `astro_core_benchmark --help` for the full list of options.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark {
+
+class State;
+
+namespace internal {
+
+using BenchmarkFunction = void (*)(State& state);
+
+// Register benchmark function to be run by the astro_core_benchmark.
+// Always returns true, which allows to register benchmarks from static
+// initializers.
+auto RegisterBenchmark(const char* suite_name,
+                       const char* name,
+                       BenchmarkFunction function) -> bool;
+
+// Use the value in the way that the compiler can not optimize out.
+void UseCharPointer(const volatile char* pointer);
+
+class Timer;
+class BenchmarkRunner;
+
+}  // namespace internal
+
+// State of the benchmark run.
+//
+// Provides iteration over the measured loop, and allows the benchmark to
+// report additional information about the run.
+class State {
+ public:
+  class Iterator {
+   public:
+    // The value of the iteration is not used by the benchmarks.
+    //
+    // The user-provided destructor avoids the warning about the loop variable
+    // being set but not used.
+    struct Value {
+      ~Value() {}  // NOLINT(modernize-use-equals-default)
+    };
+
+    auto operator*() const -> Value { return {}; }
+
+    auto operator++() -> Iterator& {
+      --num_remaining_iterations_;
+      return *this;
+    }
+
+    // Comparison with the end iterator. Stops the timer once all iterations
+    // have been performed.
+    auto operator!=(const Iterator& /*end*/) -> bool {
+      if (num_remaining_iterations_ != 0) [[likely]] {
+        return true;
+      }
+      state_->FinishIterations();
+      return false;
+    }
+
+   private:
+    friend class State;
+
+    Iterator() = default;
+    explicit Iterator(State* state)
+        : state_(state), num_remaining_iterations_(state->num_iterations_) {}
+
+    State* state_{nullptr};
+    int64_t num_remaining_iterations_{0};
+  };
+
+  // Iterate over the measured loop.
+  // The timer is started when the loop starts, and stops when it finishes.
+  auto begin() -> Iterator {
+    StartIterations();
+    return Iterator(this);
+  }
+  auto end() -> Iterator { return Iterator(); }
+
+  // The number of iterations the measured loop performs in this run.
+  auto GetNumIterations() const -> int64_t { return num_iterations_; }
+
+  // Exclude the code between the pause and resume from the measured time.
+  //
+  // Pausing and resuming the timer has an overhead which is comparable with
+  // the measurement of very fast operations, so it is only to be used to
+  // exclude expensive preparation of the measured data.
+  void PauseTiming();
+  void ResumeTiming();
+
+  // Set the number of items processed by the measured loop in all iterations.
+  // Reported as the number of items processed per second.
+  void SetNumItemsProcessed(const int64_t num_items) {
+    num_items_processed_ = num_items;
+  }
+
+  // Report the benchmark as failed, with the given message.
+  //
+  // The measured loop is to be skipped after this call: either the function
+  // returns before the loop starts, or it breaks out of the loop.
+  void SkipWithError(std::string_view message);
+
+ private:
+  friend class internal::BenchmarkRunner;
+
+  State(int64_t num_iterations, internal::Timer& timer);
+
+  void StartIterations();
+  void FinishIterations();
+
+  int64_t num_iterations_;
+  int64_t num_items_processed_{0};
+
+  bool is_loop_started_{false};
+
+  bool has_error_{false};
+  std::string error_message_;
+
+  internal::Timer* timer_;
+};
+
+// Make the compiler believe that the value is used, so that its computation is
+// not optimized out.
+template <class T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  internal::UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+#endif
+}
+
+// Make the compiler believe that all memory has been modified, so that
+// pending writes are performed.
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#else
+  std::atomic_signal_fence(std::memory_order_acq_rel);
+#endif
+}
+
+// Construct a fully qualified path for the benchmark data file.
+//
+// The benchmarks use the same data as the regression tests, and the path is
+// relative to the data/test folder.
+auto BenchmarkFileAbsolutePath(const std::filesystem::path& filename)
+    -> std::filesystem::path;
+
+}  // namespace benchmark
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
+
+// Define and register a benchmark.
+//
+// The body of the benchmark follows the macro, and has access to the benchmark
+// state via the `state` variable.
+#define BENCHMARK(suite_name, name)                                            \
+  static void AstroCoreBenchmark_##suite_name##_##name(                        \
+      ::astro_core::benchmark::State& state);                                  \
+  [[maybe_unused]] static const bool                                           \
+      astro_core_benchmark_registered_##suite_name##_##name =                  \
+          ::astro_core::benchmark::internal::RegisterBenchmark(                \
+              #suite_name, #name, AstroCoreBenchmark_##suite_name##_##name);   \
+  static void AstroCoreBenchmark_##suite_name##_##name(                        \
+      [[maybe_unused]] ::astro_core::benchmark::State& state)
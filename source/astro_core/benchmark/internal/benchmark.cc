@@ -0,0 +1,60 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/benchmark/benchmark.h"
+
+#include "astro_core/benchmark/internal/runner.h"
+#include "astro_core/benchmark/internal/timer.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark {
+
+namespace internal {
+namespace {
+
+auto GetBenchmarkSrcDir() -> std::filesystem::path& {
+  static std::filesystem::path srcdir;
+  return srcdir;
+}
+
+}  // namespace
+
+void SetBenchmarkSrcDir(const std::string& srcdir) {
+  GetBenchmarkSrcDir() = srcdir;
+}
+
+void UseCharPointer(const volatile char* /*pointer*/) {}
+
+}  // namespace internal
+
+State::State(const int64_t num_iterations, internal::Timer& timer)
+    : num_iterations_(num_iterations), timer_(&timer) {}
+
+void State::PauseTiming() { timer_->Stop(); }
+
+void State::ResumeTiming() { timer_->Start(); }
+
+void State::SkipWithError(const std::string_view message) {
+  has_error_ = true;
+  error_message_ = message;
+}
+
+void State::StartIterations() {
+  is_loop_started_ = true;
+  timer_->Start();
+}
+
+void State::FinishIterations() { timer_->Stop(); }
+
+auto BenchmarkFileAbsolutePath(const std::filesystem::path& filename)
+    -> std::filesystem::path {
+  return internal::GetBenchmarkSrcDir() / filename;
+}
+
+}  // namespace benchmark
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,100 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/benchmark/internal/runner.h"
+
+DEFINE_string(benchmark_filter,
+              "",
+              "Regular expression which names of the benchmarks to run are to "
+              "match. All benchmarks are run when empty.");
+DEFINE_double(benchmark_min_time,
+              0.5,
+              "Minimum time in seconds to run the measured loop of a benchmark "
+              "for.");
+DEFINE_int32(benchmark_repetitions,
+             1,
+             "The number of times to run each benchmark. Mean, median, and "
+             "standard deviation are reported for multiple repetitions.");
+DEFINE_string(benchmark_format,
+              "console",
+              "Format of the results printed to the standard output: console "
+              "or json.");
+DEFINE_string(benchmark_out,
+              "",
+              "File to write the results to in the JSON format, in addition "
+              "to the standard output.");
+DEFINE_bool(benchmark_list_tests,
+            false,
+            "Print names of the benchmarks which match the filter, without "
+            "running them.");
+DEFINE_string(benchmark_srcdir,
+              ASTRO_CORE_BENCHMARK_SRCDIR,
+              "The location of data for the benchmarks.");
+
+namespace {
+
+namespace internal = astro_core::benchmark::internal;
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  gflags::SetUsageMessage("Run performance benchmarks of the Astro Core.");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  if (FLAGS_benchmark_list_tests) {
+    for (const std::string& name :
+         internal::ListBenchmarks(FLAGS_benchmark_filter)) {
+      std::cout << name << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  internal::SetBenchmarkSrcDir(FLAGS_benchmark_srcdir);
+
+  std::vector<internal::Reporter*> reporters;
+
+  internal::ConsoleReporter console_reporter(std::cout);
+  internal::JSONReporter json_stdout_reporter(std::cout);
+  if (FLAGS_benchmark_format == "console") {
+    reporters.push_back(&console_reporter);
+  } else if (FLAGS_benchmark_format == "json") {
+    reporters.push_back(&json_stdout_reporter);
+  } else {
+    std::cerr << "Unknown benchmark format " << FLAGS_benchmark_format
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ofstream out_stream;
+  std::unique_ptr<internal::JSONReporter> json_file_reporter;
+  if (!FLAGS_benchmark_out.empty()) {
+    out_stream.open(FLAGS_benchmark_out);
+    if (!out_stream) {
+      std::cerr << "Error opening " << FLAGS_benchmark_out << std::endl;
+      return EXIT_FAILURE;
+    }
+    json_file_reporter = std::make_unique<internal::JSONReporter>(out_stream);
+    reporters.push_back(json_file_reporter.get());
+  }
+
+  const internal::RunOptions options = {
+      .filter = FLAGS_benchmark_filter,
+      .min_time = FLAGS_benchmark_min_time,
+      .num_repetitions = FLAGS_benchmark_repetitions,
+  };
+
+  const bool ok = internal::RunBenchmarks(
+      options, internal::GetContext(argv[0]), reporters);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/benchmark/benchmark.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "astro_core/benchmark/internal/runner.h"
+#include "astro_core/unittest/mock.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark {
+namespace {
+
+using testing::ElementsAre;
+using testing::HasSubstr;
+using testing::Not;
+
+// Number of iterations of the measured loop in every invocation of the Loop
+// benchmark.
+std::vector<int64_t> loop_num_iterations;
+
+BENCHMARK(BenchmarkTest, Loop) {
+  int64_t num_iterations = 0;
+  for (auto _ : state) {
+    ++num_iterations;
+    DoNotOptimize(num_iterations);
+  }
+  loop_num_iterations.push_back(num_iterations);
+  state.SetNumItemsProcessed(state.GetNumIterations() * 2);
+}
+
+BENCHMARK(BenchmarkTest, Error) { state.SkipWithError("Expected \"error\""); }
+
+BENCHMARK(BenchmarkTest, NoLoop) {}
+
+auto RunToString(const internal::RunOptions& options, const bool json)
+    -> std::pair<bool, std::string> {
+  std::stringstream stream;
+
+  internal::ConsoleReporter console_reporter(stream);
+  internal::JSONReporter json_reporter(stream);
+
+  internal::Reporter* reporter =
+      json ? static_cast<internal::Reporter*>(&json_reporter)
+           : static_cast<internal::Reporter*>(&console_reporter);
+
+  const bool ok = internal::RunBenchmarks(
+      options, internal::GetContext("benchmark_test"), {&reporter, 1});
+
+  return {ok, stream.str()};
+}
+
+}  // namespace
+
+TEST(Benchmark, ListBenchmarks) {
+  EXPECT_THAT(internal::ListBenchmarks("BenchmarkTest/"),
+              ElementsAre("BenchmarkTest/Error",
+                          "BenchmarkTest/Loop",
+                          "BenchmarkTest/NoLoop"));
+
+  EXPECT_THAT(internal::ListBenchmarks("/Loop$"),
+              ElementsAre("BenchmarkTest/Loop"));
+}
+
+TEST(Benchmark, Run) {
+  loop_num_iterations.clear();
+
+  const auto [ok, output] = RunToString(
+      {.filter = "BenchmarkTest/Loop", .min_time = 0.001}, /*json=*/false);
+
+  EXPECT_TRUE(ok);
+  EXPECT_THAT(output, HasSubstr("BenchmarkTest/Loop"));
+  EXPECT_THAT(output, HasSubstr("items_per_second="));
+
+  // The runner starts with a single iteration, and grows the number of
+  // iterations until the loop runs for the minimum time. On a loaded machine
+  // the first run could already take the minimum time, so the growth is only
+  // checked when the runner invoked the benchmark more than once.
+  ASSERT_FALSE(loop_num_iterations.empty());
+  EXPECT_EQ(loop_num_iterations.front(), 1);
+  for (size_t i = 1; i < loop_num_iterations.size(); ++i) {
+    EXPECT_GT(loop_num_iterations[i], loop_num_iterations[i - 1]);
+  }
+
+  // The reported number of iterations is the one of the last invocation.
+  std::string num_iterations_str = std::to_string(loop_num_iterations.back());
+  num_iterations_str += " items_per_second=";
+  EXPECT_THAT(output, HasSubstr(num_iterations_str));
+}
+
+TEST(Benchmark, RunOnce) {
+  loop_num_iterations.clear();
+
+  const auto [ok, output] = RunToString(
+      {.filter = "BenchmarkTest/Loop", .min_time = 0}, /*json=*/false);
+
+  EXPECT_TRUE(ok);
+  EXPECT_THAT(loop_num_iterations, ElementsAre(1));
+}
+
+TEST(Benchmark, Error) {
+  {
+    const auto [ok, output] = RunToString(
+        {.filter = "BenchmarkTest/Error", .min_time = 0}, /*json=*/false);
+    EXPECT_FALSE(ok);
+    EXPECT_THAT(output, HasSubstr("ERROR: Expected \"error\""));
+  }
+
+  {
+    const auto [ok, output] = RunToString(
+        {.filter = "BenchmarkTest/NoLoop", .min_time = 0}, /*json=*/false);
+    EXPECT_FALSE(ok);
+    EXPECT_THAT(output, HasSubstr("ERROR: "));
+  }
+}
+
+TEST(Benchmark, JSON) {
+  const auto [ok, output] =
+      RunToString({.filter = "BenchmarkTest/(Loop|Error)",
+                   .min_time = 0,
+                   .num_repetitions = 3},
+                  /*json=*/true);
+
+  EXPECT_FALSE(ok);
+
+  EXPECT_THAT(output, HasSubstr("\"context\": {"));
+  EXPECT_THAT(output, HasSubstr("\"executable\": \"benchmark_test\""));
+  EXPECT_THAT(output, HasSubstr("\"benchmarks\": ["));
+
+  EXPECT_THAT(output, HasSubstr("\"name\": \"BenchmarkTest/Loop\""));
+  EXPECT_THAT(output, HasSubstr("\"run_type\": \"iteration\""));
+  EXPECT_THAT(output, HasSubstr("\"repetition_index\": 2"));
+  EXPECT_THAT(output, HasSubstr("\"time_unit\": \"ns\""));
+
+  EXPECT_THAT(output, HasSubstr("\"name\": \"BenchmarkTest/Loop_median\""));
+  EXPECT_THAT(output, HasSubstr("\"run_type\": \"aggregate\""));
+  EXPECT_THAT(output, HasSubstr("\"aggregate_name\": \"stddev\""));
+
+  EXPECT_THAT(output, HasSubstr("\"error_occurred\": true"));
+  EXPECT_THAT(output,
+              HasSubstr("\"error_message\": \"Expected \\\"error\\\"\""));
+
+  // There are no aggregates of the failed runs.
+  EXPECT_THAT(output, Not(HasSubstr("BenchmarkTest/Error_mean")));
+
+  EXPECT_THAT(output, HasSubstr("\n  ]\n}\n"));
+}
+
+}  // namespace benchmark
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
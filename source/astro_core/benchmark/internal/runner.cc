@@ -0,0 +1,504 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/benchmark/internal/runner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <regex>
+#include <thread>
+
+#include "astro_core/base/build_config.h"
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/benchmark/internal/timer.h"
+
+#if OS_POSIX
+#  include <unistd.h>
+#endif
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark::internal {
+
+////////////////////////////////////////////////////////////////////////////////
+// Registry.
+
+namespace {
+
+struct Benchmark {
+  // Name in the form of suite/name.
+  std::string name;
+
+  BenchmarkFunction function;
+};
+
+auto GetRegisteredBenchmarks() -> std::vector<Benchmark>& {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+// Get registered benchmarks which match the filter, in the order of their
+// names.
+auto GetFilteredBenchmarks(const std::string& filter)
+    -> std::vector<Benchmark> {
+  const std::regex filter_regex(filter);
+
+  std::vector<Benchmark> benchmarks;
+  for (const Benchmark& benchmark : GetRegisteredBenchmarks()) {
+    if (filter.empty() || std::regex_search(benchmark.name, filter_regex)) {
+      benchmarks.push_back(benchmark);
+    }
+  }
+
+  // The order of static initialization between translation units is not
+  // defined, so sort the benchmarks to have the same order in all runs.
+  std::stable_sort(benchmarks.begin(),
+                   benchmarks.end(),
+                   [](const Benchmark& a, const Benchmark& b) {
+                     return a.name < b.name;
+                   });
+
+  return benchmarks;
+}
+
+}  // namespace
+
+auto RegisterBenchmark(const char* suite_name,
+                       const char* name,
+                       const BenchmarkFunction function) -> bool {
+  GetRegisteredBenchmarks().push_back(
+      {.name = std::string(suite_name) + "/" + name, .function = function});
+  return true;
+}
+
+auto ListBenchmarks(const std::string& filter) -> std::vector<std::string> {
+  std::vector<std::string> names;
+  for (const Benchmark& benchmark : GetFilteredBenchmarks(filter)) {
+    names.push_back(benchmark.name);
+  }
+  return names;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Runner.
+
+class BenchmarkRunner {
+ public:
+  // Upper bound of the number of iterations of the measured loop.
+  static constexpr int64_t kMaxNumIterations = 1'000'000'000;
+
+  BenchmarkRunner(const Benchmark& benchmark, const RunOptions& options)
+      : benchmark_(benchmark), options_(options) {}
+
+  // Run the benchmark with the increasing number of iterations until the
+  // measured loop runs for at least the minimum time.
+  auto Run(const int repetition_index) -> internal::Run {
+    internal::Run run{.benchmark_name = benchmark_.name,
+                      .run_name = benchmark_.name,
+                      .num_repetitions = options_.num_repetitions,
+                      .repetition_index = repetition_index};
+
+    int64_t num_iterations = 1;
+    while (true) {
+      Timer timer;
+      State state(num_iterations, timer);
+
+      benchmark_.function(state);
+
+      // The benchmark could have broken out of the measured loop.
+      if (timer.IsRunning()) {
+        timer.Stop();
+      }
+
+      if (state.has_error_) {
+        run.has_error = true;
+        run.error_message = state.error_message_;
+        return run;
+      }
+      if (!state.is_loop_started_) {
+        run.has_error = true;
+        run.error_message = "Benchmark did not run the measured loop";
+        return run;
+      }
+
+      const double real_time = timer.GetRealTime();
+
+      if (real_time >= options_.min_time ||
+          num_iterations >= kMaxNumIterations) {
+        run.num_iterations = num_iterations;
+        run.real_time = real_time * 1e9 / double(num_iterations);
+        run.cpu_time = timer.GetCPUTime() * 1e9 / double(num_iterations);
+        if (state.num_items_processed_ != 0 && real_time > 0) {
+          run.items_per_second =
+              double(state.num_items_processed_) / real_time;
+        }
+        return run;
+      }
+
+      // Predict the number of iterations needed to reach the minimum time,
+      // with some headroom. Limit the growth, since the time of few iterations
+      // is not a reliable estimate.
+      double multiplier = 10;
+      if (real_time > 0) {
+        multiplier = std::min(options_.min_time * 1.4 / real_time, 10.0);
+      }
+
+      num_iterations = std::min(
+          kMaxNumIterations,
+          std::max(num_iterations + 1,
+                   int64_t(std::ceil(double(num_iterations) * multiplier))));
+    }
+  }
+
+ private:
+  const Benchmark& benchmark_;
+  const RunOptions& options_;
+};
+
+namespace {
+
+// Calculate mean, median, and standard deviation of the successful runs.
+auto CalculateAggregates(const std::vector<Run>& runs) -> std::vector<Run> {
+  std::vector<Run> valid_runs;
+  for (const Run& run : runs) {
+    if (!run.has_error) {
+      valid_runs.push_back(run);
+    }
+  }
+  if (valid_runs.size() < 2) {
+    return {};
+  }
+
+  const double n = double(valid_runs.size());
+
+  auto mean = [&](double Run::*field) {
+    double sum = 0;
+    for (const Run& run : valid_runs) {
+      sum += run.*field;
+    }
+    return sum / n;
+  };
+
+  auto median = [&](double Run::*field) {
+    std::vector<double> values;
+    for (const Run& run : valid_runs) {
+      values.push_back(run.*field);
+    }
+    std::sort(values.begin(), values.end());
+    const size_t half = values.size() / 2;
+    if (values.size() % 2) {
+      return values[half];
+    }
+    return (values[half - 1] + values[half]) / 2;
+  };
+
+  auto stddev = [&](double Run::*field) {
+    const double field_mean = mean(field);
+    double sum = 0;
+    for (const Run& run : valid_runs) {
+      sum += (run.*field - field_mean) * (run.*field - field_mean);
+    }
+    return std::sqrt(sum / (n - 1));
+  };
+
+  std::vector<Run> aggregates;
+  auto add_aggregate = [&](const char* name, auto&& aggregate) {
+    const Run& first_run = valid_runs.front();
+    aggregates.push_back({
+        .benchmark_name = first_run.benchmark_name,
+        .run_name = first_run.benchmark_name + "_" + name,
+        .aggregate_name = name,
+        .num_repetitions = first_run.num_repetitions,
+        .num_iterations = int64_t(valid_runs.size()),
+        .real_time = aggregate(&Run::real_time),
+        .cpu_time = aggregate(&Run::cpu_time),
+        .items_per_second = aggregate(&Run::items_per_second),
+    });
+  };
+  add_aggregate("mean", mean);
+  add_aggregate("median", median);
+  add_aggregate("stddev", stddev);
+
+  return aggregates;
+}
+
+}  // namespace
+
+auto RunBenchmarks(const RunOptions& options,
+                   const Context& context,
+                   const std::span<Reporter* const> reporters) -> bool {
+  const std::vector<Benchmark> benchmarks =
+      GetFilteredBenchmarks(options.filter);
+
+  // Width of the longest run name, including the aggregate suffix.
+  int run_name_width = 0;
+  for (const Benchmark& benchmark : benchmarks) {
+    run_name_width = std::max(run_name_width, int(benchmark.name.size()));
+  }
+  if (options.num_repetitions > 1) {
+    run_name_width += int(std::string_view("_median").size());
+  }
+
+  for (Reporter* reporter : reporters) {
+    reporter->ReportContext(context);
+  }
+
+  auto report = [&](const Run& run) {
+    for (Reporter* reporter : reporters) {
+      reporter->ReportRun(run, run_name_width);
+    }
+  };
+
+  bool ok = true;
+  for (const Benchmark& benchmark : benchmarks) {
+    BenchmarkRunner runner(benchmark, options);
+
+    std::vector<Run> runs;
+    for (int i = 0; i < std::max(options.num_repetitions, 1); ++i) {
+      runs.push_back(runner.Run(i));
+      report(runs.back());
+
+      ok &= !runs.back().has_error;
+    }
+
+    for (const Run& aggregate : CalculateAggregates(runs)) {
+      report(aggregate);
+    }
+  }
+
+  for (Reporter* reporter : reporters) {
+    reporter->Finalize();
+  }
+
+  return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Context.
+
+auto GetContext(const std::string& executable) -> Context {
+  Context context;
+
+  const std::time_t now = std::time(nullptr);
+  char date[64];
+  if (std::strftime(
+          date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now))) {
+    context.date = date;
+  }
+
+#if OS_POSIX
+  char host_name[256];
+  if (gethostname(host_name, sizeof(host_name)) == 0) {
+    host_name[sizeof(host_name) - 1] = '\0';
+    context.host_name = host_name;
+  }
+#else
+  if (const char* host_name = std::getenv("COMPUTERNAME")) {
+    context.host_name = host_name;
+  }
+#endif
+
+  context.executable = executable;
+  context.num_cpus = int(std::thread::hardware_concurrency());
+
+#if defined(NDEBUG)
+  context.build_type = "release";
+#else
+  context.build_type = "debug";
+#endif
+
+  context.library_version = std::to_string(ASTRO_CORE_VERSION_MAJOR) + "." +
+                            std::to_string(ASTRO_CORE_VERSION_MINOR) + "." +
+                            std::to_string(ASTRO_CORE_VERSION_REVISION);
+
+  return context;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Console reporter.
+
+namespace {
+
+// Format time given in nanoseconds using the unit which keeps the number
+// readable.
+auto FormatTime(const double time_ns) -> std::string {
+  char buffer[64];
+  if (time_ns < 1e4) {
+    std::snprintf(buffer, sizeof(buffer), "%10.1f ns", time_ns);
+  } else if (time_ns < 1e7) {
+    std::snprintf(buffer, sizeof(buffer), "%10.1f us", time_ns / 1e3);
+  } else {
+    std::snprintf(buffer, sizeof(buffer), "%10.1f ms", time_ns / 1e6);
+  }
+  return buffer;
+}
+
+}  // namespace
+
+void ConsoleReporter::ReportContext(const Context& context) {
+  stream_ << context.date << "\n";
+  stream_ << "Running " << context.executable << "\n";
+  stream_ << "Run on " << context.host_name << " (" << context.num_cpus
+          << " CPUs)\n";
+
+#if !defined(NDEBUG)
+  stream_ << "WARNING: Library was built as DEBUG. Timings may be affected.\n";
+#endif
+}
+
+void ConsoleReporter::ReportRun(const Run& run, const int run_name_width) {
+  char buffer[256];
+
+  if (!is_header_written_) {
+    std::snprintf(buffer,
+                  sizeof(buffer),
+                  "%-*s %13s %13s %12s",
+                  run_name_width,
+                  "Benchmark",
+                  "Time",
+                  "CPU",
+                  "Iterations");
+    const std::string header = buffer;
+    const std::string separator(header.size(), '-');
+
+    stream_ << separator << "\n" << header << "\n" << separator << "\n";
+
+    is_header_written_ = true;
+  }
+
+  std::snprintf(buffer, sizeof(buffer), "%-*s", run_name_width,
+                run.run_name.c_str());
+  stream_ << buffer;
+
+  if (run.has_error) {
+    stream_ << " ERROR: " << run.error_message << "\n";
+    stream_.flush();
+    return;
+  }
+
+  std::snprintf(buffer,
+                sizeof(buffer),
+                " %s %s %12lld",
+                FormatTime(run.real_time).c_str(),
+                FormatTime(run.cpu_time).c_str(),
+                static_cast<long long>(run.num_iterations));
+  stream_ << buffer;
+
+  if (run.items_per_second != 0) {
+    std::snprintf(
+        buffer, sizeof(buffer), " items_per_second=%g", run.items_per_second);
+    stream_ << buffer;
+  }
+
+  stream_ << "\n";
+  stream_.flush();
+}
+
+void ConsoleReporter::Finalize() { stream_.flush(); }
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON reporter.
+
+namespace {
+
+// Quote and escape the string for JSON.
+auto JSONString(const std::string_view str) -> std::string {
+  std::string result = "\"";
+  for (const char ch : str) {
+    switch (ch) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\r': result += "\\r"; break;
+      case '\t': result += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(ch) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", ch);
+          result += buffer;
+        } else {
+          result += ch;
+        }
+    }
+  }
+  result += "\"";
+  return result;
+}
+
+auto JSONNumber(const double value) -> std::string {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "%.10g", value);
+  return buffer;
+}
+
+}  // namespace
+
+void JSONReporter::ReportContext(const Context& context) {
+  stream_ << "{\n";
+  stream_ << "  \"context\": {\n";
+  stream_ << "    \"date\": " << JSONString(context.date) << ",\n";
+  stream_ << "    \"host_name\": " << JSONString(context.host_name) << ",\n";
+  stream_ << "    \"executable\": " << JSONString(context.executable) << ",\n";
+  stream_ << "    \"num_cpus\": " << context.num_cpus << ",\n";
+  stream_ << "    \"library_build_type\": " << JSONString(context.build_type)
+          << ",\n";
+  stream_ << "    \"library_version\": "
+          << JSONString(context.library_version) << "\n";
+  stream_ << "  },\n";
+  stream_ << "  \"benchmarks\": [";
+}
+
+void JSONReporter::ReportRun(const Run& run, const int /*run_name_width*/) {
+  stream_ << (is_first_run_ ? "\n" : ",\n");
+  is_first_run_ = false;
+
+  const bool is_aggregate = !run.aggregate_name.empty();
+
+  stream_ << "    {\n";
+  stream_ << "      \"name\": " << JSONString(run.run_name) << ",\n";
+  stream_ << "      \"run_name\": " << JSONString(run.benchmark_name) << ",\n";
+  stream_ << "      \"run_type\": "
+          << JSONString(is_aggregate ? "aggregate" : "iteration") << ",\n";
+  stream_ << "      \"repetitions\": " << run.num_repetitions << ",\n";
+  if (is_aggregate) {
+    stream_ << "      \"aggregate_name\": " << JSONString(run.aggregate_name)
+            << ",\n";
+  } else {
+    stream_ << "      \"repetition_index\": " << run.repetition_index << ",\n";
+  }
+  stream_ << "      \"threads\": 1,\n";
+
+  if (run.has_error) {
+    stream_ << "      \"error_occurred\": true,\n";
+    stream_ << "      \"error_message\": " << JSONString(run.error_message)
+            << "\n";
+    stream_ << "    }";
+    return;
+  }
+
+  stream_ << "      \"iterations\": " << run.num_iterations << ",\n";
+  stream_ << "      \"real_time\": " << JSONNumber(run.real_time) << ",\n";
+  stream_ << "      \"cpu_time\": " << JSONNumber(run.cpu_time) << ",\n";
+  if (run.items_per_second != 0) {
+    stream_ << "      \"items_per_second\": "
+            << JSONNumber(run.items_per_second) << ",\n";
+  }
+  stream_ << "      \"time_unit\": \"ns\"\n";
+  stream_ << "    }";
+}
+
+void JSONReporter::Finalize() {
+  stream_ << "\n  ]\n";
+  stream_ << "}\n";
+  stream_.flush();
+}
+
+}  // namespace benchmark::internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,135 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Runner of the registered benchmarks, and reporters of the results.
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark::internal {
+
+struct RunOptions {
+  // Regular expression which the name of a benchmark is to match to be run.
+  // Empty filter matches all benchmarks.
+  std::string filter;
+
+  // Minimum time in seconds the measured loop of a benchmark is to run for.
+  // The time of zero runs the loop once.
+  double min_time{0.5};
+
+  // The number of times to run each benchmark.
+  // Aggregates of the runs are reported when there is more than one
+  // repetition.
+  int num_repetitions{1};
+};
+
+// Information about the environment the benchmarks are run in.
+struct Context {
+  std::string date;
+  std::string host_name;
+  std::string executable;
+  int num_cpus{0};
+  std::string build_type;
+  std::string library_version;
+};
+
+// Result of a benchmark run, or an aggregate of multiple runs.
+struct Run {
+  // Name of the benchmark in the form of suite/name, and the name of the run.
+  // The run name has the name of aggregate appended to it.
+  std::string benchmark_name;
+  std::string run_name;
+
+  // Name of the aggregate: mean, median, stddev. Empty for individual runs.
+  std::string aggregate_name;
+
+  int num_repetitions{1};
+  int repetition_index{0};
+
+  int64_t num_iterations{0};
+
+  // Time per iteration in nanoseconds.
+  double real_time{0};
+  double cpu_time{0};
+
+  // Items processed per second, or 0 if the benchmark does not report them.
+  double items_per_second{0};
+
+  bool has_error{false};
+  std::string error_message;
+};
+
+// Interface for the reporting of the benchmark results.
+class Reporter {
+ public:
+  virtual ~Reporter() = default;
+
+  virtual void ReportContext(const Context& context) = 0;
+
+  // Report the result of the run, as soon as it is available.
+  // The run_name_width is the length of the longest name of the runs.
+  virtual void ReportRun(const Run& run, int run_name_width) = 0;
+
+  virtual void Finalize() = 0;
+};
+
+// Human-readable table of results.
+class ConsoleReporter : public Reporter {
+ public:
+  explicit ConsoleReporter(std::ostream& stream) : stream_(stream) {}
+
+  void ReportContext(const Context& context) override;
+  void ReportRun(const Run& run, int run_name_width) override;
+  void Finalize() override;
+
+ private:
+  std::ostream& stream_;
+  bool is_header_written_{false};
+};
+
+// Machine-readable results, following the JSON schema of the Google Benchmark.
+class JSONReporter : public Reporter {
+ public:
+  explicit JSONReporter(std::ostream& stream) : stream_(stream) {}
+
+  void ReportContext(const Context& context) override;
+  void ReportRun(const Run& run, int run_name_width) override;
+  void Finalize() override;
+
+ private:
+  std::ostream& stream_;
+  bool is_first_run_{true};
+};
+
+// Get the context of the current process.
+auto GetContext(const std::string& executable) -> Context;
+
+// Run all registered benchmarks which match the filter, reporting results to
+// all reporters.
+//
+// Returns false if any of the benchmarks failed.
+auto RunBenchmarks(const RunOptions& options,
+                   const Context& context,
+                   std::span<Reporter* const> reporters) -> bool;
+
+// Get names of all registered benchmarks which match the filter.
+auto ListBenchmarks(const std::string& filter) -> std::vector<std::string>;
+
+// Set the folder from which the BenchmarkFileAbsolutePath() resolves paths.
+void SetBenchmarkSrcDir(const std::string& srcdir);
+
+}  // namespace benchmark::internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,63 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Timer which accumulates the real and CPU time of the measured loop.
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <ctime>
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark::internal {
+
+class Timer {
+ public:
+  void Start() {
+    assert(!is_running_);
+
+    is_running_ = true;
+    start_real_time_ = Clock::now();
+    start_cpu_time_ = std::clock();
+  }
+
+  void Stop() {
+    assert(is_running_);
+
+    const std::clock_t cpu_time = std::clock();
+    const Clock::time_point real_time = Clock::now();
+
+    is_running_ = false;
+    real_time_ +=
+        std::chrono::duration<double>(real_time - start_real_time_).count();
+    cpu_time_ += double(cpu_time - start_cpu_time_) / CLOCKS_PER_SEC;
+  }
+
+  auto IsRunning() const -> bool { return is_running_; }
+
+  // Accumulated time in seconds.
+  auto GetRealTime() const -> double { return real_time_; }
+  auto GetCPUTime() const -> double { return cpu_time_; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  bool is_running_{false};
+
+  Clock::time_point start_real_time_;
+  std::clock_t start_cpu_time_{0};
+
+  double real_time_{0};
+  double cpu_time_{0};
+};
+
+}  // namespace benchmark::internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
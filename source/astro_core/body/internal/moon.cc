@@ -375,18 +375,9 @@ auto LunisolarNutationPolynomial(const double t, Args... args) -> double {
   return ArcsecToRadians(ReduceArcsec(Polynomial(t, args...)));
 }
 
-}  // namespace
-
-// The implementation follows the algorithm described in [Meeus1998] Page 337.
-auto GetMeeusMoonCoordinate(const Time& time) -> MeeusMoonCoordinate {
-  const Time time_tt = time.ToScale(TimeScale::kTT);
-  const JulianDate jd_tt = time_tt.AsFormat<JulianDate>();
-
-  return GetMeeusMoonCoordinate(jd_tt);
-}
-
-auto GetMoonCoordinate(const Time& time) -> GCRF {
-  const Time time_tt = time.ToScale(TimeScale::kTT);
+// Calculate the Moon position in GCRF at the given time, which is also
+// provided in the TT scale.
+auto CalculateMoonCoordinate(const Time& time, const Time& time_tt) -> GCRF {
   const JulianDate jd_tt = time_tt.AsFormat<JulianDate>();
 
   const MeeusMoonCoordinate meeus = GetMeeusMoonCoordinate(jd_tt);
@@ -427,5 +418,25 @@ auto GetMoonCoordinate(const Time& time) -> GCRF {
   return GCRF({.observation_time = time, .position = r_gcrf});
 }
 
+}  // namespace
+
+// The implementation follows the algorithm described in [Meeus1998] Page 337.
+auto GetMeeusMoonCoordinate(const Time& time) -> MeeusMoonCoordinate {
+  return GetMeeusMoonCoordinate(
+      time.ToScale<TimeScale::kTT>().AsFormat<JulianDate>());
+}
+
+auto GetMeeusMoonCoordinate(const TimeScales& scales) -> MeeusMoonCoordinate {
+  return GetMeeusMoonCoordinate(scales.GetTT().AsFormat<JulianDate>());
+}
+
+auto GetMoonCoordinate(const Time& time) -> GCRF {
+  return CalculateMoonCoordinate(time, time.ToScale<TimeScale::kTT>());
+}
+
+auto GetMoonCoordinate(const TimeScales& scales) -> GCRF {
+  return CalculateMoonCoordinate(scales.GetTime(), scales.GetTT());
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -9,6 +9,7 @@
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/time/scale.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
 
@@ -99,6 +100,11 @@ TEST(body, GetMoonCoordinate) {
                          253937183.605159878731,
                          87476708.822706788778}));
 
+  // Calculation at the time scales gives the same result.
+  const GCRF scales_gcrf = GetMoonCoordinate(TimeScales(time));
+  EXPECT_EQ(scales_gcrf.observation_time, time);
+  EXPECT_EQ(scales_gcrf.position.GetCartesian(), gcrf.position.GetCartesian());
+
   // TODO(sergey): Support velocity calculation.
   EXPECT_FALSE(gcrf.velocity.HasValue());
 }
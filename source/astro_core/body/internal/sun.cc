@@ -15,8 +15,12 @@
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
-auto GetApproximateSunCoordinate(const Time& time) -> GCRF {
-  const Time time_tt = time.ToScale(TimeScale::kTT);
+namespace {
+
+// Calculate the approximate position of the Sun at the given time, which is
+// also provided in the TT scale.
+auto CalculateApproximateSunCoordinate(const Time& time, const Time& time_tt)
+    -> GCRF {
   const JulianDate jd_tt = time_tt.AsFormat<JulianDate>();
 
   // First, compute D, the number of days and fraction (+ or –) from the epoch
@@ -72,12 +76,26 @@ auto GetApproximateSunCoordinate(const Time& time) -> GCRF {
       {.latitude = d_rad, .longitude = RA_rad, .distance = R_AU});
   const Cartesian tete_cartesian = tete_spherical.ToCartesian();
 
-  const Mat3 rbpn = BiasPrecessionNutationRotation06A(jd_tt);
+  // The accuracy of the IAU 2000B nutation is about a milliarcsecond, which is
+  // well below the accuracy of the algorithm.
+  const Mat3 rbpn = BiasPrecessionNutationRotation06A(
+      jd_tt, {.model = NutationPrecision::Model::k2000B});
   const Cartesian gsrf_cartesian =
       rbpn.Transposed() * Vec3(tete_cartesian) * constants::kAstronomicalUnit;
 
   return GCRF({.observation_time = time, .position = gsrf_cartesian});
 }
 
+}  // namespace
+
+auto GetApproximateSunCoordinate(const Time& time) -> GCRF {
+  return CalculateApproximateSunCoordinate(time,
+                                           time.ToScale<TimeScale::kTT>());
+}
+
+auto GetApproximateSunCoordinate(const TimeScales& scales) -> GCRF {
+  return CalculateApproximateSunCoordinate(scales.GetTime(), scales.GetTT());
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
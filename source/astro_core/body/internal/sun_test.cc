@@ -10,6 +10,7 @@
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/time/scale.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
 
@@ -55,6 +56,11 @@ TEST(body, GetApproximateSunCoordinate) {
   // diameter of the Sun is 1,391,400 km the uncertainty is only about
   // 0.0008%.
   EXPECT_NEAR(gsrf.position.GetSpherical().distance, 149971545699.90295, 11000);
+
+  // Calculation at the time scales gives the same result.
+  const GCRF scales_gcrf = GetApproximateSunCoordinate(TimeScales(time));
+  EXPECT_EQ(scales_gcrf.observation_time, time);
+  EXPECT_EQ(scales_gcrf.position.GetCartesian(), gsrf.position.GetCartesian());
 }
 
 }  // namespace astro_core
@@ -22,6 +22,7 @@
 
 #include "astro_core/coordinate/gcrf.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
@@ -44,9 +45,11 @@ struct MeeusMoonCoordinate {
 // described in [Meeus1998].
 // The result is in mean ecliptic coordinates of date.
 auto GetMeeusMoonCoordinate(const Time& time) -> MeeusMoonCoordinate;
+auto GetMeeusMoonCoordinate(const TimeScales& scales) -> MeeusMoonCoordinate;
 
 // Calculate Earth's Moon position at the given time in GCRF coordinate frame.
 auto GetMoonCoordinate(const Time& time) -> GCRF;
+auto GetMoonCoordinate(const TimeScales& scales) -> GCRF;
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -16,6 +16,7 @@
 
 #include "astro_core/coordinate/gcrf.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
@@ -30,5 +31,8 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 // declination. The distance is within 11km.
 auto GetApproximateSunCoordinate(const Time& time) -> GCRF;
 
+// Approximate position of the Sun at the time of the given time scales.
+auto GetApproximateSunCoordinate(const TimeScales& scales) -> GCRF;
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
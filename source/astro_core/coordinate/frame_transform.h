@@ -6,14 +6,16 @@
 
 #pragma once
 
+#include <span>
+
 #include "astro_core/numeric/numeric.h"
+#include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
-class Time;
-
 // Conversion matrix for TEME-to-PEF conversion:
 //   r_pef = TEMEToPEFMatrix(time) * r_teme
 auto TEMEToPEFMatrix(const Time& time) -> Mat3;
@@ -35,6 +37,62 @@ void TEMEToITRF(const Time& time,
                 Vec3& r_itrf,
                 Vec3& v_itrf);
 
+// Precomputed TEME-to-ITRF transformation at the given time.
+//
+// Calculating the transformation matrices involves time scale conversion and
+// lookup in the Earth orientation table, which is the most expensive part of
+// TEMEToITRF(). The transform object allows to calculate the matrices once and
+// apply them to many positions and velocities observed at the same time, such
+// as states of all satellites of a catalog propagated to the same time.
+//
+// The result of Apply() is bitwise identical to TEMEToITRF() at the same time.
+class TEMEToITRFTransform {
+ public:
+  static auto At(const Time& time) -> TEMEToITRFTransform;
+
+  // Calculate the transformation at the time of the given time scales. Allows
+  // to re-use the time scale conversion for other calculations at that time.
+  static auto At(const TimeScales& scales) -> TEMEToITRFTransform;
+
+  // Time at which the transformation has been calculated.
+  auto GetTime() const -> const Time& { return time_; }
+
+  // Conversion matrix for TEME-to-ITRF conversion of positions.
+  auto GetMatrix() const -> Mat3 { return pef_to_itrf_ * teme_to_pef_; }
+
+  // Convert position from TEME to ITRF.
+  auto Apply(const Vec3& r_teme) const -> Vec3 {
+    return pef_to_itrf_ * (teme_to_pef_ * r_teme);
+  }
+
+  // Convert position and velocity from TEME to ITRF.
+  void Apply(const Vec3& r_teme,
+             const Vec3& v_teme,
+             Vec3& r_itrf,
+             Vec3& v_itrf) const;
+
+  // Convert positions from TEME to ITRF.
+  // The output span is to be of the same size as the input one.
+  void Apply(std::span<const Vec3> r_teme, std::span<Vec3> r_itrf) const;
+
+  // Convert positions and velocities from TEME to ITRF.
+  // All spans are to be of the same size.
+  void Apply(std::span<const Vec3> r_teme,
+             std::span<const Vec3> v_teme,
+             std::span<Vec3> r_itrf,
+             std::span<Vec3> v_itrf) const;
+
+ private:
+  TEMEToITRFTransform(const Time& time,
+                      const Mat3& teme_to_pef,
+                      const Mat3& pef_to_itrf)
+      : time_(time), teme_to_pef_(teme_to_pef), pef_to_itrf_(pef_to_itrf) {}
+
+  Time time_;
+  Mat3 teme_to_pef_;
+  Mat3 pef_to_itrf_;
+};
+
 // Convert position and velocity from ITRF to TEME.
 // This is more optimal than converting the position of velocity separately
 // using individually constructed matrices.
@@ -60,5 +118,68 @@ void GCRFToITRF(const Time& time,
                 Vec3& r_gcrf,
                 Vec3& v_gcrf);
 
+// Precomputed GCRF-to-ITRF transformation at the given time.
+//
+// Similar to the TEMEToITRFTransform it allows to calculate the precession,
+// nutation, Earth rotation and polar motion matrices once and apply them to
+// many positions and velocities observed at the same time.
+//
+// The result of Apply() is bitwise identical to GCRFToITRF() at the same time.
+class GCRFToITRFTransform {
+ public:
+  static auto At(const Time& time) -> GCRFToITRFTransform;
+
+  // Calculate the transformation at the time of the given time scales. Allows
+  // to re-use the time scale conversion for other calculations at that time.
+  static auto At(const TimeScales& scales) -> GCRFToITRFTransform;
+
+  // Time at which the transformation has been calculated.
+  auto GetTime() const -> const Time& { return time_; }
+
+  // Conversion matrix for GCRF-to-ITRF conversion of positions.
+  auto GetMatrix() const -> const Mat3& { return gcrf_to_itrf_; }
+
+  // Convert position from GCRF to ITRF.
+  auto Apply(const Vec3& r_gcrf) const -> Vec3 {
+    return gcrf_to_itrf_ * r_gcrf;
+  }
+
+  // Convert position and velocity from GCRF to ITRF.
+  void Apply(const Vec3& r_gcrf,
+             const Vec3& v_gcrf,
+             Vec3& r_itrf,
+             Vec3& v_itrf) const;
+
+  // Convert positions from GCRF to ITRF.
+  // The output span is to be of the same size as the input one.
+  void Apply(std::span<const Vec3> r_gcrf, std::span<Vec3> r_itrf) const;
+
+  // Convert positions and velocities from GCRF to ITRF.
+  // All spans are to be of the same size.
+  void Apply(std::span<const Vec3> r_gcrf,
+             std::span<const Vec3> v_gcrf,
+             std::span<Vec3> r_itrf,
+             std::span<Vec3> v_itrf) const;
+
+ private:
+  GCRFToITRFTransform(const Time& time,
+                      const Mat3& gcrf_to_tirs,
+                      const Mat3& tirs_to_itrf)
+      : time_(time),
+        gcrf_to_tirs_(gcrf_to_tirs),
+        tirs_to_itrf_(tirs_to_itrf),
+        gcrf_to_itrf_(tirs_to_itrf * gcrf_to_tirs),
+        itrf_to_tirs_(tirs_to_itrf.Transposed()) {}
+
+  Time time_;
+
+  Mat3 gcrf_to_tirs_;
+  Mat3 tirs_to_itrf_;
+
+  // Cached combined and inverse matrices.
+  Mat3 gcrf_to_itrf_;
+  Mat3 itrf_to_tirs_;
+};
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
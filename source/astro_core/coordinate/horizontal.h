@@ -16,6 +16,7 @@ namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class ITRF;
+class ObserverFrame;
 
 class Horizontal {
  public:
@@ -56,6 +57,13 @@ class Horizontal {
   // Uses the observation time from the object ITRF.
   static auto FromITRF(const ITRF& itrf, const ITRF& site_itrf) -> Horizontal;
 
+  // Construct the horizontal coordinate from the given position of the object
+  // in ITRF as seen from the site of the observer frame.
+  //
+  // This allows to re-use the frame of the site for many positions.
+  static auto FromITRF(const ITRF& itrf, const ObserverFrame& observer_frame)
+      -> Horizontal;
+
   // Elevation, sometimes referred to as altitude.
   //
   // The angle between the object and the observer's local horizon. For visible
@@ -18,6 +18,8 @@
 
 #include "astro_core/coordinate/frame_transform.h"
 
+#include <cassert>
+
 #include "astro_core/earth/celestial_intermediate_pole.h"
 #include "astro_core/earth/earth.h"
 #include "astro_core/earth/orientation.h"
@@ -29,11 +31,15 @@
 #include "astro_core/time/format/modified_julian_date.h"
 #include "astro_core/time/greenwich_sidereal_time.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
-auto TEMEToPEFMatrix(const Time& time) -> Mat3 {
+namespace {
+
+// Conversion matrix for TEME-to-PEF conversion at the given time in UT1 scale.
+auto TEMEToPEFMatrixUT1(const Time& time_ut1) -> Mat3 {
   // Follows the following:
   //   [Vallado2013] Eq. (3-90).
   //   [Vallado2006] Eq. (1).
@@ -41,17 +47,16 @@ auto TEMEToPEFMatrix(const Time& time) -> Mat3 {
   // A bit confusing part here is that in the [Vallado2006] Eq. (C-2) the matrix
   // is transposed, but it is not in other implementations like Astropy.
 
-  const JulianDate ut1_jd =
-      time.ToScale<TimeScale::kUT1>().AsFormat<JulianDate>();
+  const JulianDate ut1_jd = time_ut1.AsFormat<JulianDate>();
 
   const double gmst82{GreenwichMeanSiderealTime1982(ut1_jd)};
 
   return ROT3(gmst82);
 }
 
-auto PEFToITRFMatrix(const Time& time) -> Mat3 {
-  const ModifiedJulianDate utc_mjd =
-      time.ToScale<TimeScale::kUTC>().AsFormat<ModifiedJulianDate>();
+// Conversion matrix for PEF-to-ITRF conversion at the given time in UTC scale.
+auto PEFToITRFMatrixUTC(const Time& time_utc) -> Mat3 {
+  const ModifiedJulianDate utc_mjd = time_utc.AsFormat<ModifiedJulianDate>();
 
   // TODO(sergey): Investigate storing radians in the Earth orientation table.
   const Vec2 polar_motion = GetEarthPolarMotionInUTCScale(utc_mjd);
@@ -63,26 +68,39 @@ auto PEFToITRFMatrix(const Time& time) -> Mat3 {
   return ROT1(-polar_motion(1)) * ROT2(-polar_motion(0));
 }
 
+}  // namespace
+
+auto TEMEToPEFMatrix(const Time& time) -> Mat3 {
+  return TEMEToPEFMatrixUT1(time.ToScale<TimeScale::kUT1>());
+}
+
+auto PEFToITRFMatrix(const Time& time) -> Mat3 {
+  return PEFToITRFMatrixUTC(time.ToScale<TimeScale::kUTC>());
+}
+
 auto TEMEToITRFMatrix(const Time& time) -> Mat3 {
-  const Mat3 teme_to_pef = TEMEToPEFMatrix(time);
-  const Mat3 pef_to_itrf = PEFToITRFMatrix(time);
+  return TEMEToITRFTransform::At(time).GetMatrix();
+}
 
-  return pef_to_itrf * teme_to_pef;
+auto TEMEToITRFTransform::At(const Time& time) -> TEMEToITRFTransform {
+  return At(TimeScales(time));
 }
 
-void TEMEToITRF(const Time& time,
-                const Vec3& r_teme,
-                const Vec3& v_teme,
-                Vec3& r_itrf,
-                Vec3& v_itrf) {
-  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
+auto TEMEToITRFTransform::At(const TimeScales& scales) -> TEMEToITRFTransform {
+  return TEMEToITRFTransform(scales.GetTime(),
+                             TEMEToPEFMatrixUT1(scales.GetUT1()),
+                             PEFToITRFMatrixUTC(scales.GetUTC()));
+}
 
-  const Mat3 teme_to_pef = TEMEToPEFMatrix(time);
-  const Mat3 pef_to_itrf = PEFToITRFMatrix(time);
+void TEMEToITRFTransform::Apply(const Vec3& r_teme,
+                                const Vec3& v_teme,
+                                Vec3& r_itrf,
+                                Vec3& v_itrf) const {
+  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
 
-  const Vec3 r_pef = teme_to_pef * r_teme;
+  const Vec3 r_pef = teme_to_pef_ * r_teme;
 
-  r_itrf = pef_to_itrf * r_pef;
+  r_itrf = pef_to_itrf_ * r_pef;
 
   // Inspiration from [satstuff] and [Vallado2013] Eq. (3-80).
   // The former one seems to be matching more closely here.
@@ -94,7 +112,39 @@ void TEMEToITRF(const Time& time,
   // It is possible to increase precision of the Earth omega using [Vallado2013]
   // Eq. (3-40) but the difference is probably below of what the rest of the
   // calculations here can achieve anyway.
-  v_itrf = pef_to_itrf * (teme_to_pef * v_teme - omega.Cross(r_pef));
+  v_itrf = pef_to_itrf_ * (teme_to_pef_ * v_teme - omega.Cross(r_pef));
+}
+
+void TEMEToITRFTransform::Apply(const std::span<const Vec3> r_teme,
+                                const std::span<Vec3> r_itrf) const {
+  assert(r_teme.size() == r_itrf.size());
+
+  const size_t num_vectors = r_teme.size();
+  for (size_t i = 0; i < num_vectors; ++i) {
+    r_itrf[i] = Apply(r_teme[i]);
+  }
+}
+
+void TEMEToITRFTransform::Apply(const std::span<const Vec3> r_teme,
+                                const std::span<const Vec3> v_teme,
+                                const std::span<Vec3> r_itrf,
+                                const std::span<Vec3> v_itrf) const {
+  assert(r_teme.size() == v_teme.size());
+  assert(r_teme.size() == r_itrf.size());
+  assert(r_teme.size() == v_itrf.size());
+
+  const size_t num_vectors = r_teme.size();
+  for (size_t i = 0; i < num_vectors; ++i) {
+    Apply(r_teme[i], v_teme[i], r_itrf[i], v_itrf[i]);
+  }
+}
+
+void TEMEToITRF(const Time& time,
+                const Vec3& r_teme,
+                const Vec3& v_teme,
+                Vec3& r_itrf,
+                Vec3& v_itrf) {
+  TEMEToITRFTransform::At(time).Apply(r_teme, v_teme, r_itrf, v_itrf);
 }
 
 void ITRFToTEME(const Time& time,
@@ -104,8 +154,10 @@ void ITRFToTEME(const Time& time,
                 Vec3& v_teme) {
   constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
 
-  const Mat3 pef_to_teme = TEMEToPEFMatrix(time).Transposed();
-  const Mat3 itrf_to_pef = PEFToITRFMatrix(time).Transposed();
+  const TimeScales scales(time);
+
+  const Mat3 pef_to_teme = TEMEToPEFMatrixUT1(scales.GetUT1()).Transposed();
+  const Mat3 itrf_to_pef = PEFToITRFMatrixUTC(scales.GetUTC()).Transposed();
 
   const Vec3 r_pef = itrf_to_pef * r_itrf;
 
@@ -113,33 +165,49 @@ void ITRFToTEME(const Time& time,
   v_teme = pef_to_teme * (itrf_to_pef * v_itrf + omega.Cross(r_pef));
 }
 
-void ITRFToGCRF(const Time& time,
-                const Vec3& r_itrf,
-                const Vec3& v_itrf,
-                Vec3& r_gcrf,
-                Vec3& v_gcrf) {
-  // Implements Method (1) from [IERS2010] Section 5.9, Page 69.
-  // This method is also described in [Vallado2013] Page 220.
-
-  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
+namespace {
 
-  const JulianDate jd_tt =
-      time.ToScale<TimeScale::kTT>().AsFormat<JulianDate>();
-  const JulianDate jd_ut1 =
-      time.ToScale<TimeScale::kUT1>().AsFormat<JulianDate>();
+// Calculate matrices of the GCRF-to-ITRF transformation chain at the given
+// time:
+//   r_itrf = tirs_to_itrf * cirs_to_tirs * gcrf_to_cirs * r_gcrf
+//
+// Implements Method (1) from [IERS2010] Section 5.9, Page 69.
+// This method is also described in [Vallado2013] Page 220.
+void CalculateGCRFToITRFMatrices(const TimeScales& scales,
+                                 Mat3& gcrf_to_cirs,
+                                 Mat3& cirs_to_tirs,
+                                 Mat3& tirs_to_itrf) {
+  const JulianDate jd_tt = scales.GetTT().AsFormat<JulianDate>();
+  const JulianDate jd_ut1 = scales.GetUT1().AsFormat<JulianDate>();
   const ModifiedJulianDate mjd_utc =
-      time.ToScale<TimeScale::kUTC>().AsFormat<ModifiedJulianDate>();
+      scales.GetUTC().AsFormat<ModifiedJulianDate>();
+
+  Vec2 cip_xy;
+  double s;
+  LookupCelestialIntermediatePole(jd_tt, cip_xy, s);
 
-  const Vec2 cip_xy = CelestialIntermediatePole(jd_tt);
   const Vec2 polar_motion = GetEarthPolarMotionInUTCScale(mjd_utc);
-  const double s = CelestialIntermediateOriginLocator(jd_tt, cip_xy);
   const double s_prime = TerrestrialIntermediateOriginLocator(jd_tt);
   const double era = EarthRotationAngle(jd_ut1);
 
-  const Mat3 gcrf_to_cirs = CelestialToIntermediateFrameOfDateMatrix(cip_xy, s);
-  const Mat3 cirs_to_tirs = AxisRotationAroundZ(era);
-  const Mat3 tirs_to_itrf = ROT1(-polar_motion(1)) * ROT2(-polar_motion(0)) *
-                            AxisRotationAroundZ(s_prime);
+  gcrf_to_cirs = CelestialToIntermediateFrameOfDateMatrix(cip_xy, s);
+  cirs_to_tirs = AxisRotationAroundZ(era);
+  tirs_to_itrf = ROT1(-polar_motion(1)) * ROT2(-polar_motion(0)) *
+                 AxisRotationAroundZ(s_prime);
+}
+
+}  // namespace
+
+void ITRFToGCRF(const Time& time,
+                const Vec3& r_itrf,
+                const Vec3& v_itrf,
+                Vec3& r_gcrf,
+                Vec3& v_gcrf) {
+  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
+
+  Mat3 gcrf_to_cirs, cirs_to_tirs, tirs_to_itrf;
+  CalculateGCRFToITRFMatrices(
+      TimeScales(time), gcrf_to_cirs, cirs_to_tirs, tirs_to_itrf);
 
   const Mat3 gcrf_to_tirs = cirs_to_tirs * gcrf_to_cirs;
   const Mat3 gcrf_to_itrf = tirs_to_itrf * gcrf_to_tirs;
@@ -162,49 +230,68 @@ void ITRFToGCRF(const Time& time,
   v_gcrf = PN * R * (W * v_itrf + omega.Cross(r_tirs));
 }
 
-void GCRFToITRF(const Time& time,
-                const Vec3& r_gcrf,
-                const Vec3& v_gcrf,
-                Vec3& r_itrf,
-                Vec3& v_itrf) {
+auto GCRFToITRFTransform::At(const Time& time) -> GCRFToITRFTransform {
+  return At(TimeScales(time));
+}
+
+auto GCRFToITRFTransform::At(const TimeScales& scales) -> GCRFToITRFTransform {
   // The implementation is the reverse of ITRFToGCRF.
 
-  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
+  Mat3 gcrf_to_cirs, cirs_to_tirs, tirs_to_itrf;
+  CalculateGCRFToITRFMatrices(
+      scales, gcrf_to_cirs, cirs_to_tirs, tirs_to_itrf);
 
-  const JulianDate jd_tt =
-      time.ToScale<TimeScale::kTT>().AsFormat<JulianDate>();
-  const JulianDate jd_ut1 =
-      time.ToScale<TimeScale::kUT1>().AsFormat<JulianDate>();
-  const ModifiedJulianDate mjd_utc =
-      time.ToScale<TimeScale::kUTC>().AsFormat<ModifiedJulianDate>();
+  return GCRFToITRFTransform(
+      scales.GetTime(), cirs_to_tirs * gcrf_to_cirs, tirs_to_itrf);
+}
 
-  const Vec2 cip_xy = CelestialIntermediatePole(jd_tt);
-  const Vec2 polar_motion = GetEarthPolarMotionInUTCScale(mjd_utc);
-  const double s = CelestialIntermediateOriginLocator(jd_tt, cip_xy);
-  const double s_prime = TerrestrialIntermediateOriginLocator(jd_tt);
-  const double era = EarthRotationAngle(jd_ut1);
+void GCRFToITRFTransform::Apply(const Vec3& r_gcrf,
+                                const Vec3& v_gcrf,
+                                Vec3& r_itrf,
+                                Vec3& v_itrf) const {
+  constexpr Vec3 omega{0.0, 0.0, Earth::kOmega};
 
-  const Mat3 gcrf_to_cirs = CelestialToIntermediateFrameOfDateMatrix(cip_xy, s);
-  const Mat3 cirs_to_tirs = AxisRotationAroundZ(era);
-  const Mat3 tirs_to_itrf = ROT1(-polar_motion(1)) * ROT2(-polar_motion(0)) *
-                            AxisRotationAroundZ(s_prime);
+  r_itrf = gcrf_to_itrf_ * r_gcrf;
 
-  const Mat3 gcrf_to_tirs = cirs_to_tirs * gcrf_to_cirs;
-  const Mat3 gcrf_to_itrf = tirs_to_itrf * gcrf_to_tirs;
+  // Perform transformation of velocity.
+  // Follows equations from [Vallado2013] Page 220:
+  //   v_itrf = W' * (R' * PN' * v_gcrf - omega x r_tirs)
 
-  r_itrf = gcrf_to_itrf * r_gcrf;
+  const Vec3 r_tirs = itrf_to_tirs_ * r_itrf;
 
-  // Perform transformation of velocity.
-  // Follows equations from [Vallado2013] Page 220.
+  v_itrf = tirs_to_itrf_ * (gcrf_to_tirs_ * v_gcrf - omega.Cross(r_tirs));
+}
 
-  // Convert naming to the one used in [Vallado2013] for simplicity.
-  const Mat3& PN_prime = gcrf_to_cirs;
-  const Mat3& R_prime = cirs_to_tirs;
-  const Mat3& W_prime = tirs_to_itrf;
+void GCRFToITRFTransform::Apply(const std::span<const Vec3> r_gcrf,
+                                const std::span<Vec3> r_itrf) const {
+  assert(r_gcrf.size() == r_itrf.size());
 
-  const Vec3 r_tirs = tirs_to_itrf.Transposed() * r_itrf;
+  const size_t num_vectors = r_gcrf.size();
+  for (size_t i = 0; i < num_vectors; ++i) {
+    r_itrf[i] = Apply(r_gcrf[i]);
+  }
+}
+
+void GCRFToITRFTransform::Apply(const std::span<const Vec3> r_gcrf,
+                                const std::span<const Vec3> v_gcrf,
+                                const std::span<Vec3> r_itrf,
+                                const std::span<Vec3> v_itrf) const {
+  assert(r_gcrf.size() == v_gcrf.size());
+  assert(r_gcrf.size() == r_itrf.size());
+  assert(r_gcrf.size() == v_itrf.size());
+
+  const size_t num_vectors = r_gcrf.size();
+  for (size_t i = 0; i < num_vectors; ++i) {
+    Apply(r_gcrf[i], v_gcrf[i], r_itrf[i], v_itrf[i]);
+  }
+}
 
-  v_itrf = W_prime * (R_prime * PN_prime * v_gcrf - omega.Cross(r_tirs));
+void GCRFToITRF(const Time& time,
+                const Vec3& r_gcrf,
+                const Vec3& v_gcrf,
+                Vec3& r_itrf,
+                Vec3& v_itrf) {
+  GCRFToITRFTransform::At(time).Apply(r_gcrf, v_gcrf, r_itrf, v_itrf);
 }
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -0,0 +1,54 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/coordinate/frame_transform.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/earth/internal/earth_benchmark_data.h"
+#include "astro_core/time/format/date_time.h"
+#include "astro_core/time/time.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Benchmark the conversion function at a different time in every iteration,
+// so that no calculation is shared between iterations.
+template <class F>
+void BenchmarkTransform(benchmark::State& state, F&& transform) {
+  if (!benchmark_data::SetTables()) {
+    state.SkipWithError("Error reading IERS tables");
+    return;
+  }
+
+  const Time start_time(DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC);
+  const Vec3 r(6778137.0, 1000.0, 2000.0);
+  const Vec3 v(10.0, 7000.0, 3000.0);
+
+  int i = 0;
+  for (auto _ : state) {
+    const Time time = start_time + TimeDifference::FromSeconds(i++ % 86400);
+
+    Vec3 r_out, v_out;
+    transform(time, r, v, r_out, v_out);
+
+    DoNotOptimize(r_out);
+    DoNotOptimize(v_out);
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+}  // namespace
+
+BENCHMARK(FrameTransform, TEMEToITRF) { BenchmarkTransform(state, TEMEToITRF); }
+
+BENCHMARK(FrameTransform, ITRFToGCRF) { BenchmarkTransform(state, ITRFToGCRF); }
+
+BENCHMARK(FrameTransform, GCRFToITRF) { BenchmarkTransform(state, GCRFToITRF); }
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -4,9 +4,14 @@
 
 #include "astro_core/coordinate/frame_transform.h"
 
+#include "astro_core/earth/celestial_intermediate_pole.h"
+#include "astro_core/earth/celestial_intermediate_pole_data.h"
+#include "astro_core/earth/celestial_intermediate_pole_table.h"
 #include "astro_core/earth/internal/earth_test_data.h"
 #include "astro_core/time/format/date_time.h"
+#include "astro_core/time/format/julian_date.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
 
@@ -148,6 +153,68 @@ TEST_F(FrameTransformTest, TEMEToITRF) {
                          5.215984905464025267}));
 }
 
+TEST_F(FrameTransformTest, TEMEToITRFTransform) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+  const Vec3 r_teme{4357.092619856639, 4500.439126822302, -2645.108425391841};
+  const Vec3 v_teme{-2.1768117558889037, 5.163121595591936, 5.215977759982141};
+
+  const TEMEToITRFTransform transform = TEMEToITRFTransform::At(time);
+
+  EXPECT_EQ(transform.GetTime(), time);
+
+  Vec3 expected_r_itrf, expected_v_itrf;
+  TEMEToITRF(time, r_teme, v_teme, expected_r_itrf, expected_v_itrf);
+
+  // Single position and velocity.
+  {
+    Vec3 r_itrf, v_itrf;
+    transform.Apply(r_teme, v_teme, r_itrf, v_itrf);
+
+    EXPECT_EQ(r_itrf, expected_r_itrf);
+    EXPECT_EQ(v_itrf, expected_v_itrf);
+
+    EXPECT_EQ(transform.Apply(r_teme), expected_r_itrf);
+
+    EXPECT_THAT(transform.GetMatrix() * r_teme,
+                Pointwise(DoubleNear(1e-12), expected_r_itrf));
+  }
+
+  // Transformation at the time scales.
+  {
+    const TEMEToITRFTransform scales_transform =
+        TEMEToITRFTransform::At(TimeScales(time));
+
+    EXPECT_EQ(scales_transform.GetTime(), time);
+
+    Vec3 r_itrf, v_itrf;
+    scales_transform.Apply(r_teme, v_teme, r_itrf, v_itrf);
+
+    EXPECT_EQ(r_itrf, expected_r_itrf);
+    EXPECT_EQ(v_itrf, expected_v_itrf);
+  }
+
+  // Multiple positions and velocities.
+  {
+    const Vec3 r_teme_array[] = {r_teme, r_teme * 2, -r_teme};
+    const Vec3 v_teme_array[] = {v_teme, v_teme * 2, -v_teme};
+
+    Vec3 r_itrf_array[3], v_itrf_array[3];
+    transform.Apply(r_teme_array, v_teme_array, r_itrf_array, v_itrf_array);
+
+    Vec3 position_only_array[3];
+    transform.Apply(r_teme_array, position_only_array);
+
+    for (int i = 0; i < 3; ++i) {
+      Vec3 r_itrf, v_itrf;
+      TEMEToITRF(time, r_teme_array[i], v_teme_array[i], r_itrf, v_itrf);
+
+      EXPECT_EQ(r_itrf_array[i], r_itrf);
+      EXPECT_EQ(v_itrf_array[i], v_itrf);
+      EXPECT_EQ(position_only_array[i], r_itrf);
+    }
+  }
+}
+
 TEST_F(FrameTransformTest, ITRFToTEME) {
   // The test data is the reverse of the test of TEMEToITRF().
   //
@@ -257,4 +324,110 @@ TEST_F(FrameTransformTest, GCRFToITRF) {
                          5.215984905464025267}));
 }
 
+// The same as the ITRFToGCRF test, but with the tabulated CIP.
+TEST_F(FrameTransformTest, ITRFToGCRFWithCelestialIntermediatePoleTable) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+
+  const Vec3 r_itrf(-2801.428206798944302136,
+                    5602.703300938050233526,
+                    -2645.094088710325195279);
+  const Vec3 v_itrf(
+      -5.184234346857372167, -0.137714270932494498, 5.215984905464025267);
+
+  const JulianDate jd_tt =
+      time.ToScale<TimeScale::kTT>().AsFormat<JulianDate>();
+  GetCelestialIntermediatePoleData().SetTable(
+      CelestialIntermediatePoleTable::Tabulate(jd_tt - 1.0, jd_tt + 1.0));
+
+  Vec3 r_gcrf, v_gcrf;
+  ITRFToGCRF(time, r_itrf, v_itrf, r_gcrf, v_gcrf);
+
+  Vec3 r_itrf_roundtrip, v_itrf_roundtrip;
+  GCRFToITRF(time, r_gcrf, v_gcrf, r_itrf_roundtrip, v_itrf_roundtrip);
+
+  GetCelestialIntermediatePoleData().ClearTable();
+
+  EXPECT_THAT(r_gcrf,
+              Pointwise(DoubleNear(1e-12),
+                        {4374.025673658524283383,
+                         4478.288319286147270759,
+                         -2654.739186783237528289}));
+
+  EXPECT_THAT(
+      v_gcrf,
+      Pointwise(
+          DoubleNear(1e-12),
+          {-2.139329590299860584, 5.174189009638810788, 5.220516738855706329}));
+
+  // The round trip goes through two interpolations of the table, which is a
+  // few ULP of the position in kilometers depending on the optimization of the
+  // build.
+  EXPECT_THAT(r_itrf_roundtrip, Pointwise(DoubleNear(1e-11), r_itrf));
+  EXPECT_THAT(v_itrf_roundtrip, Pointwise(DoubleNear(1e-12), v_itrf));
+}
+
+TEST_F(FrameTransformTest, GCRFToITRFTransform) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+
+  const Vec3 r_gcrf(4374.025673658524283383,
+                    4478.288319286147270759,
+                    -2654.739186783237528289);
+  const Vec3 v_gcrf(
+      -2.139329590299860584, 5.174189009638810788, 5.220516738855706329);
+
+  const GCRFToITRFTransform transform = GCRFToITRFTransform::At(time);
+
+  EXPECT_EQ(transform.GetTime(), time);
+
+  Vec3 expected_r_itrf, expected_v_itrf;
+  GCRFToITRF(time, r_gcrf, v_gcrf, expected_r_itrf, expected_v_itrf);
+
+  // Single position and velocity.
+  {
+    Vec3 r_itrf, v_itrf;
+    transform.Apply(r_gcrf, v_gcrf, r_itrf, v_itrf);
+
+    EXPECT_EQ(r_itrf, expected_r_itrf);
+    EXPECT_EQ(v_itrf, expected_v_itrf);
+
+    EXPECT_EQ(transform.Apply(r_gcrf), expected_r_itrf);
+    EXPECT_EQ(transform.GetMatrix() * r_gcrf, expected_r_itrf);
+  }
+
+  // Transformation at the time scales.
+  {
+    const GCRFToITRFTransform scales_transform =
+        GCRFToITRFTransform::At(TimeScales(time));
+
+    EXPECT_EQ(scales_transform.GetTime(), time);
+
+    Vec3 r_itrf, v_itrf;
+    scales_transform.Apply(r_gcrf, v_gcrf, r_itrf, v_itrf);
+
+    EXPECT_EQ(r_itrf, expected_r_itrf);
+    EXPECT_EQ(v_itrf, expected_v_itrf);
+  }
+
+  // Multiple positions and velocities.
+  {
+    const Vec3 r_gcrf_array[] = {r_gcrf, r_gcrf * 2, -r_gcrf};
+    const Vec3 v_gcrf_array[] = {v_gcrf, v_gcrf * 2, -v_gcrf};
+
+    Vec3 r_itrf_array[3], v_itrf_array[3];
+    transform.Apply(r_gcrf_array, v_gcrf_array, r_itrf_array, v_itrf_array);
+
+    Vec3 position_only_array[3];
+    transform.Apply(r_gcrf_array, position_only_array);
+
+    for (int i = 0; i < 3; ++i) {
+      Vec3 r_itrf, v_itrf;
+      GCRFToITRF(time, r_gcrf_array[i], v_gcrf_array[i], r_itrf, v_itrf);
+
+      EXPECT_EQ(r_itrf_array[i], r_itrf);
+      EXPECT_EQ(v_itrf_array[i], v_itrf);
+      EXPECT_EQ(position_only_array[i], r_itrf);
+    }
+  }
+}
+
 }  // namespace astro_core
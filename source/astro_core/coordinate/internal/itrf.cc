@@ -15,14 +15,22 @@ namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 auto ITRF::FromGCRF(const GCRF& gcrf) -> ITRF {
+  return FromGCRF(gcrf, GCRFToITRFTransform::At(gcrf.observation_time));
+}
+
+auto ITRF::FromTEME(const TEME& teme) -> ITRF {
+  return FromTEME(teme, TEMEToITRFTransform::At(teme.observation_time));
+}
+
+auto ITRF::FromGCRF(const GCRF& gcrf, const GCRFToITRFTransform& transform)
+    -> ITRF {
   Vec3 itrf_position;
   Vec3 itrf_velocity;
 
-  GCRFToITRF(gcrf.observation_time,
-             gcrf.position.GetCartesian(),
-             gcrf.velocity.GetCartesianOr({0, 0, 0}),
-             itrf_position,
-             itrf_velocity);
+  transform.Apply(gcrf.position.GetCartesian(),
+                  gcrf.velocity.GetCartesianOr({0, 0, 0}),
+                  itrf_position,
+                  itrf_velocity);
 
   ITRF itrf;
 
@@ -36,15 +44,15 @@ auto ITRF::FromGCRF(const GCRF& gcrf) -> ITRF {
   return itrf;
 }
 
-auto ITRF::FromTEME(const TEME& teme) -> ITRF {
+auto ITRF::FromTEME(const TEME& teme, const TEMEToITRFTransform& transform)
+    -> ITRF {
   Vec3 itrf_position;
   Vec3 itrf_velocity;
 
-  TEMEToITRF(teme.observation_time,
-             teme.position.GetCartesian(),
-             teme.velocity.GetCartesianOr({0, 0, 0}),
-             itrf_position,
-             itrf_velocity);
+  transform.Apply(teme.position.GetCartesian(),
+                  teme.velocity.GetCartesianOr({0, 0, 0}),
+                  itrf_position,
+                  itrf_velocity);
 
   ITRF itrf;
 
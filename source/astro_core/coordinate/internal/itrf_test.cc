@@ -4,6 +4,7 @@
 
 #include "astro_core/coordinate/itrf.h"
 
+#include "astro_core/coordinate/frame_transform.h"
 #include "astro_core/coordinate/gcrf.h"
 #include "astro_core/coordinate/geodetic.h"
 #include "astro_core/coordinate/teme.h"
@@ -96,6 +97,81 @@ TEST_F(ITRFTest, FromTEME) {
                          5.215984905464025267}));
 }
 
+TEST_F(ITRFTest, FromGCRFWithTransform) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+  const Vec3 r_gcrf(4374.025673658524283383,
+                    4478.288319286147270759,
+                    -2654.739186783237528289);
+  const Vec3 v_gcrf(
+      -2.139329590299860584, 5.174189009638810788, 5.220516738855706329);
+
+  const GCRFToITRFTransform transform = GCRFToITRFTransform::At(time);
+
+  // Position and velocity.
+  {
+    const GCRF gcrf(
+        {.observation_time = time, .position = r_gcrf, .velocity = v_gcrf});
+
+    const ITRF itrf = ITRF::FromGCRF(gcrf, transform);
+    const ITRF expected_itrf = ITRF::FromGCRF(gcrf);
+
+    EXPECT_EQ(itrf.observation_time, gcrf.observation_time);
+    EXPECT_EQ(itrf.position.GetCartesian(),
+              expected_itrf.position.GetCartesian());
+    ASSERT_TRUE(itrf.velocity.HasValue());
+    EXPECT_EQ(itrf.velocity.GetCartesian(),
+              expected_itrf.velocity.GetCartesian());
+  }
+
+  // Position only.
+  {
+    const GCRF gcrf({.observation_time = time, .position = r_gcrf});
+
+    const ITRF itrf = ITRF::FromGCRF(gcrf, transform);
+    const ITRF expected_itrf = ITRF::FromGCRF(gcrf);
+
+    EXPECT_EQ(itrf.position.GetCartesian(),
+              expected_itrf.position.GetCartesian());
+    EXPECT_FALSE(itrf.velocity.HasValue());
+  }
+}
+
+TEST_F(ITRFTest, FromTEMEWithTransform) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+  const Vec3 r_teme{4357.092619856639, 4500.439126822302, -2645.108425391841};
+  const Vec3 v_teme{-2.1768117558889037, 5.163121595591936, 5.215977759982141};
+
+  const TEMEToITRFTransform transform = TEMEToITRFTransform::At(time);
+
+  // Position and velocity.
+  {
+    const TEME teme(
+        {.observation_time = time, .position = r_teme, .velocity = v_teme});
+
+    const ITRF itrf = ITRF::FromTEME(teme, transform);
+    const ITRF expected_itrf = ITRF::FromTEME(teme);
+
+    EXPECT_EQ(itrf.observation_time, teme.observation_time);
+    EXPECT_EQ(itrf.position.GetCartesian(),
+              expected_itrf.position.GetCartesian());
+    ASSERT_TRUE(itrf.velocity.HasValue());
+    EXPECT_EQ(itrf.velocity.GetCartesian(),
+              expected_itrf.velocity.GetCartesian());
+  }
+
+  // Position only.
+  {
+    const TEME teme({.observation_time = time, .position = r_teme});
+
+    const ITRF itrf = ITRF::FromTEME(teme, transform);
+    const ITRF expected_itrf = ITRF::FromTEME(teme);
+
+    EXPECT_EQ(itrf.position.GetCartesian(),
+              expected_itrf.position.GetCartesian());
+    EXPECT_FALSE(itrf.velocity.HasValue());
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Geodetic to geocentric.
 //
@@ -0,0 +1,89 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/coordinate/observer_frame.h"
+
+#include <cassert>
+#include <limits>
+
+#include "astro_core/math/math.h"
+
+// References:
+//
+//   [Vallado2006] Vallado, David A., Paul Crawford, Richard Hujsak, and T.S.
+//       Kelso, "Revisiting Spacetrack Report #3," presented at the AIAA/AAS
+//       Astrodynamics Specialist Conference, Keystone, CO, 2006 August 21–24.
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+ObserverFrame::ObserverFrame(const ITRF& site_itrf)
+    : site_itrf_(site_itrf),
+      geodetic_(Geodetic::FromITRF(site_itrf)),
+      position_(site_itrf.position.GetCartesian()) {
+  const double phi_gd = geodetic_.latitude;
+  const double lambda = geodetic_.longitude;
+
+  ecef_to_sez_ = ROT2(constants::pi / 2 - phi_gd) * ROT3(lambda);
+
+  double sin_latitude, cos_latitude;
+  SinCos(phi_gd, sin_latitude, cos_latitude);
+  double sin_longitude, cos_longitude;
+  SinCos(lambda, sin_longitude, cos_longitude);
+
+  zenith_ = {cos_latitude * cos_longitude,
+             cos_latitude * sin_longitude,
+             sin_latitude};
+}
+
+auto ObserverFrame::ToHorizontal(const ITRF& itrf) const -> Horizontal {
+  // [Vallado2006] ALGORITHM 27: RAZEL
+
+  const Vec3 r_ecef = itrf.position.GetCartesian();
+  const Vec3 v_ecef = itrf.velocity.GetCartesianOr({0, 0, 0});
+
+  const Vec3 rho_ecef = r_ecef - position_;
+  const Vec3 drho_ecef = v_ecef;
+
+  const Vec3 rho_sez = ecef_to_sez_ * rho_ecef;
+  const Vec3 drho_sez = ecef_to_sez_ * drho_ecef;
+
+  const double rho = rho_sez.Norm();
+
+  const double denom = Sqrt(rho_sez(0) * rho_sez(0) + rho_sez(1) * rho_sez(1));
+
+  double elevation, azimuth;
+
+  if (denom < std::numeric_limits<double>::epsilon()) {
+    elevation = Sign(rho_sez(2)) * (constants::pi / 2);
+    azimuth = ArcTan2(drho_sez(1), -drho_sez(0));
+  } else {
+    elevation = ArcSin(rho_sez(2) / rho);
+    azimuth = ArcTan2(rho_sez(1) / denom, -rho_sez(0) / denom);
+  }
+
+  if (azimuth < 0) {
+    azimuth += constants::pi * 2;
+  }
+
+  return Horizontal({
+      .observation_time = itrf.observation_time,
+      .elevation = elevation,
+      .azimuth = azimuth,
+      .distance = rho,
+  });
+}
+
+void ObserverFrame::ToHorizontal(const std::span<const ITRF> itrf,
+                                 const std::span<Horizontal> horizontal) const {
+  assert(itrf.size() == horizontal.size());
+
+  const size_t num_positions = itrf.size();
+  for (size_t i = 0; i < num_positions; ++i) {
+    horizontal[i] = ToHorizontal(itrf[i]);
+  }
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,102 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/coordinate/observer_frame.h"
+
+#include <array>
+
+#include "astro_core/earth/internal/earth_test_data.h"
+#include "astro_core/math/math.h"
+#include "astro_core/time/format/date_time.h"
+#include "astro_core/time/time.h"
+#include "astro_core/unittest/mock.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+using testing::DoubleNear;
+using testing::Pointwise;
+
+class ObserverFrameTest : public testing::Test {
+ protected:
+  void SetUp() override { test_data::SetTables(); }
+};
+
+TEST_F(ObserverFrameTest, Site) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+
+  const ITRF site_itrf{{.observation_time{time},
+                        .position{4067886.640252187382429838,
+                                  571704.183895749156363308,
+                                  4862789.037706432864069939}}};
+
+  const ObserverFrame observer_frame(site_itrf);
+
+  const Geodetic expected_geodetic = Geodetic::FromITRF(site_itrf);
+  EXPECT_EQ(observer_frame.GetGeodetic().latitude, expected_geodetic.latitude);
+  EXPECT_EQ(observer_frame.GetGeodetic().longitude,
+            expected_geodetic.longitude);
+  EXPECT_EQ(observer_frame.GetGeodetic().height, expected_geodetic.height);
+
+  EXPECT_EQ(observer_frame.GetPosition(), site_itrf.position.GetCartesian());
+
+  // The zenith is the Z axis of the SEZ frame.
+  const Vec3 zenith = observer_frame.GetZenith();
+  EXPECT_NEAR(zenith.Norm(), 1, 1e-15);
+  EXPECT_THAT(observer_frame.GetECEFToSEZ() * zenith,
+              Pointwise(DoubleNear(1e-15), Vec3(0, 0, 1)));
+}
+
+TEST_F(ObserverFrameTest, ToHorizontal) {
+  const Time time{DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC};
+
+  const std::array<ITRF, 3> itrf = {
+      ITRF{{.observation_time{time},
+            .position{10366753.696330964565277100,
+                      -40872357.989425994455814362,
+                      -7177.146307127579348162},
+            .velocity{{-0.000000123270733281970,
+                       -0.000000265212595462799,
+                       0.000000614554703409340}}}},
+      ITRF{{.observation_time{time},
+            .position{4467886.640252187382429838,
+                      571704.183895749156363308,
+                      5262789.037706432864069939}}},
+      ITRF{{.observation_time{time},
+            .position{-4680888.602721117436885834,
+                      2805218.446534293703734875,
+                      -3292788.080450601410120726}}},
+  };
+
+  const ITRF site_itrf{{.observation_time{time},
+                        .position{4067886.640252187382429838,
+                                  571704.183895749156363308,
+                                  4862789.037706432864069939}}};
+
+  const ObserverFrame observer_frame(site_itrf);
+
+  std::array<Horizontal, 3> horizontal;
+  observer_frame.ToHorizontal(itrf, horizontal);
+
+  for (int i = 0; i < itrf.size(); ++i) {
+    const Horizontal expected_horizontal =
+        Horizontal::FromITRF(itrf[i], site_itrf);
+
+    const Horizontal single_horizontal = observer_frame.ToHorizontal(itrf[i]);
+    EXPECT_EQ(single_horizontal.elevation, expected_horizontal.elevation);
+    EXPECT_EQ(single_horizontal.azimuth, expected_horizontal.azimuth);
+    EXPECT_EQ(single_horizontal.distance, expected_horizontal.distance);
+    EXPECT_EQ(single_horizontal.observation_time, time);
+
+    EXPECT_EQ(horizontal[i].elevation, expected_horizontal.elevation);
+    EXPECT_EQ(horizontal[i].azimuth, expected_horizontal.azimuth);
+    EXPECT_EQ(horizontal[i].distance, expected_horizontal.distance);
+    EXPECT_EQ(horizontal[i].observation_time, time);
+  }
+
+  // The second object is above the site.
+  EXPECT_GT(horizontal[1].elevation, DegreesToRadians(45.0));
+}
+
+}  // namespace astro_core
@@ -28,7 +28,9 @@ namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class GCRF;
+class GCRFToITRFTransform;
 class TEME;
+class TEMEToITRFTransform;
 class Geodetic;
 
 class ITRF : public PositionVelocityFrame<Cartesian, CartesianDifferential> {
@@ -39,6 +41,17 @@ class ITRF : public PositionVelocityFrame<Cartesian, CartesianDifferential> {
 
   static auto FromGCRF(const GCRF& gcrf) -> ITRF;
   static auto FromTEME(const TEME& teme) -> ITRF;
+
+  // Conversion using pre-calculated transformation.
+  //
+  // The transformation is expected to be calculated at the observation time of
+  // the input coordinate. This allows to re-use the transformation for many
+  // coordinates observed at the same time.
+  static auto FromGCRF(const GCRF& gcrf, const GCRFToITRFTransform& transform)
+      -> ITRF;
+  static auto FromTEME(const TEME& teme, const TEMEToITRFTransform& transform)
+      -> ITRF;
+
   static auto FromGeodetic(const Geodetic& geodetic) -> ITRF;
 };
 
@@ -0,0 +1,75 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Local topocentric frame of an observer at a fixed site on the Earth.
+//
+// The frame pre-calculates the geodetic coordinate of the site and the rotation
+// from ITRF (ECEF) to the site's South-East-Zenith (SEZ) frame. This allows to
+// convert many positions to the Horizontal coordinate of the observer without
+// solving for the geodetic coordinate of the site for every position.
+//
+// The site is considered stationary in ITRF.
+
+#pragma once
+
+#include <span>
+
+#include "astro_core/coordinate/geodetic.h"
+#include "astro_core/coordinate/horizontal.h"
+#include "astro_core/coordinate/itrf.h"
+#include "astro_core/numeric/numeric.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class ObserverFrame {
+ public:
+  // Construct frame of an observer at the origin of ITRF.
+  // The geodetic coordinate and the rotation are all zeros, so such frame is
+  // not usable for conversion.
+  ObserverFrame() = default;
+
+  // Construct frame of an observer at the given site.
+  //
+  // The conversion is implicit, allowing to use the frame where the site
+  // position used to be specified as ITRF.
+  ObserverFrame(const ITRF& site_itrf);  // NOLINT(google-explicit-constructor)
+
+  // Position of the site.
+  auto GetSiteITRF() const -> const ITRF& { return site_itrf_; }
+
+  // Geodetic coordinate of the site.
+  auto GetGeodetic() const -> const Geodetic& { return geodetic_; }
+
+  // Cartesian position of the site in ITRF, in meters.
+  auto GetPosition() const -> const Vec3& { return position_; }
+
+  // Rotation from ITRF to the site's South-East-Zenith frame.
+  auto GetECEFToSEZ() const -> const Mat3& { return ecef_to_sez_; }
+
+  // Unit vector of the local vertical of the site, in ITRF.
+  auto GetZenith() const -> const Vec3& { return zenith_; }
+
+  // Convert position of an object to the Horizontal coordinate as seen from
+  // the site.
+  //
+  // Gives the same result as the Horizontal::FromITRF() with the site ITRF.
+  auto ToHorizontal(const ITRF& itrf) const -> Horizontal;
+
+  // Convert positions of multiple objects to the Horizontal coordinates.
+  // The input and output spans are expected to be of the same size.
+  void ToHorizontal(std::span<const ITRF> itrf,
+                    std::span<Horizontal> horizontal) const;
+
+ private:
+  ITRF site_itrf_;
+  Geodetic geodetic_;
+  Vec3 position_{0, 0, 0};
+  Mat3 ecef_to_sez_{};
+  Vec3 zenith_{0, 0, 0};
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
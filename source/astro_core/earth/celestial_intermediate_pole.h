@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "astro_core/earth/nutation_precision.h"
 #include "astro_core/numeric/numeric.h"
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/version/version.h"
@@ -11,11 +12,22 @@
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
+class CelestialIntermediatePoleData;
+class NutationEpoch;
+
 // Calculate X, Y coordinates of celestial intermediate pole from series based
 // on IAU 2006 precession and IAU 2000A nutation.
 //
 // This is an equivalent of ERFA's eraXy06().
 auto CelestialIntermediatePole(const JulianDate& jd_tt) -> Vec2;
+auto CelestialIntermediatePole(const NutationEpoch& epoch) -> Vec2;
+
+// Calculate X, Y coordinates of celestial intermediate pole using the
+// precession-nutation model of the given precision.
+auto CelestialIntermediatePole(const JulianDate& jd_tt,
+                               const NutationPrecision& precision) -> Vec2;
+auto CelestialIntermediatePole(const NutationEpoch& epoch,
+                               const NutationPrecision& precision) -> Vec2;
 
 // Calculate the CIO locator s, positioning the Celestial Intermediate Origin on
 // the equator of the Celestial Intermediate Pole, given the CIP's X,Y
@@ -32,6 +44,39 @@ auto CelestialIntermediatePole(const JulianDate& jd_tt) -> Vec2;
 // This is an equivalent of ERFA's eraS06().
 auto CelestialIntermediateOriginLocator(const JulianDate& jd_tt,
                                         const Vec2& cip_xy) -> double;
+auto CelestialIntermediateOriginLocator(const NutationEpoch& epoch,
+                                        const Vec2& cip_xy) -> double;
+
+// Calculate the CIO locator s with its series truncated according to the given
+// precision.
+auto CelestialIntermediateOriginLocator(const JulianDate& jd_tt,
+                                        const Vec2& cip_xy,
+                                        const NutationPrecision& precision)
+    -> double;
+auto CelestialIntermediateOriginLocator(const NutationEpoch& epoch,
+                                        const Vec2& cip_xy,
+                                        const NutationPrecision& precision)
+    -> double;
+
+// Get global data which holds the tabulated X, Y coordinates of the CIP and the
+// CIO locator s. The data is empty by default, and it is used by the
+// LookupCelestialIntermediatePole() when a table is provided to it.
+auto GetCelestialIntermediatePoleData() -> CelestialIntermediatePoleData&;
+
+// Calculate X, Y coordinates of the CIP and the CIO locator s in radians at the
+// given time point in Terrestrial Time scale in Julian date format.
+//
+// If the global data obtained via GetCelestialIntermediatePoleData() has a
+// table which covers the time point the values are interpolated from the table.
+// Otherwise the result is the same as
+//
+//   const Vec2 cip_xy = CelestialIntermediatePole(jd_tt);
+//   const double s = CelestialIntermediateOriginLocator(jd_tt, cip_xy);
+//
+// but with less internal calculations.
+void LookupCelestialIntermediatePole(const JulianDate& jd_tt,
+                                     Vec2& cip_xy,
+                                     double& s);
 
 // Form the celestial to intermediate-frame-of-date matrix given the CIP X,Y and
 // the CIO locator s.
@@ -52,6 +97,15 @@ auto CelestialToIntermediateFrameOfDateMatrix(const Vec2& cip_xy,
 //
 // but with less internal calculations.
 auto CelestialToIntermediateFrameOfDateMatrix(const JulianDate& jd_tt) -> Mat3;
+auto CelestialToIntermediateFrameOfDateMatrix(const NutationEpoch& epoch)
+    -> Mat3;
+
+// Form the celestial to intermediate-frame-of-date matrix at the given time
+// point using the precession-nutation model of the given precision.
+auto CelestialToIntermediateFrameOfDateMatrix(
+    const JulianDate& jd_tt, const NutationPrecision& precision) -> Mat3;
+auto CelestialToIntermediateFrameOfDateMatrix(
+    const NutationEpoch& epoch, const NutationPrecision& precision) -> Mat3;
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -0,0 +1,51 @@
+// Copyright (c) 2023 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Processed data which provides access to the tabulated celestial intermediate
+// pole and CIO locator in a thread-safe manner.
+
+#pragma once
+
+#include "astro_core/numeric/numeric.h"
+#include "astro_core/table/shared_table.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class JulianDate;
+class CelestialIntermediatePoleTable;
+
+class CelestialIntermediatePoleData {
+ public:
+  using Table = CelestialIntermediatePoleTable;
+
+  CelestialIntermediatePoleData();
+  CelestialIntermediatePoleData(CelestialIntermediatePoleData&& other) noexcept;
+  ~CelestialIntermediatePoleData();
+
+  auto operator=(CelestialIntermediatePoleData&& other) noexcept
+      -> CelestialIntermediatePoleData&;
+
+  // Set table which provides the tabulated values.
+  // The current data is fully replaced with the new one.
+  void SetTable(Table&& table);
+
+  // Remove the tabulated values, so that no time is covered by the data.
+  void ClearTable();
+
+  // Lookup the X, Y coordinates of the CIP and the CIO locator s in radians at
+  // the given time point in Terrestrial Time scale in Julian date format.
+  //
+  // Returns false if the table has not been provided or it does not cover the
+  // time point, in which case the output values are not modified.
+  auto Lookup(const JulianDate& jd_tt, Vec2& cip_xy, double& s) const -> bool;
+
+ private:
+  using SharedTable = astro_core::SharedTable<Table>;
+  SharedTable shared_table_;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,93 @@
+// Copyright (c) 2023 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Tabulated X, Y coordinates of the celestial intermediate pole (CIP) and the
+// CIO locator s.
+//
+// Calculating the CIP and the CIO locator from the IAU 2006/2000A series
+// involves evaluation of thousands of periodic terms. The quantities change
+// smoothly over hours, so for a known range of dates they can be tabulated once
+// and interpolated afterwards at a fraction of the cost.
+//
+// The time range of the table is split into segments of equal duration, and
+// every quantity is approximated within a segment by a Chebyshev polynomial
+// which interpolates the series at the Chebyshev nodes of the segment.
+//
+// With the default options the difference between the interpolated values and
+// the series is below 1e-15 radians (0.2 microarcseconds) for X, Y and s. This
+// corresponds to a difference below 0.1 micrometer in the position of an object
+// at the geostationary orbit, which is negligible compared to the accuracy of
+// the IAU 2006/2000A model itself.
+//
+// The lookup access to the table is thread safe.
+
+#pragma once
+
+#include <vector>
+
+#include "astro_core/numeric/numeric.h"
+#include "astro_core/time/format/julian_date.h"
+#include "astro_core/time/time_difference.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+struct CelestialIntermediatePoleTableOptions {
+  // Duration of a segment approximated by a single Chebyshev polynomial.
+  TimeDifference segment_duration{TimeDifference::FromDays(2)};
+
+  // Number of coefficients of the Chebyshev polynomial of every segment.
+  // The series is evaluated this many times per segment.
+  int num_coefficients{10};
+};
+
+class CelestialIntermediatePoleTable {
+ public:
+  using Options = CelestialIntermediatePoleTableOptions;
+
+  // Create an empty table which does not cover any time.
+  CelestialIntermediatePoleTable() = default;
+
+  // Tabulate the CIP and the CIO locator for the time range between the start
+  // and end time points given in Julian date format and Terrestrial Time scale.
+  //
+  // The table covers the entire time range, possibly extending past its end to
+  // the end of the last segment.
+  static auto Tabulate(const JulianDate& start_jd_tt,
+                       const JulianDate& end_jd_tt,
+                       const Options& options = {})
+      -> CelestialIntermediatePoleTable;
+
+  // Check whether the table has no tabulated values.
+  auto IsEmpty() const -> bool { return num_segments_ == 0; }
+
+  // Check whether the table covers the given time point.
+  auto Covers(const JulianDate& jd_tt) const -> bool;
+
+  // Lookup the X, Y coordinates of the CIP and the CIO locator s in radians at
+  // the given time point in Terrestrial Time scale in Julian date format.
+  //
+  // Returns false if the table does not cover the time point, in which case
+  // the output values are not modified.
+  auto Lookup(const JulianDate& jd_tt, Vec2& cip_xy, double& s) const -> bool;
+
+ private:
+  // Number of tabulated quantities: X, Y, and s.
+  static constexpr int kNumQuantities = 3;
+
+  JulianDate start_jd_tt_{0};
+  double segment_duration_in_days_{0};
+  int num_coefficients_{0};
+  int num_segments_{0};
+
+  // Chebyshev coefficients of all segments.
+  //
+  // Stored as [segment][quantity][coefficient], with the coefficients of a
+  // segment stored contiguously.
+  std::vector<double> coefficients_;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "astro_core/earth/nutation_precision.h"
 #include "astro_core/numeric/numeric.h"
 #include "astro_core/version/version.h"
 
@@ -14,6 +15,7 @@ namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class JulianDate;
+class NutationEpoch;
 
 // Construct a precession-nutation rotation matrix (including the frame bias)
 // for the given time point. Uses IAU 2006 precession and IAU 2000A nutation
@@ -25,6 +27,16 @@ class JulianDate;
 // NOTE: ERFA uses slightly different parameterization, so the result is not
 // exactly the same.
 auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt) -> Mat3;
+auto BiasPrecessionNutationRotation06A(const NutationEpoch& epoch) -> Mat3;
+
+// Construct a precession-nutation rotation matrix (including the frame bias)
+// using the nutation model of the given precision.
+auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt,
+                                       const NutationPrecision& precision)
+    -> Mat3;
+auto BiasPrecessionNutationRotation06A(const NutationEpoch& epoch,
+                                       const NutationPrecision& precision)
+    -> Mat3;
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
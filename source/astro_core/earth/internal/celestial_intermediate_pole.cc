@@ -11,10 +11,12 @@
 #include "astro_core/earth/internal/iers/tab5.2a.h"
 #include "astro_core/earth/internal/iers/tab5.2b.h"
 #include "astro_core/earth/internal/iers/tab5.2d.h"
-#include "astro_core/earth/internal/nutation_arguments.h"
+#include "astro_core/earth/internal/nutation_series.h"
+#include "astro_core/earth/intermediate_rotation.h"
+#include "astro_core/earth/nutation_epoch.h"
+
+#include "astro_core/earth/celestial_intermediate_pole_data.h"
 
-#include "astro_core/base/constants.h"
-#include "astro_core/base/reverse_view.h"
 #include "astro_core/math/math.h"
 #include "astro_core/numeric/polynomial.h"
 
@@ -26,6 +28,36 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 namespace {
 
+using nutation_series_internal::EvaluateSeries;
+using nutation_series_internal::GetMaxArgumentMultiplier;
+using nutation_series_internal::GetSeriesAmplitudeCutoff;
+using nutation_series_internal::MakeSeriesColumns;
+
+static_assert(GetMaxArgumentMultiplier<iers::table::Table52aRow>(
+                  iers::table::Table52aFlat) <=
+              NutationArgumentMultiples::kMaxMultiplier);
+static_assert(GetMaxArgumentMultiplier<iers::table::Table52bRow>(
+                  iers::table::Table52bFlat) <=
+              NutationArgumentMultiples::kMaxMultiplier);
+static_assert(GetMaxArgumentMultiplier<iers::table::Table52dRow>(
+                  iers::table::Table52dFlat) <=
+              NutationArgumentMultiples::kMaxMultiplier);
+
+constexpr auto kTable52aColumns =
+    MakeSeriesColumns<iers::table::Table52a,
+                      &iers::table::Table52aRow::a_s_j_i,
+                      &iers::table::Table52aRow::a_c_j_i>();
+
+constexpr auto kTable52bColumns =
+    MakeSeriesColumns<iers::table::Table52b,
+                      &iers::table::Table52bRow::b_s_j_i,
+                      &iers::table::Table52bRow::b_c_j_i>();
+
+constexpr auto kTable52dColumns =
+    MakeSeriesColumns<iers::table::Table52d,
+                      &iers::table::Table52dRow::c_s_j_i,
+                      &iers::table::Table52dRow::c_c_j_i>();
+
 // Calculate polynomial part of the coordinates.
 // The result in arcseconds.
 //
@@ -40,57 +72,11 @@ auto CIPPolynomialPart(const double t) -> Vec2 {
                                     Vec2(0.0000059285, 0.0000001358)));
 }
 
-// Calculate argument for the given row of CIP coordinate non-polynomial part.
-// It is referred to as ARGUMENT in [IERS2010] Page 54, Eq. (5.16).
-template <class Row>
-auto CalculateArgument(
-    const Row& row,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  double arg = 0;
-
-  // Lunisolar nutation arguments.
-  arg += row.l * lunisolar_nutation_arguments.l;
-  arg += row.l_prime * lunisolar_nutation_arguments.l_prime;
-  arg += row.F * lunisolar_nutation_arguments.F;
-  arg += row.D * lunisolar_nutation_arguments.D;
-  arg += row.Om * lunisolar_nutation_arguments.Om;
-
-  // Planetary nutation arguments.
-  arg += row.L_Me * planetary_nutation_arguments.L_Me;
-  arg += row.L_Ve * planetary_nutation_arguments.L_Ve;
-  arg += row.L_E * planetary_nutation_arguments.L_E;
-  arg += row.L_Ma * planetary_nutation_arguments.L_Ma;
-  arg += row.L_J * planetary_nutation_arguments.L_J;
-  arg += row.L_Sa * planetary_nutation_arguments.L_Sa;
-  arg += row.L_U * planetary_nutation_arguments.L_U;
-  arg += row.L_Ne * planetary_nutation_arguments.L_Ne;
-  arg += row.p_A * planetary_nutation_arguments.p_A;
-
-  return arg;
-}
-
 // Calculate periodic nutation series for the X coordinate.
 // [IERS2010] Page 54, Eq. (5.16).
-auto CIPPeriodicNutationTermsForX(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  using iers::table::Table52a;
-  using iers::table::Table52aRow;
-
-  double x = 0;
-
-  for (int j = Table52a.size() - 1; j >= 0; --j) {
-    const double tn = Pow(t, j);
-    // Reverse order to handle small values first.
-    for (const Table52aRow& row : reverse_view(Table52a[j])) {
-      const double argument = CalculateArgument(
-          row, lunisolar_nutation_arguments, planetary_nutation_arguments);
-
-      x += (row.a_s_j_i * Sin(argument) + row.a_c_j_i * Cos(argument)) * tn;
-    }
-  }
+auto CIPPeriodicNutationTermsForX(const NutationEpoch& epoch,
+                                  const double amplitude_cutoff) -> double {
+  const double x = EvaluateSeries(kTable52aColumns, epoch, amplitude_cutoff);
 
   // The table rows are in microarcseconds, convert it to radians.
   return ArcsecToRadians(x / 1000000.0);
@@ -98,58 +84,50 @@ auto CIPPeriodicNutationTermsForX(
 
 // Calculate periodic nutation series for the Y coordinate.
 // [IERS2010] Page 54, Eq. (5.16).
-auto CIPPeriodicNutationTermsForY(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  using iers::table::Table52b;
-  using iers::table::Table52bRow;
-
-  double y = 0;
-
-  for (int j = Table52b.size() - 1; j >= 0; --j) {
-    const double tn = Pow(t, j);
-    // Reverse order to handle small values first.
-    for (const Table52bRow& row : reverse_view(Table52b[j])) {
-      const double argument = CalculateArgument(
-          row, lunisolar_nutation_arguments, planetary_nutation_arguments);
-
-      y += (row.b_c_j_i * Cos(argument) + row.b_s_j_i * Sin(argument)) * tn;
-    }
-  }
+auto CIPPeriodicNutationTermsForY(const NutationEpoch& epoch,
+                                  const double amplitude_cutoff) -> double {
+  const double y = EvaluateSeries(kTable52bColumns, epoch, amplitude_cutoff);
 
   // The table rows are in microarcseconds, convert it to radians.s
   return ArcsecToRadians(y / 1000000.0);
 }
 
-auto CelestialIntermediatePole(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> Vec2 {
-  Vec2 xy = CIPPolynomialPart(t);
+}  // namespace
+
+auto CelestialIntermediatePole(const NutationEpoch& epoch,
+                               const NutationPrecision& precision) -> Vec2 {
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    // The CIP is the third row of the bias-precession-nutation matrix.
+    // This is what ERFA's eraBpn2xy() does.
+    const Mat3 rbpn = BiasPrecessionNutationRotation06A(epoch, precision);
+    return Vec2(rbpn(2, 0), rbpn(2, 1));
+  }
+
+  const double amplitude_cutoff = GetSeriesAmplitudeCutoff(precision);
+
+  Vec2 xy = CIPPolynomialPart(epoch.GetT());
 
-  xy(0) += CIPPeriodicNutationTermsForX(
-      t, lunisolar_nutation_arguments, planetary_nutation_arguments);
-  xy(1) += CIPPeriodicNutationTermsForY(
-      t, lunisolar_nutation_arguments, planetary_nutation_arguments);
+  xy(0) += CIPPeriodicNutationTermsForX(epoch, amplitude_cutoff);
+  xy(1) += CIPPeriodicNutationTermsForY(epoch, amplitude_cutoff);
 
   return xy;
 }
 
-}  // namespace
-
-auto CelestialIntermediatePole(const JulianDate& jd_tt) -> Vec2 {
-  // [IERS2010] Page 45, Eq. (5.2).
-  const double t = double((jd_tt - constants::kJulianDateEpochJ2000) /
-                          constants::kNumDaysInJulianCentury);
+auto CelestialIntermediatePole(const JulianDate& jd_tt,
+                               const NutationPrecision& precision) -> Vec2 {
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    const Mat3 rbpn = BiasPrecessionNutationRotation06A(jd_tt, precision);
+    return Vec2(rbpn(2, 0), rbpn(2, 1));
+  }
+  return CelestialIntermediatePole(NutationEpoch(jd_tt), precision);
+}
 
-  const LunisolarNutationArguments lunisolar_nutation_arguments =
-      CalculateLunisolarNutationArguments(t);
-  const PlanetaryNutationArguments planetary_nutation_arguments =
-      CalculatePlanetaryNutationArguments(t);
+auto CelestialIntermediatePole(const NutationEpoch& epoch) -> Vec2 {
+  return CelestialIntermediatePole(epoch, NutationPrecision());
+}
 
-  return CelestialIntermediatePole(
-      t, lunisolar_nutation_arguments, planetary_nutation_arguments);
+auto CelestialIntermediatePole(const JulianDate& jd_tt) -> Vec2 {
+  return CelestialIntermediatePole(NutationEpoch(jd_tt));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,60 +152,69 @@ auto CIOPolynomialPart(const double t) -> double {
 
 // Calculate periodic nutation series for the CIO locator s.
 // [IERS2010] Page 59, Table 5.2d.
-auto CIOPeriodicNutationTerms(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  using iers::table::Table52d;
-  using iers::table::Table52dRow;
-
-  double x = 0;
-
-  for (int j = Table52d.size() - 1; j >= 0; --j) {
-    const double tn = Pow(t, j);
-    // Reverse order to handle small values first.
-    for (const Table52dRow& row : reverse_view(Table52d[j])) {
-      const double argument = CalculateArgument(
-          row, lunisolar_nutation_arguments, planetary_nutation_arguments);
-
-      x += (row.c_s_j_i * Sin(argument) + row.c_c_j_i * Cos(argument)) * tn;
-    }
-  }
+auto CIOPeriodicNutationTerms(const NutationEpoch& epoch,
+                              const double amplitude_cutoff) -> double {
+  const double x = EvaluateSeries(kTable52dColumns, epoch, amplitude_cutoff);
 
   // The table roes are in microarcseconds, convert it to radians.s
   return ArcsecToRadians(x / 1000000.0);
 }
 
-auto CelestialIntermediateOriginLocator(
-    const double t,
-    const Vec2& cip_xy,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  double s = CIOPolynomialPart(t);
+}  // namespace
 
-  s += CIOPeriodicNutationTerms(
-      t, lunisolar_nutation_arguments, planetary_nutation_arguments);
+auto CelestialIntermediateOriginLocator(const NutationEpoch& epoch,
+                                        const Vec2& cip_xy,
+                                        const NutationPrecision& precision)
+    -> double {
+  double s = CIOPolynomialPart(epoch.GetT());
+
+  s += CIOPeriodicNutationTerms(epoch, GetSeriesAmplitudeCutoff(precision));
 
   s -= cip_xy(0) * cip_xy(1) / 2;
 
   return s;
 }
 
-}  // namespace
+auto CelestialIntermediateOriginLocator(const JulianDate& jd_tt,
+                                        const Vec2& cip_xy,
+                                        const NutationPrecision& precision)
+    -> double {
+  return CelestialIntermediateOriginLocator(
+      NutationEpoch(jd_tt), cip_xy, precision);
+}
+
+auto CelestialIntermediateOriginLocator(const NutationEpoch& epoch,
+                                        const Vec2& cip_xy) -> double {
+  return CelestialIntermediateOriginLocator(
+      epoch, cip_xy, NutationPrecision());
+}
 
 auto CelestialIntermediateOriginLocator(const JulianDate& jd_tt,
                                         const Vec2& cip_xy) -> double {
-  // [IERS2010] Page 45, Eq. (5.2).
-  const double t = double((jd_tt - constants::kJulianDateEpochJ2000) /
-                          constants::kNumDaysInJulianCentury);
+  return CelestialIntermediateOriginLocator(NutationEpoch(jd_tt), cip_xy);
+}
 
-  const LunisolarNutationArguments lunisolar_nutation_arguments =
-      CalculateLunisolarNutationArguments(t);
-  const PlanetaryNutationArguments planetary_nutation_arguments =
-      CalculatePlanetaryNutationArguments(t);
+////////////////////////////////////////////////////////////////////////////////
+// Tabulated CIP and CIO locator.
 
-  return CelestialIntermediateOriginLocator(
-      t, cip_xy, lunisolar_nutation_arguments, planetary_nutation_arguments);
+auto GetCelestialIntermediatePoleData() -> CelestialIntermediatePoleData& {
+  static CelestialIntermediatePoleData celestial_intermediate_pole_data;
+  return celestial_intermediate_pole_data;
+}
+
+void LookupCelestialIntermediatePole(const JulianDate& jd_tt,
+                                     Vec2& cip_xy,
+                                     double& s) {
+  const CelestialIntermediatePoleData& celestial_intermediate_pole_data =
+      GetCelestialIntermediatePoleData();
+  if (celestial_intermediate_pole_data.Lookup(jd_tt, cip_xy, s)) {
+    return;
+  }
+
+  const NutationEpoch epoch(jd_tt);
+
+  cip_xy = CelestialIntermediatePole(epoch);
+  s = CelestialIntermediateOriginLocator(epoch, cip_xy);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -249,23 +236,28 @@ auto CelestialToIntermediateFrameOfDateMatrix(const Vec2& cip_xy,
   return ROT3(-(E + s)) * ROT2(d) * ROT3(E) * Mat3::Identity();
 }
 
-auto CelestialToIntermediateFrameOfDateMatrix(const JulianDate& jd_tt) -> Mat3 {
-  // [IERS2010] Page 45, Eq. (5.2).
-  const double t = double((jd_tt - constants::kJulianDateEpochJ2000) /
-                          constants::kNumDaysInJulianCentury);
+auto CelestialToIntermediateFrameOfDateMatrix(
+    const NutationEpoch& epoch, const NutationPrecision& precision) -> Mat3 {
+  const Vec2 cip_xy = CelestialIntermediatePole(epoch, precision);
+  const double s =
+      CelestialIntermediateOriginLocator(epoch, cip_xy, precision);
 
-  const LunisolarNutationArguments lunisolar_nutation_arguments =
-      CalculateLunisolarNutationArguments(t);
-  const PlanetaryNutationArguments planetary_nutation_arguments =
-      CalculatePlanetaryNutationArguments(t);
+  return CelestialToIntermediateFrameOfDateMatrix(cip_xy, s);
+}
 
-  const Vec2 cip_xy = CelestialIntermediatePole(
-      t, lunisolar_nutation_arguments, planetary_nutation_arguments);
+auto CelestialToIntermediateFrameOfDateMatrix(
+    const JulianDate& jd_tt, const NutationPrecision& precision) -> Mat3 {
+  return CelestialToIntermediateFrameOfDateMatrix(NutationEpoch(jd_tt),
+                                                  precision);
+}
 
-  const double s = CelestialIntermediateOriginLocator(
-      t, cip_xy, lunisolar_nutation_arguments, planetary_nutation_arguments);
+auto CelestialToIntermediateFrameOfDateMatrix(const NutationEpoch& epoch)
+    -> Mat3 {
+  return CelestialToIntermediateFrameOfDateMatrix(epoch, NutationPrecision());
+}
 
-  return CelestialToIntermediateFrameOfDateMatrix(cip_xy, s);
+auto CelestialToIntermediateFrameOfDateMatrix(const JulianDate& jd_tt) -> Mat3 {
+  return CelestialToIntermediateFrameOfDateMatrix(NutationEpoch(jd_tt));
 }
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
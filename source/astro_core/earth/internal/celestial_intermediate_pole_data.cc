@@ -0,0 +1,41 @@
+// Copyright (c) 2023 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/celestial_intermediate_pole_data.h"
+
+#include "astro_core/earth/celestial_intermediate_pole_table.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+// Hide the implementation, so that it is possible to only have forward
+// declaration of Table in the header.
+CelestialIntermediatePoleData::CelestialIntermediatePoleData() = default;
+CelestialIntermediatePoleData::CelestialIntermediatePoleData(
+    CelestialIntermediatePoleData&& other) noexcept = default;
+CelestialIntermediatePoleData::~CelestialIntermediatePoleData() = default;
+
+auto CelestialIntermediatePoleData::operator=(
+    CelestialIntermediatePoleData&& other) noexcept
+    -> CelestialIntermediatePoleData& = default;
+
+void CelestialIntermediatePoleData::SetTable(Table&& table) {
+  shared_table_.Set(std::move(table));
+}
+
+void CelestialIntermediatePoleData::ClearTable() { shared_table_.Set(Table()); }
+
+auto CelestialIntermediatePoleData::Lookup(const JulianDate& jd_tt,
+                                           Vec2& cip_xy,
+                                           double& s) const -> bool {
+  const SharedTable::LocalTable local_table = shared_table_.Load();
+  if (!local_table) {
+    return false;
+  }
+
+  return local_table->Lookup(jd_tt, cip_xy, s);
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
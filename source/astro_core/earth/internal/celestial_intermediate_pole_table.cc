@@ -0,0 +1,159 @@
+// Copyright (c) 2023 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// References:
+//
+//   [NR2007] William H. Press, Saul A. Teukolsky, William T. Vetterling, and
+//       Brian P. Flannery. 2007. Numerical Recipes 3rd Edition: The Art of
+//       Scientific Computing. Section 5.8, Chebyshev Approximation.
+
+#include "astro_core/earth/celestial_intermediate_pole_table.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+#include "astro_core/base/constants.h"
+#include "astro_core/earth/celestial_intermediate_pole.h"
+#include "astro_core/earth/nutation_epoch.h"
+#include "astro_core/math/math.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+// Evaluate the Chebyshev series with the given coefficients at the given
+// argument within [-1, 1] using the Clenshaw recurrence.
+//
+// The first coefficient is halved, following the [NR2007] Eq. (5.8.8).
+auto EvaluateChebyshev(const double* coefficients,
+                       const int num_coefficients,
+                       const double x) -> double {
+  const double two_x = 2 * x;
+
+  double b1 = 0;
+  double b2 = 0;
+  for (int j = num_coefficients - 1; j >= 1; --j) {
+    const double b = two_x * b1 - b2 + coefficients[j];
+    b2 = b1;
+    b1 = b;
+  }
+
+  return x * b1 - b2 + coefficients[0] / 2;
+}
+
+}  // namespace
+
+auto CelestialIntermediatePoleTable::Tabulate(const JulianDate& start_jd_tt,
+                                              const JulianDate& end_jd_tt,
+                                              const Options& options)
+    -> CelestialIntermediatePoleTable {
+  const double segment_duration = double(options.segment_duration.InDays());
+  const int num_coefficients = options.num_coefficients;
+
+  assert(segment_duration > 0);
+  assert(num_coefficients > 0);
+
+  CelestialIntermediatePoleTable table;
+
+  const double duration = double(end_jd_tt - start_jd_tt);
+  if (duration < 0) {
+    return table;
+  }
+
+  table.start_jd_tt_ = start_jd_tt;
+  table.segment_duration_in_days_ = segment_duration;
+  table.num_coefficients_ = num_coefficients;
+  table.num_segments_ = std::max(int(Ceil(duration / segment_duration)), 1);
+  table.coefficients_.resize(size_t(table.num_segments_) * kNumQuantities *
+                             num_coefficients);
+
+  // Values of the quantities at the Chebyshev nodes of a segment.
+  std::vector<std::array<double, kNumQuantities>> node_values(
+      num_coefficients);
+
+  for (int segment = 0; segment < table.num_segments_; ++segment) {
+    const double segment_start = segment * segment_duration;
+
+    for (int k = 0; k < num_coefficients; ++k) {
+      // [NR2007] Eq. (5.8.4).
+      const double x = Cos(constants::pi * (k + 0.5) / num_coefficients);
+      const JulianDate jd_tt =
+          start_jd_tt + (segment_start + (x + 1) / 2 * segment_duration);
+
+      const NutationEpoch epoch(jd_tt);
+      const Vec2 cip_xy = CelestialIntermediatePole(epoch);
+      const double s = CelestialIntermediateOriginLocator(epoch, cip_xy);
+
+      node_values[k] = {cip_xy(0), cip_xy(1), s};
+    }
+
+    double* segment_coefficients =
+        table.coefficients_.data() +
+        size_t(segment) * kNumQuantities * num_coefficients;
+
+    // [NR2007] Eq. (5.8.7).
+    for (int quantity = 0; quantity < kNumQuantities; ++quantity) {
+      double* quantity_coefficients =
+          segment_coefficients + quantity * num_coefficients;
+
+      for (int j = 0; j < num_coefficients; ++j) {
+        double sum = 0;
+        for (int k = 0; k < num_coefficients; ++k) {
+          sum += node_values[k][quantity] *
+                 Cos(constants::pi * j * (k + 0.5) / num_coefficients);
+        }
+        quantity_coefficients[j] = 2.0 * sum / num_coefficients;
+      }
+    }
+  }
+
+  return table;
+}
+
+auto CelestialIntermediatePoleTable::Covers(const JulianDate& jd_tt) const
+    -> bool {
+  if (num_segments_ == 0) {
+    return false;
+  }
+
+  const double offset = double(jd_tt - start_jd_tt_);
+
+  return offset >= 0 && offset <= num_segments_ * segment_duration_in_days_;
+}
+
+auto CelestialIntermediatePoleTable::Lookup(const JulianDate& jd_tt,
+                                            Vec2& cip_xy,
+                                            double& s) const -> bool {
+  if (!Covers(jd_tt)) {
+    return false;
+  }
+
+  const double offset = double(jd_tt - start_jd_tt_);
+
+  // The end of the time range belongs to the last segment.
+  const int segment = std::min(int(offset / segment_duration_in_days_),
+                               num_segments_ - 1);
+
+  const double segment_offset =
+      offset - segment * segment_duration_in_days_;
+  const double x = 2 * segment_offset / segment_duration_in_days_ - 1;
+
+  const double* segment_coefficients =
+      coefficients_.data() +
+      size_t(segment) * kNumQuantities * num_coefficients_;
+
+  cip_xy(0) = EvaluateChebyshev(
+      segment_coefficients + 0 * num_coefficients_, num_coefficients_, x);
+  cip_xy(1) = EvaluateChebyshev(
+      segment_coefficients + 1 * num_coefficients_, num_coefficients_, x);
+  s = EvaluateChebyshev(
+      segment_coefficients + 2 * num_coefficients_, num_coefficients_, x);
+
+  return true;
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
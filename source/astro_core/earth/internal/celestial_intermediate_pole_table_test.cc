@@ -0,0 +1,124 @@
+// Copyright (c) 2023 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/celestial_intermediate_pole_table.h"
+
+#include "astro_core/earth/celestial_intermediate_pole.h"
+#include "astro_core/earth/celestial_intermediate_pole_data.h"
+#include "astro_core/math/math.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+TEST(CelestialIntermediatePoleTable, Empty) {
+  const CelestialIntermediatePoleTable table;
+
+  EXPECT_TRUE(table.IsEmpty());
+  EXPECT_FALSE(table.Covers(JulianDate(2459802.0, 0.5)));
+
+  Vec2 cip_xy(1, 2);
+  double s = 3;
+  EXPECT_FALSE(table.Lookup(JulianDate(2459802.0, 0.5), cip_xy, s));
+  EXPECT_EQ(cip_xy, Vec2(1, 2));
+  EXPECT_EQ(s, 3);
+}
+
+TEST(CelestialIntermediatePoleTable, Coverage) {
+  const CelestialIntermediatePoleTable table =
+      CelestialIntermediatePoleTable::Tabulate(JulianDate(2459802.0, 0.25),
+                                               JulianDate(2459805.0, 0.0));
+
+  EXPECT_FALSE(table.IsEmpty());
+
+  EXPECT_FALSE(table.Covers(JulianDate(2459802.0, 0.2)));
+  EXPECT_TRUE(table.Covers(JulianDate(2459802.0, 0.25)));
+  EXPECT_TRUE(table.Covers(JulianDate(2459803.0, 0.0)));
+  EXPECT_TRUE(table.Covers(JulianDate(2459805.0, 0.0)));
+
+  // The table is extended to the end of the last segment.
+  EXPECT_TRUE(table.Covers(JulianDate(2459806.0, 0.25)));
+  EXPECT_FALSE(table.Covers(JulianDate(2459806.0, 0.3)));
+}
+
+// Compare the interpolated values with the series over the time range which
+// includes all phases of the shortest periodic terms.
+TEST(CelestialIntermediatePoleTable, Accuracy) {
+  const JulianDate start_jd_tt(2459802.0, 0.0);
+  const JulianDate end_jd_tt(2459862.0, 0.0);
+
+  const CelestialIntermediatePoleTable table =
+      CelestialIntermediatePoleTable::Tabulate(start_jd_tt, end_jd_tt);
+
+  double max_xy_error = 0;
+  double max_s_error = 0;
+
+  // Sample with a step which is not aligned with the segments.
+  for (JulianDate jd_tt = start_jd_tt; jd_tt <= end_jd_tt; jd_tt += 0.0371) {
+    Vec2 cip_xy;
+    double s;
+    ASSERT_TRUE(table.Lookup(jd_tt, cip_xy, s));
+
+    const Vec2 expected_cip_xy = CelestialIntermediatePole(jd_tt);
+    const double expected_s =
+        CelestialIntermediateOriginLocator(jd_tt, expected_cip_xy);
+
+    max_xy_error = Max(max_xy_error, Abs(cip_xy(0) - expected_cip_xy(0)));
+    max_xy_error = Max(max_xy_error, Abs(cip_xy(1) - expected_cip_xy(1)));
+    max_s_error = Max(max_s_error, Abs(s - expected_s));
+  }
+
+  EXPECT_LT(max_xy_error, 1e-15);
+  EXPECT_LT(max_s_error, 1e-15);
+}
+
+TEST(CelestialIntermediatePoleData, Lookup) {
+  CelestialIntermediatePoleData data;
+
+  Vec2 cip_xy;
+  double s;
+
+  EXPECT_FALSE(data.Lookup(JulianDate(2459802.0, 0.5), cip_xy, s));
+
+  data.SetTable(CelestialIntermediatePoleTable::Tabulate(
+      JulianDate(2459802.0, 0.0), JulianDate(2459803.0, 0.0)));
+
+  EXPECT_TRUE(data.Lookup(JulianDate(2459802.0, 0.5), cip_xy, s));
+  EXPECT_FALSE(data.Lookup(JulianDate(2459804.0, 0.5), cip_xy, s));
+
+  data.ClearTable();
+  EXPECT_FALSE(data.Lookup(JulianDate(2459802.0, 0.5), cip_xy, s));
+}
+
+TEST(earth, LookupCelestialIntermediatePole) {
+  const JulianDate jd_tt(2459802.0, 0.4174674074074074);
+
+  const Vec2 expected_cip_xy = CelestialIntermediatePole(jd_tt);
+  const double expected_s =
+      CelestialIntermediateOriginLocator(jd_tt, expected_cip_xy);
+
+  // Without a table the result matches the series exactly.
+  {
+    Vec2 cip_xy;
+    double s;
+    LookupCelestialIntermediatePole(jd_tt, cip_xy, s);
+    EXPECT_EQ(cip_xy, expected_cip_xy);
+    EXPECT_EQ(s, expected_s);
+  }
+
+  // With a table the result is interpolated.
+  GetCelestialIntermediatePoleData().SetTable(
+      CelestialIntermediatePoleTable::Tabulate(JulianDate(2459802.0, 0.0),
+                                               JulianDate(2459803.0, 0.0)));
+  {
+    Vec2 cip_xy;
+    double s;
+    LookupCelestialIntermediatePole(jd_tt, cip_xy, s);
+    EXPECT_NEAR(cip_xy(0), expected_cip_xy(0), 1e-15);
+    EXPECT_NEAR(cip_xy(1), expected_cip_xy(1), 1e-15);
+    EXPECT_NEAR(s, expected_s, 1e-15);
+  }
+  GetCelestialIntermediatePoleData().ClearTable();
+}
+
+}  // namespace astro_core
@@ -4,6 +4,8 @@
 
 #include "astro_core/earth/celestial_intermediate_pole.h"
 
+#include "astro_core/earth/nutation_epoch.h"
+#include "astro_core/math/math.h"
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
@@ -86,4 +88,40 @@ TEST(earth, CelestialToIntermediateFrameOfDateMatrix) {
                                          9.9999763383843709e-01}})));
 }
 
+// Accuracy of the approximate models compared to the complete model within the
+// 1900-2100 time range.
+TEST(earth, CelestialIntermediatePolePrecision) {
+  using Model = NutationPrecision::Model;
+
+  const auto expect_near_full = [](const NutationPrecision& precision,
+                                   const double cip_tolerance_in_arcsec,
+                                   const double s_tolerance_in_arcsec) {
+    const double cip_tolerance = ArcsecToRadians(cip_tolerance_in_arcsec);
+    const double s_tolerance = ArcsecToRadians(s_tolerance_in_arcsec);
+
+    for (int i = -100; i <= 100; ++i) {
+      const NutationEpoch epoch(JulianDate(2451545.0, i * 365.25 + 0.37 * i));
+
+      const Vec2 full_cip_xy = CelestialIntermediatePole(epoch);
+      const Vec2 cip_xy = CelestialIntermediatePole(epoch, precision);
+      EXPECT_NEAR(cip_xy(0), full_cip_xy(0), cip_tolerance);
+      EXPECT_NEAR(cip_xy(1), full_cip_xy(1), cip_tolerance);
+
+      EXPECT_NEAR(
+          CelestialIntermediateOriginLocator(epoch, full_cip_xy, precision),
+          CelestialIntermediateOriginLocator(epoch, full_cip_xy),
+          s_tolerance);
+    }
+  };
+
+  expect_near_full({.model = Model::kFull}, 0, 0);
+  expect_near_full({.model = Model::k2000B}, 1e-3, 0);
+  expect_near_full(
+      {.model = Model::kTruncated, .amplitude_cutoff = 1}, 30e-6, 5e-6);
+  expect_near_full(
+      {.model = Model::kTruncated, .amplitude_cutoff = 10}, 0.2e-3, 25e-6);
+  expect_near_full(
+      {.model = Model::kTruncated, .amplitude_cutoff = 100}, 0.9e-3, 50e-6);
+}
+
 }  // namespace astro_core
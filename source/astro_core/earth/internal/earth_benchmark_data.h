@@ -0,0 +1,78 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Helper function to provide the leap second and Earth orientation parameters
+// tables to the benchmarks.
+//
+// The tables are read from the same files as the regression tests use.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+#include "tl_io/tl_io_file.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/earth/leap_second.h"
+#include "astro_core/earth/leap_second_data.h"
+#include "astro_core/earth/leap_second_iers.h"
+#include "astro_core/earth/orientation.h"
+#include "astro_core/earth/orientation_data.h"
+#include "astro_core/earth/orientation_iers_b.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace benchmark_data {
+
+// Read the tables and make them the global leap second and Earth orientation
+// data.
+//
+// The tables are only read on the first call. Returns false if any of the
+// tables could not be read.
+inline auto SetTables() -> bool {
+  using File = tiny_lib::io_file::File;
+  using Path = std::filesystem::path;
+
+  static const bool ok = []() {
+    std::string table_str;
+
+    if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                            Path("iers") / "Leap_Second.dat"),
+                        table_str)) {
+      return false;
+    }
+    LeapSecondIERS::Result leap_second_result =
+        LeapSecondIERS::Parse(table_str);
+    if (!leap_second_result.Ok()) {
+      return false;
+    }
+
+    if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                            Path("iers") / "eopc04_IAU2000.62-now"),
+                        table_str)) {
+      return false;
+    }
+    EarthOrientationIERSB::Result orientation_result =
+        EarthOrientationIERSB::Parse(table_str);
+    if (!orientation_result.Ok()) {
+      return false;
+    }
+
+    GetLeapSecondData().SetTable(std::move(leap_second_result.GetValue()));
+    GetEarthOrientationData().SetTable(
+        std::move(orientation_result.GetValue()));
+
+    return true;
+  }();
+
+  return ok;
+}
+
+}  // namespace benchmark_data
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
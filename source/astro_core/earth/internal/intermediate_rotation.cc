@@ -12,19 +12,24 @@
 #include "astro_core/earth/intermediate_rotation.h"
 
 #include "astro_core/earth/nutation.h"
+#include "astro_core/earth/nutation_epoch.h"
 #include "astro_core/earth/precession.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
-auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt) -> Mat3 {
+namespace {
+
+// Calculate the bias-precession-nutation matrix at the given time point in
+// Julian Date format and Terrestrial Time scale from the nutation at this time
+// point.
+auto BiasPrecessionNutationRotationFromNutation(const JulianDate& jd_tt,
+                                                const Nutation& nutation)
+    -> Mat3 {
   // [Wallace2006], page 983, eq. (4).
   const PrecessionAngles06 precession_angles06 =
       CalculatePrecessionAngles06(jd_tt);
 
-  // [Wallace2006], page 983, eq. (5).
-  const Nutation nutation = CalculateNutation06A(jd_tt);
-
   // [Wallace2006], page 983, eq. (6).
   PrecessionAngles06 precession_angles = precession_angles06;
   precession_angles.psib += nutation.dpsi;
@@ -34,5 +39,35 @@ auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt) -> Mat3 {
   return PrecessionRotation(precession_angles);
 }
 
+}  // namespace
+
+auto BiasPrecessionNutationRotation06A(const NutationEpoch& epoch,
+                                       const NutationPrecision& precision)
+    -> Mat3 {
+  // [Wallace2006], page 983, eq. (5).
+  return BiasPrecessionNutationRotationFromNutation(
+      epoch.GetJulianDate(), CalculateNutation06A(epoch, precision));
+}
+
+auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt,
+                                       const NutationPrecision& precision)
+    -> Mat3 {
+  // The IAU 2000B nutation only needs the lunisolar arguments, which are
+  // calculated without the rest of the epoch quantities.
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    return BiasPrecessionNutationRotationFromNutation(
+        jd_tt, CalculateNutation06A(jd_tt, precision));
+  }
+  return BiasPrecessionNutationRotation06A(NutationEpoch(jd_tt), precision);
+}
+
+auto BiasPrecessionNutationRotation06A(const NutationEpoch& epoch) -> Mat3 {
+  return BiasPrecessionNutationRotation06A(epoch, NutationPrecision());
+}
+
+auto BiasPrecessionNutationRotation06A(const JulianDate& jd_tt) -> Mat3 {
+  return BiasPrecessionNutationRotation06A(NutationEpoch(jd_tt));
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -4,6 +4,8 @@
 
 #include "astro_core/earth/intermediate_rotation.h"
 
+#include "astro_core/earth/nutation_epoch.h"
+#include "astro_core/math/math.h"
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
@@ -45,4 +47,29 @@ TEST(earth, BiasPrecessionNutationRotation06A) {
                                          9.9999782970803186e-01}})));
 }
 
+// Accuracy of the approximate models compared to the complete model within the
+// 1900-2100 time range.
+TEST(earth, BiasPrecessionNutationRotation06APrecision) {
+  using Model = NutationPrecision::Model;
+
+  const auto expect_near_full = [](const NutationPrecision& precision,
+                                   const double tolerance_in_arcsec) {
+    const double tolerance = ArcsecToRadians(tolerance_in_arcsec);
+
+    for (int i = -100; i <= 100; ++i) {
+      const NutationEpoch epoch(JulianDate(2451545.0, i * 365.25 + 0.37 * i));
+
+      EXPECT_THAT(BiasPrecessionNutationRotation06A(epoch, precision),
+                  Pointwise(DoubleNear(tolerance),
+                            BiasPrecessionNutationRotation06A(epoch)));
+    }
+  };
+
+  expect_near_full({.model = Model::kFull}, 0);
+  expect_near_full({.model = Model::k2000B}, 2e-3);
+  expect_near_full({.model = Model::kTruncated, .amplitude_cutoff = 1}, 30e-6);
+  expect_near_full({.model = Model::kTruncated, .amplitude_cutoff = 100},
+                   1e-3);
+}
+
 }  // namespace astro_core
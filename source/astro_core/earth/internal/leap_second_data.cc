@@ -154,14 +154,40 @@ auto CalculateHistoricalTAIMinusUTCSecondsInTAIScale(
 // Hide the implementation, so that it is possible to only have forward
 // declaration of Table in the header.
 LeapSecondData::LeapSecondData() = default;
+LeapSecondData::LeapSecondData(LeapSecondData&& other) noexcept = default;
 LeapSecondData::~LeapSecondData() = default;
 
+auto LeapSecondData::operator=(LeapSecondData&& other) noexcept
+    -> LeapSecondData& = default;
+
 void LeapSecondData::SetTable(Table&& table) {
-  shared_table_.Set(std::move(table));
+  LastInterval::Interval interval;
+
+  if (!table.IsEmpty()) {
+    const Table::Row& last_row = table.GetLastRow();
+
+    // The table is only used past the end of the historical table, so the
+    // interval does not start before it.
+    interval.begin_mjd_utc = std::max(
+        last_row.mjd_utc,
+        ModifiedJulianDate(kHistoricalTable.back().mjd_utc));
+    interval.begin_mjd_tai = std::max(
+        last_row.mjd_tai,
+        ModifiedJulianDate(kHistoricalTable.back().mjd_tai));
+    interval.tai_minus_utc = last_row.tai_minus_utc;
+  }
+
+  last_interval_.Update(interval,
+                        [&]() { shared_table_.Set(std::move(table)); });
 }
 
 auto LeapSecondData::LookupTAIMinusUTCSecondsInUTCScale(
     const ModifiedJulianDate& mjd_utc) const -> double {
+  double tai_minus_utc;
+  if (last_interval_.LookupInUTCScale(mjd_utc, tai_minus_utc)) {
+    return tai_minus_utc;
+  }
+
   if (IsHistoricalUTCTime(mjd_utc)) {
     return CalculateHistoricalTAIMinusUTCSecondsInUTCScale(mjd_utc);
   }
@@ -176,6 +202,11 @@ auto LeapSecondData::LookupTAIMinusUTCSecondsInUTCScale(
 
 auto LeapSecondData::LookupTAIMinusUTCSecondsInTAIScale(
     const ModifiedJulianDate& mjd_tai) const -> double {
+  double tai_minus_utc;
+  if (last_interval_.LookupInTAIScale(mjd_tai, tai_minus_utc)) {
+    return tai_minus_utc;
+  }
+
   if (IsHistoricalTAITime(mjd_tai)) {
     return CalculateHistoricalTAIMinusUTCSecondsInTAIScale(mjd_tai);
   }
@@ -188,5 +219,107 @@ auto LeapSecondData::LookupTAIMinusUTCSecondsInTAIScale(
   return local_table->LookupTAIMinusUTCSecondsInTAIScale(mjd_tai);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// LeapSecondData::LastInterval.
+
+LeapSecondData::LastInterval::LastInterval(LastInterval&& other) noexcept {
+  *this = std::move(other);
+}
+
+auto LeapSecondData::LastInterval::operator=(LastInterval&& other) noexcept
+    -> LastInterval& {
+  if (this == &other) {
+    return *this;
+  }
+
+  constexpr std::memory_order kRelaxed = std::memory_order_relaxed;
+
+  sequence_.store(other.sequence_.load(kRelaxed), kRelaxed);
+  begin_mjd_utc_hi_.store(other.begin_mjd_utc_hi_.load(kRelaxed), kRelaxed);
+  begin_mjd_utc_lo_.store(other.begin_mjd_utc_lo_.load(kRelaxed), kRelaxed);
+  begin_mjd_tai_hi_.store(other.begin_mjd_tai_hi_.load(kRelaxed), kRelaxed);
+  begin_mjd_tai_lo_.store(other.begin_mjd_tai_lo_.load(kRelaxed), kRelaxed);
+  tai_minus_utc_.store(other.tai_minus_utc_.load(kRelaxed), kRelaxed);
+
+  // Invalidate the moved-from interval: its table has been moved as well.
+  other.Invalidate();
+  other.Publish({});
+
+  return *this;
+}
+
+auto LeapSecondData::LastInterval::LookupInUTCScale(
+    const ModifiedJulianDate& mjd_utc, double& tai_minus_utc) const -> bool {
+  const uint64_t sequence = sequence_.load(std::memory_order_acquire);
+  if (sequence & 1) {
+    return false;
+  }
+
+  const ModifiedJulianDate begin_mjd_utc(
+      begin_mjd_utc_hi_.load(std::memory_order_relaxed),
+      begin_mjd_utc_lo_.load(std::memory_order_relaxed));
+  const double value = tai_minus_utc_.load(std::memory_order_relaxed);
+
+  // Order the loads of the fields before the check of the sequence.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (sequence_.load(std::memory_order_relaxed) != sequence) {
+    return false;
+  }
+
+  if (!(mjd_utc >= begin_mjd_utc)) {
+    return false;
+  }
+
+  tai_minus_utc = value;
+  return true;
+}
+
+auto LeapSecondData::LastInterval::LookupInTAIScale(
+    const ModifiedJulianDate& mjd_tai, double& tai_minus_utc) const -> bool {
+  const uint64_t sequence = sequence_.load(std::memory_order_acquire);
+  if (sequence & 1) {
+    return false;
+  }
+
+  const ModifiedJulianDate begin_mjd_tai(
+      begin_mjd_tai_hi_.load(std::memory_order_relaxed),
+      begin_mjd_tai_lo_.load(std::memory_order_relaxed));
+  const double value = tai_minus_utc_.load(std::memory_order_relaxed);
+
+  // Order the loads of the fields before the check of the sequence.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (sequence_.load(std::memory_order_relaxed) != sequence) {
+    return false;
+  }
+
+  if (!(mjd_tai >= begin_mjd_tai)) {
+    return false;
+  }
+
+  tai_minus_utc = value;
+  return true;
+}
+
+void LeapSecondData::LastInterval::Invalidate() {
+  // Make the sequence odd, and order it before the following stores of the
+  // fields.
+  sequence_.store(sequence_.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void LeapSecondData::LastInterval::Publish(const Interval& interval) {
+  constexpr std::memory_order kRelaxed = std::memory_order_relaxed;
+
+  begin_mjd_utc_hi_.store(interval.begin_mjd_utc.GetJD1(), kRelaxed);
+  begin_mjd_utc_lo_.store(interval.begin_mjd_utc.GetJD2(), kRelaxed);
+  begin_mjd_tai_hi_.store(interval.begin_mjd_tai.GetJD1(), kRelaxed);
+  begin_mjd_tai_lo_.store(interval.begin_mjd_tai.GetJD2(), kRelaxed);
+  tai_minus_utc_.store(interval.tai_minus_utc, kRelaxed);
+
+  // Make the sequence even, advancing the generation.
+  sequence_.store(sequence_.load(kRelaxed) + 1, std::memory_order_release);
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
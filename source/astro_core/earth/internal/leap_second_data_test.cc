@@ -4,6 +4,10 @@
 
 #include "astro_core/earth/leap_second_data.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "astro_core/base/constants.h"
 #include "astro_core/earth/internal/leap_second_test_data.h"
 #include "astro_core/earth/leap_second_table.h"
@@ -21,6 +25,22 @@ auto MakeLeapSecondData() -> LeapSecondData {
   return leap_second_data;
 }
 
+// Create a table with the leap seconds introduced at the given MJDs, starting
+// with TAI-UTC of 10 seconds at 1972 January 1.
+auto MakeLeapSecondTable(const std::vector<double>& leap_second_mjds)
+    -> LeapSecondTable {
+  LeapSecondTable table;
+
+  table.AddRow(ModifiedJulianDate(41317.0), 10);
+  for (int i = 0; i < leap_second_mjds.size(); ++i) {
+    table.AddRow(ModifiedJulianDate(leap_second_mjds[i]), 11 + i);
+  }
+
+  table.Preprocess();
+
+  return table;
+}
+
 }  // namespace
 
 TEST(LeapSecondData, LookupTAIMinusUTCSecondsInUTCScale_Historical) {
@@ -242,4 +262,108 @@ TEST(LeapSecondData, LookupTAIMinusUTCSecondsInTAIScale_IERS) {
             11);
 }
 
+// The lookups past the last leap second use the cached interval, which is to
+// give exactly the same result as the lookup in the table.
+TEST(LeapSecondData, LastIntervalMatchesTable) {
+  const LeapSecondData leap_second_data = MakeLeapSecondData();
+  const LeapSecondTable table = test_data::CreateLeapSecondTable();
+  ASSERT_FALSE(table.IsEmpty());
+
+  // Cover all rows of the table past the end of the historical table, with the
+  // day before every leap second at which the leap second is smeared, and the
+  // dates past the last row.
+  for (double mjd = 41318.0; mjd < 62000.0; mjd += 0.1) {
+    EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(
+                  ModifiedJulianDate(mjd)),
+              table.LookupTAIMinusUTCSecondsInUTCScale(ModifiedJulianDate(mjd)))
+        << "MJD " << mjd;
+    EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(
+                  ModifiedJulianDate(mjd)),
+              table.LookupTAIMinusUTCSecondsInTAIScale(ModifiedJulianDate(mjd)))
+        << "MJD " << mjd;
+  }
+
+  // Exactly at the last leap second.
+  const LeapSecondTable::Row& last_row = table.GetLastRow();
+  EXPECT_EQ(
+      leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(last_row.mjd_utc),
+      last_row.tai_minus_utc);
+  EXPECT_EQ(
+      leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(last_row.mjd_tai),
+      last_row.tai_minus_utc);
+}
+
+TEST(LeapSecondData, ReplaceTable) {
+  const ModifiedJulianDate mjd(50000.0);
+
+  LeapSecondData leap_second_data;
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd), 0);
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd), 0);
+
+  leap_second_data.SetTable(MakeLeapSecondTable({41499}));
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd), 11);
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd), 11);
+
+  // The new leap second is visible after the replacement.
+  leap_second_data.SetTable(MakeLeapSecondTable({41499, 41683}));
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd), 12);
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd), 12);
+
+  // The table without rows does not provide any values past the historical
+  // table.
+  leap_second_data.SetTable(LeapSecondTable());
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd), 0);
+  EXPECT_EQ(leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd), 0);
+
+  // The moved data keeps the values.
+  leap_second_data.SetTable(MakeLeapSecondTable({41499}));
+  const LeapSecondData moved_leap_second_data = std::move(leap_second_data);
+  EXPECT_EQ(moved_leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd), 11);
+  EXPECT_EQ(moved_leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd), 11);
+}
+
+TEST(LeapSecondData, ConcurrentLookupAndReplace) {
+  constexpr int kNumReaders = 4;
+  constexpr int kNumReplacements = 1000;
+
+  const ModifiedJulianDate mjd(50000.0);
+
+  LeapSecondData leap_second_data;
+  leap_second_data.SetTable(MakeLeapSecondTable({41499}));
+
+  std::atomic<bool> is_done{false};
+  std::atomic<int> num_errors{0};
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kNumReaders; ++i) {
+    readers.emplace_back([&]() {
+      while (!is_done.load(std::memory_order_relaxed)) {
+        const double utc_value =
+            leap_second_data.LookupTAIMinusUTCSecondsInUTCScale(mjd);
+        const double tai_value =
+            leap_second_data.LookupTAIMinusUTCSecondsInTAIScale(mjd);
+        if ((utc_value != 11 && utc_value != 12) ||
+            (tai_value != 11 && tai_value != 12)) {
+          ++num_errors;
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < kNumReplacements; ++i) {
+    if (i % 2) {
+      leap_second_data.SetTable(MakeLeapSecondTable({41499}));
+    } else {
+      leap_second_data.SetTable(MakeLeapSecondTable({41499, 41683}));
+    }
+  }
+
+  is_done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(num_errors, 0);
+}
+
 }  // namespace astro_core
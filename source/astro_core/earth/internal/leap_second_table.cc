@@ -26,6 +26,10 @@ void LeapSecondTable::Preprocess() {
         ModifiedJulianDate(DoubleDouble(row.mjd_utc) +
                            row.tai_minus_utc / constants::kNumSecondsInDay);
   }
+
+  // The table is not modified after it has been pre-processed: store its rows
+  // contiguously for the lookups.
+  table_.Freeze();
 }
 
 auto LeapSecondTable::LookupTAIMinusUTCSecondsInUTCScale(
@@ -8,17 +8,23 @@
 //     resolutions, P. T. Wallace and N. Capitaine
 //     Astronomy and Astrophysics, 459 3 (2006) 981-985
 //     DOI: https://doi.org/10.1051/0004-6361:20065897
+//
+//   [McCarthy2003] McCarthy, D. D., Luzum, B. J., An abridged model of the
+//     precession-nutation of the celestial pole, Celestial Mechanics and
+//     Dynamical Astronomy, 85, 37-49 (2003).
 
 #include "astro_core/earth/nutation.h"
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include "astro_core/earth/internal/iers/tab5.3a.h"
 #include "astro_core/earth/internal/iers/tab5.3b.h"
 
-#include "astro_core/base/constants.h"
 #include "astro_core/base/reverse_view.h"
-#include "astro_core/earth/internal/nutation_arguments.h"
+#include "astro_core/earth/internal/nutation_series.h"
+#include "astro_core/earth/nutation_epoch.h"
 #include "astro_core/math/math.h"
 #include "astro_core/time/format/julian_date.h"
 
@@ -32,110 +38,265 @@ auto operator<<(std::ostream& os, const Nutation& nutation) -> std::ostream& {
 
 namespace {
 
-// Calculate argument for the given row of nutation table.
-// It is referred to as ARGUMENT in [IERS2010] Page 62, Eq. (5.35).
-template <class Row>
-auto CalculateArgument(
-    const Row& row,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  double arg = 0;
-
-  // Lunisolar nutation arguments.
-  arg += row.l * lunisolar_nutation_arguments.l;
-  arg += row.l_prime * lunisolar_nutation_arguments.l_prime;
-  arg += row.F * lunisolar_nutation_arguments.F;
-  arg += row.D * lunisolar_nutation_arguments.D;
-  arg += row.Om * lunisolar_nutation_arguments.Om;
-
-  // Planetary nutation arguments.
-  arg += row.L_Me * planetary_nutation_arguments.L_Me;
-  arg += row.L_Ve * planetary_nutation_arguments.L_Ve;
-  arg += row.L_E * planetary_nutation_arguments.L_E;
-  arg += row.L_Ma * planetary_nutation_arguments.L_Ma;
-  arg += row.L_J * planetary_nutation_arguments.L_J;
-  arg += row.L_Sa * planetary_nutation_arguments.L_Sa;
-  arg += row.L_U * planetary_nutation_arguments.L_U;
-  arg += row.L_Ne * planetary_nutation_arguments.L_Ne;
-  arg += row.p_A * planetary_nutation_arguments.p_A;
-
-  return arg;
-}
-
-// Common logic of processing tables 5.3a and 5.3b.
-// The result is in radians.
-template <class Table>
-auto CalculateTableRows00a(
-    const Table& table,
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  double dpsi = 0;
-  for (int j = 0; j < table.size(); ++j) {
-    const double tn = Pow(t, j);
-    // Reverse order to handle small values first.
-    for (const auto& row : reverse_view(table[j])) {
-      const double argument = CalculateArgument(
-          row, lunisolar_nutation_arguments, planetary_nutation_arguments);
-      dpsi +=
-          (row.Arg_i_sin * Sin(argument) + row.Arg_i_cos * Cos(argument)) * tn;
-    }
-  }
-  // The table rows are in microarcseconds, convert it to radians.
-  return ArcsecToRadians(dpsi / 1000000.0);
-}
+using nutation_series_internal::EvaluateSeries;
+using nutation_series_internal::GetMaxArgumentMultiplier;
+using nutation_series_internal::GetSeriesAmplitudeCutoff;
+using nutation_series_internal::MakeSeriesColumns;
+
+static_assert(GetMaxArgumentMultiplier<iers::table::Table53aRow>(
+                  iers::table::Table53aFlat) <=
+              NutationArgumentMultiples::kMaxMultiplier);
+static_assert(GetMaxArgumentMultiplier<iers::table::Table53bRow>(
+                  iers::table::Table53bFlat) <=
+              NutationArgumentMultiples::kMaxMultiplier);
+
+constexpr auto kTable53aColumns =
+    MakeSeriesColumns<iers::table::Table53a,
+                      &iers::table::Table53aRow::Arg_i_sin,
+                      &iers::table::Table53aRow::Arg_i_cos>();
+
+constexpr auto kTable53bColumns =
+    MakeSeriesColumns<iers::table::Table53b,
+                      &iers::table::Table53bRow::Arg_i_sin,
+                      &iers::table::Table53bRow::Arg_i_cos>();
 
 // Calculate Nutation in longitude ∆ψ (dpsi).
 // [IERS2010] Page 62, Eq. (5.35).
-auto CalculateLongitudeNutation00a(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  return CalculateTableRows00a(iers::table::Table53a,
-                               t,
-                               lunisolar_nutation_arguments,
-                               planetary_nutation_arguments);
+auto CalculateLongitudeNutation00a(const NutationEpoch& epoch,
+                                   const double amplitude_cutoff) -> double {
+  // The table rows are in microarcseconds, convert it to radians.
+  return ArcsecToRadians(
+      EvaluateSeries(kTable53aColumns, epoch, amplitude_cutoff) / 1000000.0);
 }
 
 // Calculate Nutation in obliquity ∆ε (deps).
 // [IERS2010] Page 62, Eq. (5.35).
-auto CalculateObliquityNutation00a(
-    const double t,
-    const LunisolarNutationArguments& lunisolar_nutation_arguments,
-    const PlanetaryNutationArguments& planetary_nutation_arguments) -> double {
-  return CalculateTableRows00a(iers::table::Table53b,
-                               t,
-                               lunisolar_nutation_arguments,
-                               planetary_nutation_arguments);
+auto CalculateObliquityNutation00a(const NutationEpoch& epoch,
+                                   const double amplitude_cutoff) -> double {
+  // The table rows are in microarcseconds, convert it to radians.
+  return ArcsecToRadians(
+      EvaluateSeries(kTable53bColumns, epoch, amplitude_cutoff) / 1000000.0);
 }
 
-}  // namespace
+////////////////////////////////////////////////////////////////////////////////
+// IAU 2000B nutation.
 
-auto CalculateNutation00A(const JulianDate& jd_tt) -> Nutation {
-  // [IERS2010] Page 45, Eq. (5.2).
-  const double t = double((jd_tt - constants::kJulianDateEpochJ2000) /
-                          constants::kNumDaysInJulianCentury);
+// Term of the IAU 2000B nutation series. The coefficients are in
+// microarcseconds, and microarcseconds per Julian century for the coefficients
+// of the terms which depend on the time.
+struct Nutation2000BTerm {
+  // Multipliers of the lunisolar arguments l, l', F, D, Om.
+  std::array<int, 5> multipliers{};
+
+  double dpsi_sin{0};
+  double dpsi_cos{0};
+  double dpsi_sin_t{0};
+  double dpsi_cos_t{0};
+
+  double deps_sin{0};
+  double deps_cos{0};
+  double deps_sin_t{0};
+  double deps_cos_t{0};
+};
+
+// Number of terms of the IAU 2000B nutation series.
+constexpr int kNumNutation2000BTerms = 77;
+
+// Offsets which approximate the planetary terms of the IAU 2000A nutation, in
+// microarcseconds [McCarthy2003].
+constexpr double kNutation2000BPlanetaryDpsi = -135;
+constexpr double kNutation2000BPlanetaryDeps = 388;
+
+// Check whether the row has the given lunisolar multipliers and no planetary
+// terms.
+template <class Row>
+constexpr auto IsLunisolarRowWithMultipliers(
+    const Row& row, const std::array<int, 5>& multipliers) -> bool {
+  return row.l == multipliers[0] && row.l_prime == multipliers[1] &&
+         row.F == multipliers[2] && row.D == multipliers[3] &&
+         row.Om == multipliers[4] && row.L_Me == 0 && row.L_Ve == 0 &&
+         row.L_E == 0 && row.L_Ma == 0 && row.L_J == 0 && row.L_Sa == 0 &&
+         row.L_U == 0 && row.L_Ne == 0 && row.p_A == 0;
+}
+
+// Construct the IAU 2000B series from the tables 5.3a and 5.3b.
+//
+// The IAU 2000B series consists of the largest lunisolar terms of the IAU 2000A
+// series. The tables list the terms in the descending order of the amplitude,
+// so the series is formed by the first lunisolar rows of the table 5.3a, and
+// the rows of the other parts of the tables which have the same arguments.
+constexpr auto MakeNutation2000BTerms()
+    -> std::array<Nutation2000BTerm, kNumNutation2000BTerms> {
+  using iers::table::Table53a;
+  using iers::table::Table53b;
+
+  std::array<Nutation2000BTerm, kNumNutation2000BTerms> terms;
+
+  int num_terms = 0;
+  for (const iers::table::Table53aRow& row : Table53a[0]) {
+    if (num_terms == kNumNutation2000BTerms) {
+      break;
+    }
+
+    const std::array<int, 5> multipliers = {
+        row.l, row.l_prime, row.F, row.D, row.Om};
+    if (!IsLunisolarRowWithMultipliers(row, multipliers)) {
+      continue;
+    }
+
+    Nutation2000BTerm& term = terms[num_terms++];
+    term.multipliers = multipliers;
+
+    term.dpsi_sin = row.Arg_i_sin;
+    term.dpsi_cos = row.Arg_i_cos;
+    for (const iers::table::Table53aRow& row_t : Table53a[1]) {
+      if (IsLunisolarRowWithMultipliers(row_t, multipliers)) {
+        term.dpsi_sin_t += row_t.Arg_i_sin;
+        term.dpsi_cos_t += row_t.Arg_i_cos;
+      }
+    }
+
+    for (const iers::table::Table53bRow& row_b : Table53b[0]) {
+      if (IsLunisolarRowWithMultipliers(row_b, multipliers)) {
+        term.deps_sin += row_b.Arg_i_sin;
+        term.deps_cos += row_b.Arg_i_cos;
+      }
+    }
+    for (const iers::table::Table53bRow& row_t : Table53b[1]) {
+      if (IsLunisolarRowWithMultipliers(row_t, multipliers)) {
+        term.deps_sin_t += row_t.Arg_i_sin;
+        term.deps_cos_t += row_t.Arg_i_cos;
+      }
+    }
+  }
+
+  return terms;
+}
+
+constexpr std::array<Nutation2000BTerm, kNumNutation2000BTerms>
+    kNutation2000BTerms = MakeNutation2000BTerms();
+
+// The largest absolute value of a multiplier of a lunisolar argument in the
+// IAU 2000B series.
+constexpr auto GetMaxNutation2000BMultiplier() -> int {
+  int max_multiplier = 0;
+  for (const Nutation2000BTerm& term : kNutation2000BTerms) {
+    for (const int multiplier : term.multipliers) {
+      max_multiplier =
+          std::max(max_multiplier, multiplier < 0 ? -multiplier : multiplier);
+    }
+  }
+  return max_multiplier;
+}
+
+constexpr int kMaxNutation2000BMultiplier = GetMaxNutation2000BMultiplier();
+
+// Sine and cosine of the multiples of the lunisolar arguments which are needed
+// for the IAU 2000B series.
+//
+// The series only uses the 5 lunisolar arguments with small multipliers, so
+// calculating them is much cheaper than the NutationArgumentMultiples of all
+// the fundamental arguments.
+class Nutation2000BArgumentMultiples {
+ public:
+  explicit Nutation2000BArgumentMultiples(
+      const LunisolarNutationArguments& arguments) {
+    const std::array<double, 5> values = {
+        arguments.l, arguments.l_prime, arguments.F, arguments.D, arguments.Om};
+
+    for (int i = 0; i < 5; ++i) {
+      double* sin_multiples = sin_[i].data() + kMaxNutation2000BMultiplier;
+      double* cos_multiples = cos_[i].data() + kMaxNutation2000BMultiplier;
+
+      const double base_sin = Sin(values[i]);
+      const double base_cos = Cos(values[i]);
 
-  const LunisolarNutationArguments lunisolar_nutation_arguments =
-      CalculateLunisolarNutationArguments(t);
-  const PlanetaryNutationArguments planetary_nutation_arguments =
-      CalculatePlanetaryNutationArguments(t);
+      sin_multiples[0] = 0;
+      cos_multiples[0] = 1;
 
+      // Rotate the previous multiple by the argument, the same way as the
+      // NutationArgumentMultiples does.
+      for (int k = 1; k <= kMaxNutation2000BMultiplier; ++k) {
+        const double previous_sin = sin_multiples[k - 1];
+        const double previous_cos = cos_multiples[k - 1];
+        sin_multiples[k] = previous_sin * base_cos + previous_cos * base_sin;
+        cos_multiples[k] = previous_cos * base_cos - previous_sin * base_sin;
+        sin_multiples[-k] = -sin_multiples[k];
+        cos_multiples[-k] = cos_multiples[k];
+      }
+    }
+  }
+
+  auto Get(const int argument_index, const int multiplier) const
+      -> NutationArgumentMultiples::SinCos {
+    return {sin_[argument_index][multiplier + kMaxNutation2000BMultiplier],
+            cos_[argument_index][multiplier + kMaxNutation2000BMultiplier]};
+  }
+
+ private:
+  static constexpr int kNumMultiples = 2 * kMaxNutation2000BMultiplier + 1;
+
+  std::array<std::array<double, kNumMultiples>, 5> sin_;
+  std::array<std::array<double, kNumMultiples>, 5> cos_;
+};
+
+// Calculate the IAU 2000B nutation at the given time interval since J2000 in
+// Julian centuries (TT).
+//
+// The fundamental arguments are the same as of the IAU 2000A model, which is
+// more accurate than the simplified arguments of [McCarthy2003] and does not
+// affect the 1 mas accuracy of the model. Only the lunisolar arguments are
+// used, so the planetary arguments and their multiples are not calculated.
+auto CalculateNutation00B(const double t,
+                          const LunisolarNutationArguments& arguments)
+    -> Nutation {
+  const Nutation2000BArgumentMultiples multiples(arguments);
+
+  double dpsi = 0;
+  double deps = 0;
+
+  // Reverse order to handle small values first.
+  for (const Nutation2000BTerm& term : reverse_view(kNutation2000BTerms)) {
+    double sin_arg = 0;
+    double cos_arg = 1;
+    for (int i = 0; i < 5; ++i) {
+      if (term.multipliers[i] == 0) {
+        continue;
+      }
+      const NutationArgumentMultiples::SinCos sin_cos =
+          multiples.Get(i, term.multipliers[i]);
+      const double new_sin_arg = sin_arg * sin_cos.cos + cos_arg * sin_cos.sin;
+      cos_arg = cos_arg * sin_cos.cos - sin_arg * sin_cos.sin;
+      sin_arg = new_sin_arg;
+    }
+
+    dpsi += (term.dpsi_sin + term.dpsi_sin_t * t) * sin_arg +
+            (term.dpsi_cos + term.dpsi_cos_t * t) * cos_arg;
+    deps += (term.deps_sin + term.deps_sin_t * t) * sin_arg +
+            (term.deps_cos + term.deps_cos_t * t) * cos_arg;
+  }
+
+  dpsi += kNutation2000BPlanetaryDpsi;
+  deps += kNutation2000BPlanetaryDeps;
+
+  // The coefficients are in microarcseconds, convert it to radians.
   return {
-      .dpsi = CalculateLongitudeNutation00a(
-          t, lunisolar_nutation_arguments, planetary_nutation_arguments),
-      .deps = CalculateObliquityNutation00a(
-          t, lunisolar_nutation_arguments, planetary_nutation_arguments),
+      .dpsi = ArcsecToRadians(dpsi / 1000000.0),
+      .deps = ArcsecToRadians(deps / 1000000.0),
   };
 }
 
-auto CalculateNutation06A(const JulianDate& jd_tt) -> Nutation {
-  // t is the time interval since J2000 in Julian centuries (TT).
-  const double t = double((jd_tt - constants::kJulianDateEpochJ2000) /
-                          constants::kNumDaysInJulianCentury);
-
-  const Nutation nutation00a = CalculateNutation00A(jd_tt);
+// Calculate the IAU 2000B nutation at the given time point in Julian Date
+// format and Terrestrial Time scale, from the lunisolar arguments only.
+auto CalculateNutation00B(const JulianDate& jd_tt) -> Nutation {
+  const double t = NutationEpoch::CalculateT(jd_tt);
+  return CalculateNutation00B(t, CalculateLunisolarNutationArguments(t));
+}
 
+// Adjust the IAU 2000A nutation to match the IAU 2006 precession.
+// The t is the time interval since J2000 in Julian centuries (TT).
+auto AdjustNutation00ATo06A(const double t, const Nutation& nutation00a)
+    -> Nutation {
   // [Wallace2006], page 983, eq. (5).
   Nutation nutation06a;
   const double f = -2.7774e-6 * t;
@@ -145,5 +306,60 @@ auto CalculateNutation06A(const JulianDate& jd_tt) -> Nutation {
   return nutation06a;
 }
 
+}  // namespace
+
+auto CalculateNutation00A(const NutationEpoch& epoch,
+                          const NutationPrecision& precision) -> Nutation {
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    return CalculateNutation00B(epoch.GetT(), epoch.GetLunisolarArguments());
+  }
+
+  const double amplitude_cutoff = GetSeriesAmplitudeCutoff(precision);
+
+  return {
+      .dpsi = CalculateLongitudeNutation00a(epoch, amplitude_cutoff),
+      .deps = CalculateObliquityNutation00a(epoch, amplitude_cutoff),
+  };
+}
+
+auto CalculateNutation00A(const JulianDate& jd_tt,
+                          const NutationPrecision& precision) -> Nutation {
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    return CalculateNutation00B(jd_tt);
+  }
+  return CalculateNutation00A(NutationEpoch(jd_tt), precision);
+}
+
+auto CalculateNutation00A(const NutationEpoch& epoch) -> Nutation {
+  return CalculateNutation00A(epoch, NutationPrecision());
+}
+
+auto CalculateNutation00A(const JulianDate& jd_tt) -> Nutation {
+  return CalculateNutation00A(NutationEpoch(jd_tt));
+}
+
+auto CalculateNutation06A(const NutationEpoch& epoch,
+                          const NutationPrecision& precision) -> Nutation {
+  return AdjustNutation00ATo06A(epoch.GetT(),
+                                CalculateNutation00A(epoch, precision));
+}
+
+auto CalculateNutation06A(const JulianDate& jd_tt,
+                          const NutationPrecision& precision) -> Nutation {
+  if (precision.model == NutationPrecision::Model::k2000B) {
+    return AdjustNutation00ATo06A(NutationEpoch::CalculateT(jd_tt),
+                                  CalculateNutation00B(jd_tt));
+  }
+  return CalculateNutation06A(NutationEpoch(jd_tt), precision);
+}
+
+auto CalculateNutation06A(const NutationEpoch& epoch) -> Nutation {
+  return CalculateNutation06A(epoch, NutationPrecision());
+}
+
+auto CalculateNutation06A(const JulianDate& jd_tt) -> Nutation {
+  return CalculateNutation06A(NutationEpoch(jd_tt));
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -2,7 +2,7 @@
 //
 // SPDX-License-Identifier: MIT
 
-#include "astro_core/earth/internal/nutation_arguments.h"
+#include "astro_core/earth/nutation_arguments.h"
 
 #include "astro_core/math/math.h"
 #include "astro_core/numeric/polynomial.h"
@@ -76,5 +76,61 @@ auto CalculatePlanetaryNutationArguments(const double t)
   return args;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Sine and cosine of integer multiples of the fundamental arguments.
+
+NutationArgumentMultiples::NutationArgumentMultiples(
+    const LunisolarNutationArguments& lunisolar_nutation_arguments,
+    const PlanetaryNutationArguments& planetary_nutation_arguments) {
+  const std::array<double, kNumArguments> arguments = {
+      lunisolar_nutation_arguments.l,
+      lunisolar_nutation_arguments.l_prime,
+      lunisolar_nutation_arguments.F,
+      lunisolar_nutation_arguments.D,
+      lunisolar_nutation_arguments.Om,
+      planetary_nutation_arguments.L_Me,
+      planetary_nutation_arguments.L_Ve,
+      planetary_nutation_arguments.L_E,
+      planetary_nutation_arguments.L_Ma,
+      planetary_nutation_arguments.L_J,
+      planetary_nutation_arguments.L_Sa,
+      planetary_nutation_arguments.L_U,
+      planetary_nutation_arguments.L_Ne,
+      planetary_nutation_arguments.p_A,
+  };
+
+  for (int i = 0; i < kNumArguments; ++i) {
+    double* sin_multiples = sin_[i].data() + kMaxMultiplier;
+    double* cos_multiples = cos_[i].data() + kMaxMultiplier;
+
+    const SinCos base = {Sin(arguments[i]), Cos(arguments[i])};
+
+    sin_multiples[0] = 0;
+    cos_multiples[0] = 1;
+    sin_multiples[1] = base.sin;
+    cos_multiples[1] = base.cos;
+
+    // Rotate the previous multiple by the argument:
+    //   sin(k*a) = sin((k-1)*a) * cos(a) + cos((k-1)*a) * sin(a)
+    //   cos(k*a) = cos((k-1)*a) * cos(a) - sin((k-1)*a) * sin(a)
+    //
+    // Unlike the Chebyshev recurrence sin(k*a) = 2*cos(a)*sin((k-1)*a) -
+    // sin((k-2)*a) the rotation does not amplify the round-off error for the
+    // arguments close to 0 or pi.
+    for (int k = 2; k <= kMaxMultiplier; ++k) {
+      const double previous_sin = sin_multiples[k - 1];
+      const double previous_cos = cos_multiples[k - 1];
+      sin_multiples[k] = previous_sin * base.cos + previous_cos * base.sin;
+      cos_multiples[k] = previous_cos * base.cos - previous_sin * base.sin;
+    }
+
+    // sin(-k*a) = -sin(k*a), cos(-k*a) = cos(k*a).
+    for (int k = 1; k <= kMaxMultiplier; ++k) {
+      sin_multiples[-k] = -sin_multiples[k];
+      cos_multiples[-k] = cos_multiples[k];
+    }
+  }
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -2,7 +2,7 @@
 //
 // SPDX-License-Identifier: MIT
 
-#include "astro_core/earth/internal/nutation_arguments.h"
+#include "astro_core/earth/nutation_arguments.h"
 
 #include "astro_core/unittest/test.h"
 
@@ -0,0 +1,78 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/nutation.h"
+
+#include <utility>
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/earth/intermediate_rotation.h"
+#include "astro_core/time/format/julian_date.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Calculate nutation at different times within a year from 2021-10-03.
+template <class... Args>
+void BenchmarkNutation00A(benchmark::State& state, Args&&... args) {
+  int i = 0;
+  for (auto _ : state) {
+    const JulianDate jd_tt(2459490.5, double(i++ % 365));
+    DoNotOptimize(CalculateNutation00A(jd_tt, std::forward<Args>(args)...));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+// Calculate the bias-precession-nutation matrix at different times within a
+// year from 2021-10-03.
+template <class... Args>
+void BenchmarkBiasPrecessionNutationRotation06A(benchmark::State& state,
+                                                Args&&... args) {
+  int i = 0;
+  for (auto _ : state) {
+    const JulianDate jd_tt(2459490.5, double(i++ % 365));
+    DoNotOptimize(BiasPrecessionNutationRotation06A(
+        jd_tt, std::forward<Args>(args)...));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+}  // namespace
+
+BENCHMARK(Nutation, CalculateNutation00A) { BenchmarkNutation00A(state); }
+
+BENCHMARK(Nutation, CalculateNutation00A_2000B) {
+  BenchmarkNutation00A(
+      state, NutationPrecision{.model = NutationPrecision::Model::k2000B});
+}
+
+BENCHMARK(Nutation, CalculateNutation00A_Truncated10uas) {
+  BenchmarkNutation00A(
+      state,
+      NutationPrecision{.model = NutationPrecision::Model::kTruncated,
+                        .amplitude_cutoff = 10});
+}
+
+BENCHMARK(Nutation, BiasPrecessionNutationRotation06A) {
+  BenchmarkBiasPrecessionNutationRotation06A(state);
+}
+
+BENCHMARK(Nutation, BiasPrecessionNutationRotation06A_2000B) {
+  BenchmarkBiasPrecessionNutationRotation06A(
+      state, NutationPrecision{.model = NutationPrecision::Model::k2000B});
+}
+
+BENCHMARK(Nutation, BiasPrecessionNutationRotation06A_Truncated10uas) {
+  BenchmarkBiasPrecessionNutationRotation06A(
+      state,
+      NutationPrecision{.model = NutationPrecision::Model::kTruncated,
+                        .amplitude_cutoff = 10});
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
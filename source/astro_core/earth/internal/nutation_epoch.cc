@@ -0,0 +1,30 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// References:
+//
+//   [IERS2010] Gerard Petit, and Brian Luzum, IERS Conventions (2010).
+
+#include "astro_core/earth/nutation_epoch.h"
+
+#include "astro_core/base/constants.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+NutationEpoch::NutationEpoch(const JulianDate& jd_tt)
+    : jd_tt_(jd_tt),
+      t_(CalculateT(jd_tt)),
+      lunisolar_arguments_(CalculateLunisolarNutationArguments(t_)),
+      planetary_arguments_(CalculatePlanetaryNutationArguments(t_)),
+      argument_multiples_(lunisolar_arguments_, planetary_arguments_) {}
+
+auto NutationEpoch::CalculateT(const JulianDate& jd_tt) -> double {
+  // [IERS2010] Page 45, Eq. (5.2).
+  return double((jd_tt - constants::kJulianDateEpochJ2000) /
+                constants::kNumDaysInJulianCentury);
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
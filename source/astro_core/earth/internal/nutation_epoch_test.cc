@@ -0,0 +1,91 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/nutation_epoch.h"
+
+#include "astro_core/earth/celestial_intermediate_pole.h"
+#include "astro_core/earth/intermediate_rotation.h"
+#include "astro_core/earth/nutation.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+TEST(NutationEpoch, Basic) {
+  // >>> from astropy.time import Time
+  // >>> time = Time('2021-10-08T00:00:00.000', format='isot', scale='utc')
+  // >>> t = (time.tt.jd1 - 2451545 + time.tt.jd2)/36525
+  // >>> time.tt.jd1, time.tt.jd2
+  // (2459496.0, -0.4991992592592593)
+  // >>> t
+  // 0.21767284875402437
+  const JulianDate jd_tt(2459496.0, -0.4991992592592593);
+
+  const NutationEpoch epoch(jd_tt);
+
+  EXPECT_EQ(epoch.GetJulianDate(), jd_tt);
+  EXPECT_NEAR(epoch.GetT(), 0.21767284875402437, 1e-16);
+
+  const LunisolarNutationArguments lunisolar_arguments =
+      CalculateLunisolarNutationArguments(epoch.GetT());
+  EXPECT_EQ(epoch.GetLunisolarArguments().l, lunisolar_arguments.l);
+  EXPECT_EQ(epoch.GetLunisolarArguments().Om, lunisolar_arguments.Om);
+
+  const PlanetaryNutationArguments planetary_arguments =
+      CalculatePlanetaryNutationArguments(epoch.GetT());
+  EXPECT_EQ(epoch.GetPlanetaryArguments().L_Me, planetary_arguments.L_Me);
+  EXPECT_EQ(epoch.GetPlanetaryArguments().p_A, planetary_arguments.p_A);
+}
+
+// All series evaluated from a single epoch match the values calculated from
+// the time point exactly.
+TEST(NutationEpoch, SharedBetweenSeries) {
+  const JulianDate jd_tt(2459496.0, -0.4991992592592593);
+
+  const NutationEpoch epoch(jd_tt);
+
+  const Vec2 cip_xy = CelestialIntermediatePole(epoch);
+  EXPECT_EQ(cip_xy, CelestialIntermediatePole(jd_tt));
+
+  EXPECT_EQ(CelestialIntermediateOriginLocator(epoch, cip_xy),
+            CelestialIntermediateOriginLocator(jd_tt, cip_xy));
+
+  EXPECT_EQ(CelestialToIntermediateFrameOfDateMatrix(epoch),
+            CelestialToIntermediateFrameOfDateMatrix(jd_tt));
+
+  const Nutation nutation00a = CalculateNutation00A(epoch);
+  EXPECT_EQ(nutation00a.dpsi, CalculateNutation00A(jd_tt).dpsi);
+  EXPECT_EQ(nutation00a.deps, CalculateNutation00A(jd_tt).deps);
+
+  const Nutation nutation06a = CalculateNutation06A(epoch);
+  EXPECT_EQ(nutation06a.dpsi, CalculateNutation06A(jd_tt).dpsi);
+  EXPECT_EQ(nutation06a.deps, CalculateNutation06A(jd_tt).deps);
+
+  EXPECT_EQ(BiasPrecessionNutationRotation06A(epoch),
+            BiasPrecessionNutationRotation06A(jd_tt));
+}
+
+// The IAU 2000B model calculated from the time point only uses the lunisolar
+// arguments, and matches the one calculated from the epoch exactly.
+TEST(NutationEpoch, SharedBetweenSeries2000B) {
+  const JulianDate jd_tt(2459496.0, -0.4991992592592593);
+  const NutationPrecision precision{.model = NutationPrecision::Model::k2000B};
+
+  const NutationEpoch epoch(jd_tt);
+
+  const Nutation nutation00b = CalculateNutation00A(epoch, precision);
+  EXPECT_EQ(nutation00b.dpsi, CalculateNutation00A(jd_tt, precision).dpsi);
+  EXPECT_EQ(nutation00b.deps, CalculateNutation00A(jd_tt, precision).deps);
+
+  const Nutation nutation06b = CalculateNutation06A(epoch, precision);
+  EXPECT_EQ(nutation06b.dpsi, CalculateNutation06A(jd_tt, precision).dpsi);
+  EXPECT_EQ(nutation06b.deps, CalculateNutation06A(jd_tt, precision).deps);
+
+  EXPECT_EQ(BiasPrecessionNutationRotation06A(epoch, precision),
+            BiasPrecessionNutationRotation06A(jd_tt, precision));
+
+  EXPECT_EQ(CelestialIntermediatePole(epoch, precision),
+            CelestialIntermediatePole(jd_tt, precision));
+}
+
+}  // namespace astro_core
@@ -0,0 +1,249 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/internal/nutation_series.h"
+
+#include <cstring>
+
+#include "astro_core/base/build_config.h"
+
+// The AVX2 kernel is compiled when the build targets AVX2, in which case it is
+// used unconditionally. Otherwise GCC and Clang compile it for the AVX2 target
+// separately from the rest of the file, and it is used when the CPU supports
+// AVX2 and FMA, which is checked at runtime.
+#if ARCH_CPU_X86_FAMILY && ISA_CPU_X86_AVX2
+#  include <immintrin.h>
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2 1
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2_DISPATCH 0
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2_TARGET
+#elif ARCH_CPU_X86_FAMILY && (COMPILER_GCC || COMPILER_CLANG)
+#  include <immintrin.h>
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2 1
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2_DISPATCH 1
+#  define ASTRO_CORE_NUTATION_SERIES_AVX2_TARGET                               \
+    __attribute__((target("avx2,fma")))
+#elif ARCH_CPU_ARM_FAMILY && ARCH_CPU_64_BITS && ISA_CPU_ARM_NEON
+#  include <arm_neon.h>
+#  define ASTRO_CORE_NUTATION_SERIES_NEON 1
+#endif
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace nutation_series_internal {
+
+// All implementations process a block of kSeriesBlockSize rows at a time.
+//
+// The sine and cosine of the argument of every row of the block are calculated
+// by rotating (0, 1) by the multiples of all fundamental arguments. The zero
+// multipliers rotate by the zero angle, which keeps the processing of a block
+// free from branches. The partial sums are kept per row of the block and are
+// added together at the end, in the same order in all implementations.
+
+auto SumSeriesTermsScalar(const SeriesTerms& terms,
+                          const NutationArgumentMultiples& multiples)
+    -> double {
+  double sum[kSeriesBlockSize] = {};
+
+  for (int row = 0; row < terms.num_rows; row += kSeriesBlockSize) {
+    double sin_arg[kSeriesBlockSize];
+    double cos_arg[kSeriesBlockSize];
+    for (int lane = 0; lane < kSeriesBlockSize; ++lane) {
+      sin_arg[lane] = 0;
+      cos_arg[lane] = 1;
+    }
+
+    for (int k = 0; k < NutationArgumentMultiples::kNumArguments; ++k) {
+      const int8_t* multipliers = terms.multipliers + k * terms.stride + row;
+      const double* sin_multiples = multiples.GetSinMultiples(k);
+      const double* cos_multiples = multiples.GetCosMultiples(k);
+
+      for (int lane = 0; lane < kSeriesBlockSize; ++lane) {
+        const double s = sin_multiples[multipliers[lane]];
+        const double c = cos_multiples[multipliers[lane]];
+
+        const double new_sin_arg = sin_arg[lane] * c + cos_arg[lane] * s;
+        cos_arg[lane] = cos_arg[lane] * c - sin_arg[lane] * s;
+        sin_arg[lane] = new_sin_arg;
+      }
+    }
+
+    for (int lane = 0; lane < kSeriesBlockSize; ++lane) {
+      sum[lane] += terms.sin_coefficients[row + lane] * sin_arg[lane] +
+                   terms.cos_coefficients[row + lane] * cos_arg[lane];
+    }
+  }
+
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+#if ASTRO_CORE_NUTATION_SERIES_AVX2
+
+static_assert(kSeriesBlockSize == 4);
+
+auto HasSumSeriesTermsAVX2() -> bool {
+#  if ASTRO_CORE_NUTATION_SERIES_AVX2_DISPATCH
+  static const bool has_avx2 =
+      __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return has_avx2;
+#  else
+  return true;
+#  endif
+}
+
+ASTRO_CORE_NUTATION_SERIES_AVX2_TARGET
+auto SumSeriesTermsAVX2(const SeriesTerms& terms,
+                        const NutationArgumentMultiples& multiples) -> double {
+  const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+  __m256d sum = _mm256_setzero_pd();
+
+  for (int row = 0; row < terms.num_rows; row += kSeriesBlockSize) {
+    __m256d sin_arg = _mm256_setzero_pd();
+    __m256d cos_arg = _mm256_set1_pd(1);
+
+    for (int k = 0; k < NutationArgumentMultiples::kNumArguments; ++k) {
+      int32_t packed_multipliers;
+      std::memcpy(&packed_multipliers,
+                  terms.multipliers + k * terms.stride + row,
+                  sizeof(packed_multipliers));
+      const __m128i multipliers =
+          _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed_multipliers));
+
+      // Use the masked gather with an explicit source, as the unmasked one
+      // triggers false-positive uninitialized variable warnings in GCC.
+      const __m256d s = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                                 multiples.GetSinMultiples(k),
+                                                 multipliers,
+                                                 all_lanes,
+                                                 sizeof(double));
+      const __m256d c = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                                 multiples.GetCosMultiples(k),
+                                                 multipliers,
+                                                 all_lanes,
+                                                 sizeof(double));
+
+      const __m256d new_sin_arg = _mm256_add_pd(_mm256_mul_pd(sin_arg, c),
+                                                _mm256_mul_pd(cos_arg, s));
+      cos_arg = _mm256_sub_pd(_mm256_mul_pd(cos_arg, c),
+                              _mm256_mul_pd(sin_arg, s));
+      sin_arg = new_sin_arg;
+    }
+
+    const __m256d sin_coefficients =
+        _mm256_loadu_pd(terms.sin_coefficients + row);
+    const __m256d cos_coefficients =
+        _mm256_loadu_pd(terms.cos_coefficients + row);
+
+    const __m256d terms_sum =
+        _mm256_add_pd(_mm256_mul_pd(sin_coefficients, sin_arg),
+                      _mm256_mul_pd(cos_coefficients, cos_arg));
+    sum = _mm256_add_pd(sum, terms_sum);
+  }
+
+  double lanes[kSeriesBlockSize];
+  _mm256_storeu_pd(lanes, sum);
+
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+#else
+
+auto HasSumSeriesTermsAVX2() -> bool { return false; }
+
+auto SumSeriesTermsAVX2(const SeriesTerms& terms,
+                        const NutationArgumentMultiples& multiples) -> double {
+  return SumSeriesTermsScalar(terms, multiples);
+}
+
+#endif
+
+#if ASTRO_CORE_NUTATION_SERIES_AVX2
+
+auto SumSeriesTerms(const SeriesTerms& terms,
+                    const NutationArgumentMultiples& multiples) -> double {
+#  if ASTRO_CORE_NUTATION_SERIES_AVX2_DISPATCH
+  if (!HasSumSeriesTermsAVX2()) {
+    return SumSeriesTermsScalar(terms, multiples);
+  }
+#  endif
+  return SumSeriesTermsAVX2(terms, multiples);
+}
+
+#elif ASTRO_CORE_NUTATION_SERIES_NEON
+
+static_assert(kSeriesBlockSize == 4);
+
+auto SumSeriesTerms(const SeriesTerms& terms,
+                    const NutationArgumentMultiples& multiples) -> double {
+  // The block is processed as two halves of two rows each.
+  float64x2_t sum_lo = vdupq_n_f64(0);
+  float64x2_t sum_hi = vdupq_n_f64(0);
+
+  for (int row = 0; row < terms.num_rows; row += kSeriesBlockSize) {
+    float64x2_t sin_arg_lo = vdupq_n_f64(0);
+    float64x2_t sin_arg_hi = vdupq_n_f64(0);
+    float64x2_t cos_arg_lo = vdupq_n_f64(1);
+    float64x2_t cos_arg_hi = vdupq_n_f64(1);
+
+    for (int k = 0; k < NutationArgumentMultiples::kNumArguments; ++k) {
+      const int8_t* multipliers = terms.multipliers + k * terms.stride + row;
+      const double* sin_multiples = multiples.GetSinMultiples(k);
+      const double* cos_multiples = multiples.GetCosMultiples(k);
+
+      const float64x2_t s_lo =
+          vcombine_f64(vld1_f64(sin_multiples + multipliers[0]),
+                       vld1_f64(sin_multiples + multipliers[1]));
+      const float64x2_t s_hi =
+          vcombine_f64(vld1_f64(sin_multiples + multipliers[2]),
+                       vld1_f64(sin_multiples + multipliers[3]));
+      const float64x2_t c_lo =
+          vcombine_f64(vld1_f64(cos_multiples + multipliers[0]),
+                       vld1_f64(cos_multiples + multipliers[1]));
+      const float64x2_t c_hi =
+          vcombine_f64(vld1_f64(cos_multiples + multipliers[2]),
+                       vld1_f64(cos_multiples + multipliers[3]));
+
+      const float64x2_t new_sin_arg_lo =
+          vaddq_f64(vmulq_f64(sin_arg_lo, c_lo), vmulq_f64(cos_arg_lo, s_lo));
+      const float64x2_t new_sin_arg_hi =
+          vaddq_f64(vmulq_f64(sin_arg_hi, c_hi), vmulq_f64(cos_arg_hi, s_hi));
+      cos_arg_lo =
+          vsubq_f64(vmulq_f64(cos_arg_lo, c_lo), vmulq_f64(sin_arg_lo, s_lo));
+      cos_arg_hi =
+          vsubq_f64(vmulq_f64(cos_arg_hi, c_hi), vmulq_f64(sin_arg_hi, s_hi));
+      sin_arg_lo = new_sin_arg_lo;
+      sin_arg_hi = new_sin_arg_hi;
+    }
+
+    const double* sin_coefficients = terms.sin_coefficients + row;
+    const double* cos_coefficients = terms.cos_coefficients + row;
+
+    sum_lo = vaddq_f64(
+        sum_lo,
+        vaddq_f64(vmulq_f64(vld1q_f64(sin_coefficients), sin_arg_lo),
+                  vmulq_f64(vld1q_f64(cos_coefficients), cos_arg_lo)));
+    sum_hi = vaddq_f64(
+        sum_hi,
+        vaddq_f64(vmulq_f64(vld1q_f64(sin_coefficients + 2), sin_arg_hi),
+                  vmulq_f64(vld1q_f64(cos_coefficients + 2), cos_arg_hi)));
+  }
+
+  return (vgetq_lane_f64(sum_lo, 0) + vgetq_lane_f64(sum_lo, 1)) +
+         (vgetq_lane_f64(sum_hi, 0) + vgetq_lane_f64(sum_hi, 1));
+}
+
+#else
+
+auto SumSeriesTerms(const SeriesTerms& terms,
+                    const NutationArgumentMultiples& multiples) -> double {
+  return SumSeriesTermsScalar(terms, multiples);
+}
+
+#endif
+
+}  // namespace nutation_series_internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,365 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Common building blocks for evaluation of the IERS series which are based on
+// the fundamental arguments of nutation: tables 5.2a, 5.2b, 5.2d, 5.3a, 5.3b.
+//
+// The IERS tables are stored as an array of rows, each row having 14 integer
+// multipliers of the fundamental arguments and two coefficients. For the
+// evaluation the tables are converted at compile time to a structure of arrays
+// (SeriesColumns) with 8-bit multipliers and contiguous coefficients, which is
+// processed by a kernel which evaluates multiple rows at once using the SIMD
+// instructions: AVX2 on x86, NEON on 64-bit ARM, with a portable scalar
+// fallback.
+//
+// The NEON kernel is used by all 64-bit ARM builds. The AVX2 kernel is used by
+// the x86 builds which target AVX2 (for example, with -mavx2 -mfma), and by the
+// x86 builds with GCC or Clang for other targets when the CPU supports AVX2 and
+// FMA, which is checked at runtime. Other x86 builds (MSVC without /arch:AVX2)
+// use the scalar kernel.
+//
+// References:
+//
+//   [IERS2010] Gerard Petit, and Brian Luzum, IERS Conventions (2010).
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "astro_core/earth/nutation_arguments.h"
+#include "astro_core/earth/nutation_epoch.h"
+#include "astro_core/earth/nutation_precision.h"
+#include "astro_core/math/math.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace nutation_series_internal {
+
+// Get multipliers of the fundamental arguments of the given table row, in the
+// order of the NutationArgumentMultiples.
+template <class Row>
+constexpr auto GetArgumentMultipliers(const Row& row)
+    -> std::array<int, NutationArgumentMultiples::kNumArguments> {
+  return {row.l,
+          row.l_prime,
+          row.F,
+          row.D,
+          row.Om,
+          row.L_Me,
+          row.L_Ve,
+          row.L_E,
+          row.L_Ma,
+          row.L_J,
+          row.L_Sa,
+          row.L_U,
+          row.L_Ne,
+          row.p_A};
+}
+
+// Get the largest absolute value of a multiplier in the given table rows.
+template <class Row>
+constexpr auto GetMaxArgumentMultiplier(const std::span<const Row> rows)
+    -> int {
+  int max_multiplier = 0;
+  for (const Row& row : rows) {
+    for (const int multiplier : GetArgumentMultipliers(row)) {
+      const int abs_multiplier = multiplier < 0 ? -multiplier : multiplier;
+      max_multiplier =
+          abs_multiplier > max_multiplier ? abs_multiplier : max_multiplier;
+    }
+  }
+  return max_multiplier;
+}
+
+// Calculate argument for the given row of a table.
+// It is referred to as ARGUMENT in [IERS2010] Page 54, Eq. (5.16) and Page 62,
+// Eq. (5.35).
+//
+// This is a straightforward calculation which is used as a reference for the
+// CalculateSinCosOfArgument().
+template <class Row>
+auto CalculateArgument(const Row& row, const NutationEpoch& epoch) -> double {
+  const LunisolarNutationArguments& lunisolar_nutation_arguments =
+      epoch.GetLunisolarArguments();
+  const PlanetaryNutationArguments& planetary_nutation_arguments =
+      epoch.GetPlanetaryArguments();
+
+  double arg = 0;
+
+  // Lunisolar nutation arguments.
+  arg += row.l * lunisolar_nutation_arguments.l;
+  arg += row.l_prime * lunisolar_nutation_arguments.l_prime;
+  arg += row.F * lunisolar_nutation_arguments.F;
+  arg += row.D * lunisolar_nutation_arguments.D;
+  arg += row.Om * lunisolar_nutation_arguments.Om;
+
+  // Planetary nutation arguments.
+  arg += row.L_Me * planetary_nutation_arguments.L_Me;
+  arg += row.L_Ve * planetary_nutation_arguments.L_Ve;
+  arg += row.L_E * planetary_nutation_arguments.L_E;
+  arg += row.L_Ma * planetary_nutation_arguments.L_Ma;
+  arg += row.L_J * planetary_nutation_arguments.L_J;
+  arg += row.L_Sa * planetary_nutation_arguments.L_Sa;
+  arg += row.L_U * planetary_nutation_arguments.L_U;
+  arg += row.L_Ne * planetary_nutation_arguments.L_Ne;
+  arg += row.p_A * planetary_nutation_arguments.p_A;
+
+  return arg;
+}
+
+// Calculate sine and cosine of the argument of the given row of a table.
+//
+// The argument is a sum of the multiples of the fundamental arguments, so its
+// sine and cosine are calculated from the sine and cosine of the multiples
+// using the angle addition formulas.
+template <class Row>
+inline auto CalculateSinCosOfArgument(const Row& row,
+                                      const NutationEpoch& epoch)
+    -> NutationArgumentMultiples::SinCos {
+  const NutationArgumentMultiples& multiples = epoch.GetArgumentMultiples();
+  const std::array<int, NutationArgumentMultiples::kNumArguments> multipliers =
+      GetArgumentMultipliers(row);
+
+  double sin_arg = 0;
+  double cos_arg = 1;
+  for (int i = 0; i < NutationArgumentMultiples::kNumArguments; ++i) {
+    if (multipliers[i] == 0) {
+      continue;
+    }
+
+    const NutationArgumentMultiples::SinCos sin_cos =
+        multiples.Get(i, multipliers[i]);
+
+    const double new_sin_arg = sin_arg * sin_cos.cos + cos_arg * sin_cos.sin;
+    cos_arg = cos_arg * sin_cos.cos - sin_arg * sin_cos.sin;
+    sin_arg = new_sin_arg;
+  }
+
+  return {sin_arg, cos_arg};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Structure-of-arrays representation of the series.
+
+static_assert(NutationArgumentMultiples::kMaxMultiplier <= INT8_MAX);
+
+// Number of rows the kernel processes at once. The rows of every power of t in
+// the SeriesColumns are padded to a multiple of this number.
+inline constexpr int kSeriesBlockSize = 4;
+
+// Rows of an IERS table in the structure-of-arrays layout.
+//
+// The rows of the j-th power of t are stored at indices within the
+// [power_offsets[j], power_offsets[j + 1]) range, sorted by their amplitude in
+// the ascending order. The padding rows are stored first, they have zero
+// multipliers and coefficients, and do not contribute to the sum.
+template <int kNumRows, int kNumPowers>
+struct SeriesColumns {
+  static_assert(kNumRows % kSeriesBlockSize == 0);
+
+  // Multipliers of the fundamental arguments, as [argument][row].
+  std::array<int8_t, NutationArgumentMultiples::kNumArguments * kNumRows>
+      multipliers{};
+
+  // Coefficients of the sine and cosine of the argument of every row.
+  std::array<double, kNumRows> sin_coefficients{};
+  std::array<double, kNumRows> cos_coefficients{};
+
+  // Amplitude of every row: the sum of the absolute values of its
+  // coefficients, which is an upper bound of the magnitude of the term.
+  std::array<double, kNumRows> amplitudes{};
+
+  std::array<int, kNumPowers + 1> power_offsets{};
+};
+
+// Get the number of rows of the SeriesColumns for the given table, including
+// the padding rows.
+template <class Row, size_t N>
+constexpr auto GetNumSeriesColumnsRows(
+    const std::array<std::span<const Row>, N>& table) -> int {
+  int num_rows = 0;
+  for (const std::span<const Row>& rows : table) {
+    num_rows += (int(rows.size()) + kSeriesBlockSize - 1) / kSeriesBlockSize *
+                kSeriesBlockSize;
+  }
+  return num_rows;
+}
+
+// Convert an IERS table which is split into the powers of t to the
+// structure-of-arrays layout. The coefficients of the sine and cosine of the
+// argument are given as pointers to the members of the Row.
+//
+// The rows of every power of t are sorted by the amplitude in the ascending
+// order, to handle small values first.
+template <auto& kTable, auto kSinCoefficient, auto kCosCoefficient>
+constexpr auto MakeSeriesColumns() {
+  constexpr int kNumRows = GetNumSeriesColumnsRows(kTable);
+  constexpr int kNumPowers = kTable.size();
+
+  using Row = typename std::remove_cvref_t<decltype(kTable[0])>::value_type;
+
+  const auto get_amplitude = [](const Row& row) {
+    const double sin_coefficient = row.*kSinCoefficient;
+    const double cos_coefficient = row.*kCosCoefficient;
+    return (sin_coefficient < 0 ? -sin_coefficient : sin_coefficient) +
+           (cos_coefficient < 0 ? -cos_coefficient : cos_coefficient);
+  };
+
+  SeriesColumns<kNumRows, kNumPowers> columns;
+
+  int row_index = 0;
+  for (int j = 0; j < kNumPowers; ++j) {
+    const std::span<const Row> rows = kTable[j];
+
+    columns.power_offsets[j] = row_index;
+
+    // Skip the padding rows, which are zero-initialized.
+    row_index += (kSeriesBlockSize - int(rows.size()) % kSeriesBlockSize) %
+                 kSeriesBlockSize;
+
+    // Sort the rows by the amplitude. The rows of the same amplitude are kept
+    // in the reverse order of the table.
+    std::vector<int> order(rows.size());
+    for (int i = 0; i < int(rows.size()); ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](const int a, const int b) {
+      const double amplitude_a = get_amplitude(rows[a]);
+      const double amplitude_b = get_amplitude(rows[b]);
+      if (amplitude_a != amplitude_b) {
+        return amplitude_a < amplitude_b;
+      }
+      return a > b;
+    });
+
+    for (const int i : order) {
+      const Row& row = rows[i];
+
+      const std::array<int, NutationArgumentMultiples::kNumArguments>
+          multipliers = GetArgumentMultipliers(row);
+      for (int k = 0; k < NutationArgumentMultiples::kNumArguments; ++k) {
+        columns.multipliers[k * kNumRows + row_index] = int8_t(multipliers[k]);
+      }
+
+      columns.sin_coefficients[row_index] = row.*kSinCoefficient;
+      columns.cos_coefficients[row_index] = row.*kCosCoefficient;
+      columns.amplitudes[row_index] = get_amplitude(row);
+
+      ++row_index;
+    }
+  }
+  columns.power_offsets[kNumPowers] = row_index;
+
+  return columns;
+}
+
+// Get the amplitude cutoff of the series terms for the given precision, in
+// microarcseconds.
+inline auto GetSeriesAmplitudeCutoff(const NutationPrecision& precision)
+    -> double {
+  if (precision.model == NutationPrecision::Model::kTruncated) {
+    return precision.amplitude_cutoff;
+  }
+  return 0;
+}
+
+// A range of rows of the SeriesColumns.
+struct SeriesTerms {
+  // Multiplier of the argument k of the row i is multipliers[k * stride + i].
+  const int8_t* multipliers;
+  int stride;
+
+  const double* sin_coefficients;
+  const double* cos_coefficients;
+
+  // The number of rows is a multiple of the kSeriesBlockSize.
+  int num_rows;
+};
+
+// Calculate sum of the terms
+//
+//   sin_coefficient * sin(ARGUMENT) + cos_coefficient * cos(ARGUMENT)
+//
+// over all rows of the given range.
+//
+// Uses the SIMD instructions available on the target.
+auto SumSeriesTerms(const SeriesTerms& terms,
+                    const NutationArgumentMultiples& multiples) -> double;
+
+// Portable implementation of the SumSeriesTerms(). The result is the same as
+// of the SumSeriesTerms() up to the round-off error.
+auto SumSeriesTermsScalar(const SeriesTerms& terms,
+                          const NutationArgumentMultiples& multiples)
+    -> double;
+
+// True if the AVX2 implementation of the SumSeriesTerms() is compiled in this
+// build and is supported by the CPU.
+auto HasSumSeriesTermsAVX2() -> bool;
+
+// AVX2 implementation of the SumSeriesTerms(). The result is the same as of the
+// SumSeriesTermsScalar() up to the round-off error.
+//
+// Is only to be called when the HasSumSeriesTermsAVX2() is true.
+auto SumSeriesTermsAVX2(const SeriesTerms& terms,
+                        const NutationArgumentMultiples& multiples) -> double;
+
+// Evaluate the series given in the structure-of-arrays layout:
+//
+//   sum_j t^j * sum_i (sin_coefficient_i_j * sin(ARGUMENT_i_j) +
+//                      cos_coefficient_i_j * cos(ARGUMENT_i_j))
+//
+// The rows with amplitude below the given cutoff are ignored. Some rows below
+// the cutoff might still be included to keep the rows aligned to the blocks
+// of the kernel. The cutoff is in the units of the coefficients.
+//
+// The result is in the units of the coefficients.
+template <int kNumRows, int kNumPowers>
+auto EvaluateSeries(const SeriesColumns<kNumRows, kNumPowers>& columns,
+                    const NutationEpoch& epoch,
+                    const double amplitude_cutoff = 0) -> double {
+  const double t = epoch.GetT();
+  const NutationArgumentMultiples& multiples = epoch.GetArgumentMultiples();
+
+  double sum = 0;
+
+  // Reverse order to handle small values first.
+  for (int j = kNumPowers - 1; j >= 0; --j) {
+    const int end = columns.power_offsets[j + 1];
+
+    int begin = columns.power_offsets[j];
+    if (amplitude_cutoff > 0) {
+      const double* amplitudes = columns.amplitudes.data();
+      const int first_row = int(std::lower_bound(amplitudes + begin,
+                                                 amplitudes + end,
+                                                 amplitude_cutoff) -
+                                amplitudes);
+      begin += (first_row - begin) / kSeriesBlockSize * kSeriesBlockSize;
+    }
+
+    const SeriesTerms terms = {
+        .multipliers = columns.multipliers.data() + begin,
+        .stride = kNumRows,
+        .sin_coefficients = columns.sin_coefficients.data() + begin,
+        .cos_coefficients = columns.cos_coefficients.data() + begin,
+        .num_rows = end - begin,
+    };
+
+    sum += SumSeriesTerms(terms, multiples) * Pow(t, j);
+  }
+
+  return sum;
+}
+
+}  // namespace nutation_series_internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,185 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/earth/internal/nutation_series.h"
+
+#include "astro_core/earth/internal/iers/tab5.2a.h"
+#include "astro_core/earth/internal/iers/tab5.2b.h"
+#include "astro_core/earth/internal/iers/tab5.2d.h"
+#include "astro_core/earth/internal/iers/tab5.3a.h"
+#include "astro_core/earth/internal/iers/tab5.3b.h"
+#include "astro_core/math/math.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+using nutation_series_internal::CalculateArgument;
+using nutation_series_internal::CalculateSinCosOfArgument;
+using nutation_series_internal::EvaluateSeries;
+using nutation_series_internal::MakeSeriesColumns;
+using nutation_series_internal::SeriesTerms;
+using nutation_series_internal::HasSumSeriesTermsAVX2;
+using nutation_series_internal::SumSeriesTerms;
+using nutation_series_internal::SumSeriesTermsAVX2;
+using nutation_series_internal::SumSeriesTermsScalar;
+
+namespace {
+
+// Check that the sine and cosine of the argument of every row of the table
+// match the straightforward calculation.
+template <class Row, size_t N>
+void ExpectSinCosOfArgumentsNear(const std::array<Row, N>& rows,
+                                 const NutationEpoch& epoch) {
+  for (const Row& row : rows) {
+    const double arg = CalculateArgument(row, epoch);
+    const NutationArgumentMultiples::SinCos sin_cos =
+        CalculateSinCosOfArgument(row, epoch);
+
+    EXPECT_NEAR(sin_cos.sin, Sin(arg), 1e-12);
+    EXPECT_NEAR(sin_cos.cos, Cos(arg), 1e-12);
+  }
+}
+
+// Straightforward evaluation of the series, used as a reference.
+template <class Row, size_t N>
+auto EvaluateSeriesReference(const std::array<std::span<const Row>, N>& table,
+                             double Row::*sin_coefficient,
+                             double Row::*cos_coefficient,
+                             const NutationEpoch& epoch) -> double {
+  double sum = 0;
+  for (int j = 0; j < N; ++j) {
+    for (const Row& row : table[j]) {
+      const double arg = CalculateArgument(row, epoch);
+      sum += (row.*sin_coefficient * Sin(arg) +
+              row.*cos_coefficient * Cos(arg)) *
+             Pow(epoch.GetT(), j);
+    }
+  }
+  return sum;
+}
+
+// Check that the series evaluated from the structure-of-arrays layout matches
+// the straightforward evaluation, and that the SIMD and scalar kernels agree.
+template <auto& kTable, auto kSinCoefficient, auto kCosCoefficient>
+void ExpectSeriesNear(const NutationEpoch& epoch) {
+  static constexpr auto kColumns =
+      MakeSeriesColumns<kTable, kSinCoefficient, kCosCoefficient>();
+
+  // The series are in microarcseconds, the tolerance corresponds to about
+  // 5e-18 radians.
+  EXPECT_NEAR(EvaluateSeries(kColumns, epoch),
+              EvaluateSeriesReference(
+                  kTable, kSinCoefficient, kCosCoefficient, epoch),
+              1e-6);
+
+  const SeriesTerms terms = {
+      .multipliers = kColumns.multipliers.data(),
+      .stride = int(kColumns.sin_coefficients.size()),
+      .sin_coefficients = kColumns.sin_coefficients.data(),
+      .cos_coefficients = kColumns.cos_coefficients.data(),
+      .num_rows = int(kColumns.sin_coefficients.size()),
+  };
+  EXPECT_NEAR(SumSeriesTerms(terms, epoch.GetArgumentMultiples()),
+              SumSeriesTermsScalar(terms, epoch.GetArgumentMultiples()),
+              1e-8);
+
+  // The AVX2 kernel is not necessarily the one used by the SumSeriesTerms(), as
+  // it depends on the CPU.
+  if (HasSumSeriesTermsAVX2()) {
+    EXPECT_NEAR(SumSeriesTermsAVX2(terms, epoch.GetArgumentMultiples()),
+                SumSeriesTermsScalar(terms, epoch.GetArgumentMultiples()),
+                1e-8);
+  }
+}
+
+}  // namespace
+
+TEST(NutationArgumentMultiples, Get) {
+  const NutationEpoch epoch(JulianDate(2459496.0, -0.4991992592592593));
+
+  const LunisolarNutationArguments& lunisolar = epoch.GetLunisolarArguments();
+  const PlanetaryNutationArguments& planetary = epoch.GetPlanetaryArguments();
+  const NutationArgumentMultiples& multiples = epoch.GetArgumentMultiples();
+
+  for (int k = -NutationArgumentMultiples::kMaxMultiplier;
+       k <= NutationArgumentMultiples::kMaxMultiplier;
+       ++k) {
+    EXPECT_NEAR(multiples.Get(0, k).sin, Sin(k * lunisolar.l), 1e-13);
+    EXPECT_NEAR(multiples.Get(0, k).cos, Cos(k * lunisolar.l), 1e-13);
+
+    EXPECT_NEAR(multiples.Get(4, k).sin, Sin(k * lunisolar.Om), 1e-13);
+    EXPECT_NEAR(multiples.Get(4, k).cos, Cos(k * lunisolar.Om), 1e-13);
+
+    EXPECT_NEAR(multiples.Get(13, k).sin, Sin(k * planetary.p_A), 1e-13);
+    EXPECT_NEAR(multiples.Get(13, k).cos, Cos(k * planetary.p_A), 1e-13);
+  }
+}
+
+TEST(NutationSeries, CalculateSinCosOfArgument) {
+  // Time points within a few centuries around J2000.
+  for (const double t : {-3.0, -1.0, -0.1, 0.0, 0.2176728487540243, 1.0, 3.0}) {
+    const NutationEpoch epoch(JulianDate(2451545.0, t * 36525.0));
+
+    ExpectSinCosOfArgumentsNear(iers::table::Table52aFlat, epoch);
+    ExpectSinCosOfArgumentsNear(iers::table::Table52bFlat, epoch);
+    ExpectSinCosOfArgumentsNear(iers::table::Table52dFlat, epoch);
+    ExpectSinCosOfArgumentsNear(iers::table::Table53aFlat, epoch);
+    ExpectSinCosOfArgumentsNear(iers::table::Table53bFlat, epoch);
+  }
+}
+
+TEST(NutationSeries, SeriesColumns) {
+  using iers::table::Table52a;
+  using iers::table::Table52aRow;
+
+  static constexpr auto kColumns =
+      MakeSeriesColumns<Table52a,
+                        &Table52aRow::a_s_j_i,
+                        &Table52aRow::a_c_j_i>();
+
+  // Rows of every power of t are padded to the block size and sorted by the
+  // amplitude.
+  for (int j = 0; j < Table52a.size(); ++j) {
+    const int begin = kColumns.power_offsets[j];
+    const int end = kColumns.power_offsets[j + 1];
+
+    EXPECT_EQ(begin % nutation_series_internal::kSeriesBlockSize, 0);
+    EXPECT_GE(end - begin, Table52a[j].size());
+    EXPECT_LT(end - begin,
+              Table52a[j].size() + nutation_series_internal::kSeriesBlockSize);
+
+    for (int i = begin + 1; i < end; ++i) {
+      EXPECT_LE(kColumns.amplitudes[i - 1], kColumns.amplitudes[i]);
+    }
+
+    // The first row of every power in the IERS table has the largest
+    // amplitude.
+    EXPECT_EQ(kColumns.sin_coefficients[end - 1], Table52a[j][0].a_s_j_i);
+    EXPECT_EQ(kColumns.cos_coefficients[end - 1], Table52a[j][0].a_c_j_i);
+    EXPECT_EQ(kColumns.multipliers[end - 1], Table52a[j][0].l);
+  }
+}
+
+TEST(NutationSeries, EvaluateSeries) {
+  using namespace iers::table;
+
+  for (const double t : {-3.0, -1.0, -0.1, 0.0, 0.2176728487540243, 1.0, 3.0}) {
+    const NutationEpoch epoch(JulianDate(2451545.0, t * 36525.0));
+
+    ExpectSeriesNear<Table52a, &Table52aRow::a_s_j_i, &Table52aRow::a_c_j_i>(
+        epoch);
+    ExpectSeriesNear<Table52b, &Table52bRow::b_s_j_i, &Table52bRow::b_c_j_i>(
+        epoch);
+    ExpectSeriesNear<Table52d, &Table52dRow::c_s_j_i, &Table52dRow::c_c_j_i>(
+        epoch);
+    ExpectSeriesNear<Table53a,
+                     &Table53aRow::Arg_i_sin,
+                     &Table53aRow::Arg_i_cos>(epoch);
+    ExpectSeriesNear<Table53b,
+                     &Table53bRow::Arg_i_sin,
+                     &Table53bRow::Arg_i_cos>(epoch);
+  }
+}
+
+}  // namespace astro_core
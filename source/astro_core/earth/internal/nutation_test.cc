@@ -4,6 +4,8 @@
 
 #include "astro_core/earth/nutation.h"
 
+#include "astro_core/earth/nutation_epoch.h"
+#include "astro_core/math/math.h"
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/unittest/test.h"
 
@@ -51,4 +53,33 @@ TEST(earth, CalculateNutation06) {
   EXPECT_NEAR(nutation.deps, 0.000022442392475763, 1e-16);
 }
 
+// Accuracy of the approximate models compared to the complete model within the
+// 1900-2100 time range.
+TEST(earth, CalculateNutation06Precision) {
+  using Model = NutationPrecision::Model;
+
+  const auto expect_near_full = [](const NutationPrecision& precision,
+                                   const double tolerance_in_arcsec) {
+    const double tolerance = ArcsecToRadians(tolerance_in_arcsec);
+
+    for (int i = -100; i <= 100; ++i) {
+      const NutationEpoch epoch(JulianDate(2451545.0, i * 365.25 + 0.37 * i));
+
+      const Nutation full = CalculateNutation06A(epoch);
+      const Nutation nutation = CalculateNutation06A(epoch, precision);
+
+      EXPECT_NEAR(nutation.dpsi, full.dpsi, tolerance);
+      EXPECT_NEAR(nutation.deps, full.deps, tolerance);
+    }
+  };
+
+  expect_near_full({.model = Model::kFull}, 0);
+  expect_near_full({.model = Model::k2000B}, 2.5e-3);
+  expect_near_full({.model = Model::kTruncated, .amplitude_cutoff = 1}, 30e-6);
+  expect_near_full({.model = Model::kTruncated, .amplitude_cutoff = 10},
+                   0.25e-3);
+  expect_near_full({.model = Model::kTruncated, .amplitude_cutoff = 100},
+                   1.1e-3);
+}
+
 }  // namespace astro_core
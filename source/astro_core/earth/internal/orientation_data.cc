@@ -14,8 +14,13 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 // Hide the implementation, so that it is possible to only have forward
 // declaration of Table in the header.
 EarthOrientationData::EarthOrientationData() = default;
+EarthOrientationData::EarthOrientationData(
+    EarthOrientationData&& other) noexcept = default;
 EarthOrientationData::~EarthOrientationData() = default;
 
+auto EarthOrientationData::operator=(EarthOrientationData&& other) noexcept
+    -> EarthOrientationData& = default;
+
 void EarthOrientationData::SetTable(Table&& table) {
   shared_table_.Set(std::move(table));
 }
@@ -4,6 +4,9 @@
 
 #include "astro_core/earth/orientation_table.h"
 
+#include <algorithm>
+
+#include "astro_core/math/math.h"
 #include "astro_core/table/lookup.h"
 
 namespace astro_core {
@@ -14,6 +17,67 @@ void EarthOrientationTable::Preprocess() {
   std::sort(table_.begin(),
             table_.end(),
             [](const Row& a, const Row& b) -> bool { return a.mjd < b.mjd; });
+
+  rows_.assign(table_.begin(), table_.end());
+
+  // Detect the uniform grid of rows.
+  grid_start_mjd_ = DoubleDouble(0);
+  grid_step_ = 0;
+  if (rows_.size() < 2) {
+    return;
+  }
+
+  const DoubleDouble step =
+      DoubleDouble(rows_[1].mjd) - DoubleDouble(rows_[0].mjd);
+  if (!(double(step) > 0)) {
+    return;
+  }
+  for (int i = 2; i < rows_.size(); ++i) {
+    if (DoubleDouble(rows_[i].mjd) - DoubleDouble(rows_[i - 1].mjd) != step) {
+      return;
+    }
+  }
+
+  grid_start_mjd_ = DoubleDouble(rows_[0].mjd);
+  grid_step_ = double(step);
+}
+
+auto EarthOrientationTable::GetInterpolationRows(
+    const ModifiedJulianDate& mjd) const -> std::span<const Row> {
+  const int num_rows = rows_.size();
+
+  // Index of the first row with the MJD which is not less than the given one,
+  // the same as the std::lower_bound().
+  int upper_index;
+
+  if (grid_step_ != 0) {
+    // Guess the index from the grid, and correct it for the possible round-off
+    // errors of the guess.
+    const double offset =
+        double(DoubleDouble(mjd) - grid_start_mjd_) / grid_step_;
+    upper_index = int(Ceil(std::clamp(offset, 0.0, double(num_rows))));
+
+    while (upper_index < num_rows && rows_[upper_index].mjd < mjd) {
+      ++upper_index;
+    }
+    while (upper_index > 0 && !(rows_[upper_index - 1].mjd < mjd)) {
+      --upper_index;
+    }
+  } else {
+    const auto upper_it = std::lower_bound(
+        rows_.begin(),
+        rows_.end(),
+        mjd,
+        [](const Row& row, const ModifiedJulianDate& bound_mjd) {
+          return row.mjd < bound_mjd;
+        });
+    upper_index = upper_it - rows_.begin();
+  }
+
+  const int begin = std::max(upper_index - 1, 0);
+  const int end = std::min(upper_index + 1, num_rows);
+
+  return std::span<const Row>(rows_).subspan(begin, end - begin);
 }
 
 auto EarthOrientationTable::LookupUT1MinusUTCSecondsInUTCScale(
@@ -22,6 +86,12 @@ auto EarthOrientationTable::LookupUT1MinusUTCSecondsInUTCScale(
     return 0;
   }
 
+  // The table has been modified after Preprocess().
+  if (rows_.size() != table_.size()) {
+    return LinearInterpolate<&Row::mjd, &Row::ut1_minus_utc, DoubleDouble>(
+        table_, mjd);
+  }
+
   // Perform linear interpolation. This is also how it is done in Astropy 5.1
   // (which follows TEMOPO).
   //
@@ -32,8 +102,8 @@ auto EarthOrientationTable::LookupUT1MinusUTCSecondsInUTCScale(
   //       Revised version of the IERS Gazette No 13, 29 January 1997
   //       https://hpiers.obspm.fr/iers/models/interp.readme
 
-  return LinearInterpolate<&Row::mjd, &Row::ut1_minus_utc, DoubleDouble>(table_,
-                                                                         mjd);
+  return LinearInterpolate<&Row::mjd, &Row::ut1_minus_utc, DoubleDouble>(
+      GetInterpolationRows(mjd), mjd);
 }
 
 auto EarthOrientationTable::LookupPolarMotionArcsecInUTCScale(
@@ -42,6 +112,12 @@ auto EarthOrientationTable::LookupPolarMotionArcsecInUTCScale(
     return {0, 0};
   }
 
+  // The table has been modified after Preprocess().
+  if (rows_.size() != table_.size()) {
+    return LinearInterpolate<&Row::mjd, &Row::polar_motion, DoubleDouble>(
+        table_, mjd);
+  }
+
   // Perform linear interpolation. This is also how it is done in Astropy 5.1
   // (which follows TEMOPO).
   //
@@ -52,8 +128,8 @@ auto EarthOrientationTable::LookupPolarMotionArcsecInUTCScale(
   //       Revised version of the IERS Gazette No 13, 29 January 1997
   //       https://hpiers.obspm.fr/iers/models/interp.readme
 
-  return LinearInterpolate<&Row::mjd, &Row::polar_motion, DoubleDouble>(table_,
-                                                                        mjd);
+  return LinearInterpolate<&Row::mjd, &Row::polar_motion, DoubleDouble>(
+      GetInterpolationRows(mjd), mjd);
 }
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -4,7 +4,10 @@
 
 #include "astro_core/earth/orientation_table.h"
 
+#include <vector>
+
 #include "astro_core/earth/internal/orientation_test_data.h"
+#include "astro_core/math/math.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
 
@@ -133,4 +136,91 @@ TEST(EarthOrientationTable, LookupPolarMotionArcsecInUTCScale) {
       Pointwise(DoubleNear(1e-12), {0.305032, 0.395644}));
 }
 
+namespace {
+
+// Lookup values in the preprocessed table, and in the table with the same rows
+// added in the sorted order without preprocessing, which uses the binary search
+// in the rows. The result of the lookups is expected to be exactly the same.
+void ExpectSameLookupAsNonPreprocessed(const std::vector<double>& row_mjds,
+                                       const double min_mjd,
+                                       const double max_mjd) {
+  EarthOrientationTable table;
+  EarthOrientationTable non_preprocessed_table;
+
+  // Add rows in the reverse order to the preprocessed table, so that it needs
+  // to be sorted.
+  for (int i = row_mjds.size() - 1; i >= 0; --i) {
+    table.AddRow(ModifiedJulianDate(row_mjds[i]),
+                 Vec2(0.1 + i * 0.001, 0.3 - i * 0.002),
+                 0.2 + Sin(double(i)));
+  }
+  table.Preprocess();
+
+  for (int i = 0; i < row_mjds.size(); ++i) {
+    non_preprocessed_table.AddRow(ModifiedJulianDate(row_mjds[i]),
+                                  Vec2(0.1 + i * 0.001, 0.3 - i * 0.002),
+                                  0.2 + Sin(double(i)));
+  }
+
+  auto expect_same_lookup = [&](const ModifiedJulianDate& mjd) {
+    EXPECT_EQ(table.LookupUT1MinusUTCSecondsInUTCScale(mjd),
+              non_preprocessed_table.LookupUT1MinusUTCSecondsInUTCScale(mjd))
+        << "MJD " << mjd;
+    EXPECT_EQ(table.LookupPolarMotionArcsecInUTCScale(mjd),
+              non_preprocessed_table.LookupPolarMotionArcsecInUTCScale(mjd))
+        << "MJD " << mjd;
+  };
+
+  // Exactly at the rows, and in-between of them.
+  for (const double mjd : row_mjds) {
+    expect_same_lookup(ModifiedJulianDate(mjd));
+    expect_same_lookup(ModifiedJulianDate(mjd, 0.25));
+    expect_same_lookup(ModifiedJulianDate(mjd, -1e-9));
+    expect_same_lookup(ModifiedJulianDate(mjd, 1e-9));
+  }
+
+  // Dense sampling of the entire range, including the dates outside of the
+  // table.
+  for (double mjd = min_mjd; mjd <= max_mjd; mjd += 0.37) {
+    expect_same_lookup(ModifiedJulianDate(mjd));
+  }
+}
+
+}  // namespace
+
+TEST(EarthOrientationTable, UniformGridLookup) {
+  std::vector<double> row_mjds;
+  for (int i = 0; i < 1000; ++i) {
+    row_mjds.push_back(50000 + i);
+  }
+
+  ExpectSameLookupAsNonPreprocessed(row_mjds, 49990, 51010);
+}
+
+TEST(EarthOrientationTable, IrregularGridLookup) {
+  std::vector<double> row_mjds;
+  double mjd = 50000;
+  for (int i = 0; i < 1000; ++i) {
+    row_mjds.push_back(mjd);
+    mjd += 1 + (i % 3) * 0.5;
+  }
+
+  ExpectSameLookupAsNonPreprocessed(row_mjds, 49990, mjd + 10);
+}
+
+TEST(EarthOrientationTable, ModifiedAfterPreprocess) {
+  EarthOrientationTable table;
+  table.AddRow(ModifiedJulianDate(50000), Vec2(0, 0), 0.0);
+  table.AddRow(ModifiedJulianDate(50001), Vec2(0, 0), 1.0);
+  table.Preprocess();
+
+  EXPECT_EQ(
+      table.LookupUT1MinusUTCSecondsInUTCScale(ModifiedJulianDate(50002)), 1.0);
+
+  // The rows added after the preprocessing are still visible to the lookup.
+  table.AddRow(ModifiedJulianDate(50002), Vec2(0, 0), 2.0);
+  EXPECT_EQ(
+      table.LookupUT1MinusUTCSecondsInUTCScale(ModifiedJulianDate(50002)), 2.0);
+}
+
 }  // namespace astro_core
@@ -7,15 +7,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <mutex>
 
 #include "astro_core/table/shared_table.h"
+#include "astro_core/time/format/modified_julian_date.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
-class ModifiedJulianDate;
 class LeapSecondTable;
 
 class LeapSecondData {
@@ -23,8 +27,11 @@ class LeapSecondData {
   using Table = LeapSecondTable;
 
   LeapSecondData();
+  LeapSecondData(LeapSecondData&& other) noexcept;
   ~LeapSecondData();
 
+  auto operator=(LeapSecondData&& other) noexcept -> LeapSecondData&;
+
   // Set table which provides TAI-UTC information.
   // The current data is fully replaced with the new one.
   void SetTable(Table&& table);
@@ -46,9 +53,81 @@ class LeapSecondData {
       const ModifiedJulianDate& mjd_tai) const -> double;
 
  private:
+  // Interval of time starting at the last leap second of the table, during
+  // which the TAI-UTC is constant. It allows to answer lookups of the present
+  // time with a single range check, without loading the shared table.
+  //
+  // The interval is published using a sequence lock. The sequence is odd while
+  // the table is being replaced, and it advances by 2 with every generation of
+  // the table. A lookup which races with the replacement of the table detects
+  // the change of the sequence and falls back to the lookup in the table.
+  class LastInterval {
+   public:
+    struct Interval {
+      // Time from which the interval is effective, in UTC and TAI scales.
+      // The interval lasts indefinitely, following the clamping extrapolation
+      // of the table.
+      ModifiedJulianDate begin_mjd_utc{std::numeric_limits<double>::infinity()};
+      ModifiedJulianDate begin_mjd_tai{std::numeric_limits<double>::infinity()};
+
+      // TAI-UTC in seconds.
+      double tai_minus_utc{0};
+    };
+
+    LastInterval() = default;
+
+    // The move is not thread-safe: it must not be called while there are
+    // lookups or updates of either of the intervals.
+    LastInterval(LastInterval&& other) noexcept;
+    auto operator=(LastInterval&& other) noexcept -> LastInterval&;
+
+    // Lookup TAI-UTC for the given time in UTC or TAI scale.
+    //
+    // Returns false if the time is outside of the interval, or the interval is
+    // being updated, in which case the tai_minus_utc is not modified.
+    auto LookupInUTCScale(const ModifiedJulianDate& mjd_utc,
+                          double& tai_minus_utc) const -> bool;
+    auto LookupInTAIScale(const ModifiedJulianDate& mjd_tai,
+                          double& tai_minus_utc) const -> bool;
+
+    // Replace the interval.
+    //
+    // The replace_table() is called while the interval is invalidated, so that
+    // lookups during the replacement of the table use the table.
+    template <class ReplaceTableFunction>
+    void Update(const Interval& interval,
+                ReplaceTableFunction&& replace_table) {
+      const std::lock_guard lock(mutex_);
+
+      Invalidate();
+      replace_table();
+      Publish(interval);
+    }
+
+   private:
+    void Invalidate();
+    void Publish(const Interval& interval);
+
+    std::atomic<uint64_t> sequence_{0};
+
+    // Fields of the Interval. The MJDs are stored as their hi and lo parts.
+    std::atomic<double> begin_mjd_utc_hi_{
+        std::numeric_limits<double>::infinity()};
+    std::atomic<double> begin_mjd_utc_lo_{0};
+    std::atomic<double> begin_mjd_tai_hi_{
+        std::numeric_limits<double>::infinity()};
+    std::atomic<double> begin_mjd_tai_lo_{0};
+    std::atomic<double> tai_minus_utc_{0};
+
+    // Mutex which serializes writers.
+    std::mutex mutex_;
+  };
+
   // Table with known constant corrections. It is typically provided by IERS.
   using SharedTable = astro_core::SharedTable<Table>;
   SharedTable shared_table_;
+
+  LastInterval last_interval_;
 };
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -24,6 +24,21 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class LeapSecondTable {
  public:
+  // Specification of a row of the table.
+  struct Row {
+    // Modified Julian date (MJD) starting from which the TAI-UTC value defined
+    // in this row is valid from. The TAI-UTC is valid until the MJD time point
+    // defined in the next row of the table.
+    //
+    // The date in both UTC and TAI time scales are stored to allow fast lookup
+    // of TAI-UTC in either of the scales.
+    ModifiedJulianDate mjd_utc;
+    ModifiedJulianDate mjd_tai;
+
+    // TAI-UTC in seconds.
+    double tai_minus_utc;
+  };
+
   // Add leap second row to the table.
   //
   // The mjd is the time point in the modified Julian date (MJD) format measured
@@ -42,6 +57,13 @@ class LeapSecondTable {
   // It is to be called by table importers once after the data has been loaded.
   void Preprocess();
 
+  // Check whether the table has no rows.
+  auto IsEmpty() const -> bool { return table_.empty(); }
+
+  // Get the row with the most recent leap second.
+  // The table is expected to be non-empty and pre-processed.
+  auto GetLastRow() const -> const Row& { return table_.back(); }
+
   // Lookup TAI-UTC value for the given time in MJD format and UTC scale.
   //
   // Clamping extrapolation strategy is used. This means that for the dates
@@ -75,21 +97,6 @@ class LeapSecondTable {
       const ModifiedJulianDate& mjd_tai) const -> double;
 
  private:
-  // Specification of a row of the table.
-  struct Row {
-    // Modified Julian date (MJD) starting from which the TAI-UTC value defined
-    // in this row is valid from. The TAI-UTC is valid until the MJD time point
-    // defined in the next row of the table.
-    //
-    // The date in both UTC and TAI time scales are stored to allow fast lookup
-    // of TAI-UTC in either of the scales.
-    ModifiedJulianDate mjd_utc;
-    ModifiedJulianDate mjd_tai;
-
-    // TAI-UTC in seconds.
-    double tai_minus_utc;
-  };
-
   // Content of the table.
   earth_internal::Table<Row> table_;
 };
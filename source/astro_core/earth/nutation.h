@@ -6,12 +6,14 @@
 
 #include <iosfwd>
 
+#include "astro_core/earth/nutation_precision.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class JulianDate;
+class NutationEpoch;
 
 // Luni-solar + planetary nutation parameters.
 struct Nutation {
@@ -27,6 +29,14 @@ auto operator<<(std::ostream& os, const Nutation& nutation) -> std::ostream&;
 // NOTE: ERFA uses slightly different parameterization, so the result is not
 // exactly the same.
 auto CalculateNutation00A(const JulianDate& jd_tt) -> Nutation;
+auto CalculateNutation00A(const NutationEpoch& epoch) -> Nutation;
+
+// Calculate nutation using IAU 2000A model, or its approximation of the given
+// precision. The IAU 2000B model is the equivalent of ERFA's eraNut00b().
+auto CalculateNutation00A(const JulianDate& jd_tt,
+                          const NutationPrecision& precision) -> Nutation;
+auto CalculateNutation00A(const NutationEpoch& epoch,
+                          const NutationPrecision& precision) -> Nutation;
 
 // Calculate IAU 2000A nutation with adjustments to match the IAU 2006
 // precession.
@@ -36,6 +46,14 @@ auto CalculateNutation00A(const JulianDate& jd_tt) -> Nutation;
 // NOTE: ERFA uses slightly different parameterization, so the result is not
 // exactly the same.
 auto CalculateNutation06A(const JulianDate& jd_tt) -> Nutation;
+auto CalculateNutation06A(const NutationEpoch& epoch) -> Nutation;
+
+// Calculate IAU 2000A nutation, or its approximation of the given precision,
+// with adjustments to match the IAU 2006 precession.
+auto CalculateNutation06A(const JulianDate& jd_tt,
+                          const NutationPrecision& precision) -> Nutation;
+auto CalculateNutation06A(const NutationEpoch& epoch,
+                          const NutationPrecision& precision) -> Nutation;
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -0,0 +1,129 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// The expressions for the fundamental arguments of nutation.
+//
+// References:
+//
+//   [IERS2010] Gerard Petit, and Brian Luzum, IERS Conventions (2010).
+
+#pragma once
+
+#include <array>
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+/////////////////////////////////////////////////////////////////////////////////
+// Arguments of lunisolar nutation.
+//
+// Follows parameterization and equations from [IERS2010] Page 67, Eq. (5.43).
+//
+// The parameter t is defined by ([IERS2010] Page 45, Eq. (5.2)):
+//   t = (TT − 2000 January 1d 12h TT) in days/36525
+
+struct LunisolarNutationArguments {
+  double l;        // Mean Anomaly of the Moon, eraFal03().
+  double l_prime;  // l', Mean Anomaly of the Sun, eraFalp03().
+  double F;   // Mean longitude of the Moon minus that of the ascending node.
+              // eraFaf03().
+  double D;   // Mean Elongation of the Moon from the Sun, eraFad03().
+  double Om;  // Mean Longitude of the Ascending Node of the Moon, eraFaom03().
+};
+
+// Calculate the arguments of lunisolar nutation.
+auto CalculateLunisolarNutationArguments(double t)
+    -> LunisolarNutationArguments;
+
+////////////////////////////////////////////////////////////////////////////////
+// Arguments for the planetary nutation.
+//
+// Follows parameterization and equations from [IERS2010] Page 68, Eq. (5.44).
+//
+// The parameter t is defined by ([IERS2010] Page 45, Eq. (5.2)):
+//   t = (TT − 2000 January 1d 12h TT) in days/36525
+
+struct PlanetaryNutationArguments {
+  // Planetary mean longitudes, Mercury through Neptune, and their ERFA's
+  // analogues.
+  double L_Me;  // Mercury, eraFame03().
+  double L_Ve;  // Venus, eraFave03().
+  double L_E;   // Earth, eraFae03().
+  double L_Ma;  // Mars, eraFama03().
+  double L_J;   // Jupiter, eraFaju03().
+  double L_Sa;  // Saturn, eraFasa03().
+  double L_U;   // Uranus, eraFaur03().
+  double L_Ne;  // Neptune, eraFane03().
+
+  // General accumulated precession in longitude.
+  // ERFA's eraFapa03().
+  double p_A;
+};
+
+// Calculate the arguments for the planetary nutation.
+auto CalculatePlanetaryNutationArguments(double t)
+    -> PlanetaryNutationArguments;
+
+////////////////////////////////////////////////////////////////////////////////
+// Sine and cosine of integer multiples of the fundamental arguments.
+//
+// The argument of every term of the IERS series is a linear combination of the
+// fundamental arguments with small integer multipliers. Knowing the sine and
+// cosine of the multiples of every fundamental argument allows to calculate the
+// sine and cosine of a term argument using the angle addition formulas, without
+// evaluating any trigonometric functions per term.
+
+class NutationArgumentMultiples {
+ public:
+  // The fundamental arguments are indexed in the order of the columns of the
+  // IERS tables: l, l', F, D, Om, L_Me, L_Ve, L_E, L_Ma, L_J, L_Sa, L_U, L_Ne,
+  // p_A.
+  static constexpr int kNumArguments = 14;
+
+  // The largest absolute value of a multiplier of an argument in the IERS
+  // tables.
+  static constexpr int kMaxMultiplier = 21;
+
+  // Number of the tabulated multiples of every argument, from -kMaxMultiplier
+  // to kMaxMultiplier.
+  static constexpr int kNumMultiples = 2 * kMaxMultiplier + 1;
+
+  struct SinCos {
+    double sin;
+    double cos;
+  };
+
+  NutationArgumentMultiples(
+      const LunisolarNutationArguments& lunisolar_nutation_arguments,
+      const PlanetaryNutationArguments& planetary_nutation_arguments);
+
+  // Get sine and cosine of the argument at the given index multiplied by the
+  // given multiplier. The absolute value of the multiplier is to not exceed
+  // the kMaxMultiplier.
+  auto Get(const int argument_index, const int multiplier) const -> SinCos {
+    return {GetSinMultiples(argument_index)[multiplier],
+            GetCosMultiples(argument_index)[multiplier]};
+  }
+
+  // Get pointers to the sine and cosine of the zero multiple of the argument
+  // at the given index. The pointers are to be indexed with a multiplier
+  // within [-kMaxMultiplier, kMaxMultiplier].
+  auto GetSinMultiples(const int argument_index) const -> const double* {
+    return sin_[argument_index].data() + kMaxMultiplier;
+  }
+  auto GetCosMultiples(const int argument_index) const -> const double* {
+    return cos_[argument_index].data() + kMaxMultiplier;
+  }
+
+ private:
+  // Sine and cosine of the multiples of every argument, stored in separate
+  // arrays so that they can be gathered into SIMD registers.
+  std::array<std::array<double, kNumMultiples>, kNumArguments> sin_;
+  std::array<std::array<double, kNumMultiples>, kNumArguments> cos_;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Quantities which are shared by all IERS series evaluated at the same time
+// point: the time parameter t, the fundamental arguments of nutation, and the
+// sine and cosine of their integer multiples.
+//
+// The nutation, the X, Y coordinates of the celestial intermediate pole and the
+// CIO locator s are all series over the same fundamental arguments. Calculating
+// several of them at the same time point from a single epoch calculates the
+// arguments only once:
+//
+//   const NutationEpoch epoch(jd_tt);
+//   const Vec2 cip_xy = CelestialIntermediatePole(epoch);
+//   const double s = CelestialIntermediateOriginLocator(epoch, cip_xy);
+//
+// The results are exactly the same as of the functions which take the time
+// point directly.
+//
+// References:
+//
+//   [IERS2010] Gerard Petit, and Brian Luzum, IERS Conventions (2010).
+
+#pragma once
+
+#include "astro_core/earth/nutation_arguments.h"
+#include "astro_core/time/format/julian_date.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class NutationEpoch {
+ public:
+  // Calculate the epoch quantities for the time point given in Julian Date
+  // format and Terrestrial Time scale.
+  explicit NutationEpoch(const JulianDate& jd_tt);
+
+  // Time point of the epoch in Julian Date format and Terrestrial Time scale.
+  auto GetJulianDate() const -> const JulianDate& { return jd_tt_; }
+
+  // Time interval since J2000 in Julian centuries (TT).
+  // [IERS2010] Page 45, Eq. (5.2).
+  auto GetT() const -> double { return t_; }
+
+  // Calculate the time interval since J2000 in Julian centuries (TT) for the
+  // time point given in Julian Date format and Terrestrial Time scale, without
+  // calculating the rest of the epoch quantities.
+  static auto CalculateT(const JulianDate& jd_tt) -> double;
+
+  auto GetLunisolarArguments() const -> const LunisolarNutationArguments& {
+    return lunisolar_arguments_;
+  }
+
+  auto GetPlanetaryArguments() const -> const PlanetaryNutationArguments& {
+    return planetary_arguments_;
+  }
+
+  // Sine and cosine of the integer multiples of the fundamental arguments.
+  auto GetArgumentMultiples() const -> const NutationArgumentMultiples& {
+    return argument_multiples_;
+  }
+
+ private:
+  JulianDate jd_tt_;
+  double t_;
+
+  LunisolarNutationArguments lunisolar_arguments_;
+  PlanetaryNutationArguments planetary_arguments_;
+
+  NutationArgumentMultiples argument_multiples_;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
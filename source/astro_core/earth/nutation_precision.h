@@ -0,0 +1,74 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Precision of the precession-nutation models.
+//
+// By default the nutation, the celestial intermediate pole (CIP) and the
+// intermediate rotations use the complete IAU 2006/2000A series with thousands
+// of terms. Applications which do not need microarcsecond accuracy, such as
+// approximate models of the Sun position, can trade accuracy for speed by
+// using one of the approximate models:
+//
+//   const Mat3 rbpn = BiasPrecessionNutationRotation06A(
+//       jd_tt, {.model = NutationPrecision::Model::k2000B});
+//
+// The bound of the difference of the nutation angles and of the CIP coordinates
+// from the complete model within the 1900-2100 time range, and the time it
+// takes to calculate the precession-nutation matrix relative to the complete
+// model:
+//
+//   Model                      | Nutation | CIP X, Y | Time
+//   ---------------------------+----------+----------+------
+//   kFull                      | -        | -        | 1
+//   k2000B                     | 2.5 mas  | 1 mas    | 1/28
+//   kTruncated, cutoff 1 µas   | 30 µas   | 30 µas   | 1/1.5
+//   kTruncated, cutoff 10 µas  | 0.25 mas | 0.2 mas  | 1/4
+//   kTruncated, cutoff 100 µas | 1.1 mas  | 0.9 mas  | 1/7
+//
+// The tests of the corresponding functions check the differences against these
+// bounds.
+//
+// References:
+//
+//   [McCarthy2003] McCarthy, D. D., Luzum, B. J., An abridged model of the
+//     precession-nutation of the celestial pole, Celestial Mechanics and
+//     Dynamical Astronomy, 85, 37-49 (2003).
+
+#pragma once
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+struct NutationPrecision {
+  enum class Model {
+    // Complete IAU 2006/2000A model.
+    kFull,
+
+    // IAU 2000B nutation model [McCarthy2003]: the 77 largest lunisolar terms
+    // of the IAU 2000A nutation and fixed offsets which approximate the
+    // planetary terms.
+    //
+    // The CIP is calculated from the precession-nutation matrix which uses the
+    // IAU 2000B nutation, and the CIO locator s uses its complete series.
+    k2000B,
+
+    // The complete series with the terms of amplitude below the cutoff
+    // ignored.
+    kTruncated,
+  };
+
+  Model model{Model::kFull};
+
+  // Amplitude in microarcseconds below which terms of the series are ignored.
+  // Only used by the kTruncated model.
+  //
+  // For the terms which depend on the time the amplitude is per Julian century
+  // to the corresponding power.
+  double amplitude_cutoff{0};
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
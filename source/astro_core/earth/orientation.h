@@ -18,6 +18,10 @@ class ModifiedJulianDate;
 // Get global data which holds the tabulated information about Earth orientation
 // parameters. This data is used by functions in this file. So this is required
 // to provide the data before functions will return meaningful results.
+//
+// The data can be replaced while other threads are performing lookups. A thread
+// which performs many lookups can hold a SharedTablePin for the duration of the
+// batch to make every lookup cheaper.
 auto GetEarthOrientationData() -> EarthOrientationData&;
 
 // Lookup UT1-UTC in seconds for the given time in UTC scale provided in the
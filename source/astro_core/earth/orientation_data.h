@@ -27,8 +27,12 @@ class EarthOrientationData {
   using Table = EarthOrientationTable;
 
   EarthOrientationData();
+  EarthOrientationData(EarthOrientationData&& other) noexcept;
   ~EarthOrientationData();
 
+  auto operator=(EarthOrientationData&& other) noexcept
+      -> EarthOrientationData&;
+
   // Set table which provides the earth orientation parameters.
   // The current data is fully replaced with the new one.
   void SetTable(Table&& table);
@@ -11,11 +11,18 @@
 //
 // The lookup access to the table is thread safe. Modification of the table is
 // not.
+//
+// The Preprocess() stores the sorted rows in a contiguous array. When the rows
+// are spaced uniformly in time (which is the case for the daily IERS tables)
+// the row for the given MJD is found with a direct arithmetic on the MJD,
+// otherwise a binary search in the contiguous array is used.
 
 #pragma once
 
+#include <span>
 #include <vector>
 
+#include "astro_core/base/double_double.h"
 #include "astro_core/earth/internal/table.h"
 #include "astro_core/numeric/numeric.h"
 #include "astro_core/time/format/modified_julian_date.h"
@@ -83,8 +90,25 @@ class EarthOrientationTable {
     double ut1_minus_utc{0};
   };
 
+  // Get rows which are needed for the interpolation of the value at the
+  // given MJD: the rows immediately before and after it, or a single row if
+  // the MJD is outside of the table.
+  //
+  // Interpolation using these rows gives exactly the same result as the
+  // interpolation using the entire table.
+  auto GetInterpolationRows(const ModifiedJulianDate& mjd) const
+      -> std::span<const Row>;
+
   // Content of the table.
   earth_internal::Table<Row> table_;
+
+  // Contiguous copy of the sorted rows of the table, created by Preprocess().
+  std::vector<Row> rows_;
+
+  // MJD of the first row and the distance in days between the rows, if the
+  // rows are spaced uniformly. Otherwise the step is 0.
+  DoubleDouble grid_start_mjd_{0};
+  double grid_step_{0};
 };
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Interface of an executor of parallel tasks.
+//
+// The library does not create threads on its own. Algorithms which can benefit
+// from running on multiple cores accept an Executor, which is used to run
+// independent tasks concurrently. The library provides the ThreadPool
+// implementation, and the host application can implement this interface on top
+// of its own scheduler.
+//
+// The algorithms which use an executor write the result of every task into its
+// own dedicated storage, so the output does not depend on the order in which
+// the tasks are executed, nor on the number of threads.
+
+#pragma once
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+// Function which executes a single task with the given index.
+using ExecutorTaskFunction = void (*)(void* data, int task_index);
+
+class Executor {
+ public:
+  virtual ~Executor() = default;
+
+  // Maximum number of tasks which are executed concurrently.
+  //
+  // Used as a hint for splitting the work into tasks of a reasonable size.
+  virtual auto GetConcurrency() const -> int = 0;
+
+  // Execute function(data, i) for every i in [0, num_tasks), and wait for all
+  // of them to finish.
+  //
+  // The tasks might be executed in any order, concurrently with each other.
+  // The tasks might be executed by the calling thread.
+  //
+  // Tasks are allowed to call Execute() again (for example, to parallelize an
+  // inner loop), and the implementation is expected to not dead-lock in this
+  // case. The tasks are not allowed to throw exceptions.
+  virtual void Execute(int num_tasks,
+                       ExecutorTaskFunction function,
+                       void* data) = 0;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
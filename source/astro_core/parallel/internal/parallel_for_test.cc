@@ -0,0 +1,91 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/parallel/parallel_for.h"
+
+#include <utility>
+#include <vector>
+
+#include "astro_core/parallel/thread_pool.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+namespace {
+
+// Executor which runs tasks serially in the reverse order, and records how it
+// has been used. Simulates an executor provided by the host application.
+class ReverseExecutor : public Executor {
+ public:
+  auto GetConcurrency() const -> int override { return 2; }
+
+  void Execute(const int num_tasks,
+               const ExecutorTaskFunction function,
+               void* data) override {
+    ++num_execute_calls;
+    for (int i = num_tasks - 1; i >= 0; --i) {
+      function(data, i);
+    }
+  }
+
+  int num_execute_calls{0};
+};
+
+// Collect sub-ranges into which the range of the given size is split.
+auto CollectRanges(Executor* executor,
+                   const int num_items,
+                   const int grain_size) -> std::vector<std::pair<int, int>> {
+  std::vector<std::pair<int, int>> ranges;
+  ParallelFor(executor, num_items, grain_size, [&](int begin, int end) {
+    ranges.emplace_back(begin, end);
+  });
+  return ranges;
+}
+
+}  // namespace
+
+TEST(ParallelFor, Serial) {
+  EXPECT_TRUE(CollectRanges(nullptr, 0, 1).empty());
+  EXPECT_EQ(CollectRanges(nullptr, 10, 1),
+            (std::vector<std::pair<int, int>>{{0, 10}}));
+}
+
+TEST(ParallelFor, Split) {
+  ReverseExecutor executor;
+
+  // Not enough items to be split.
+  EXPECT_EQ(CollectRanges(&executor, 10, 16),
+            (std::vector<std::pair<int, int>>{{0, 10}}));
+  EXPECT_EQ(executor.num_execute_calls, 0);
+
+  EXPECT_EQ(CollectRanges(&executor, 10, 4),
+            (std::vector<std::pair<int, int>>{{5, 10}, {0, 5}}));
+  EXPECT_EQ(executor.num_execute_calls, 1);
+
+  // The number of chunks is limited by the concurrency of the executor.
+  const std::vector<std::pair<int, int>> ranges =
+      CollectRanges(&executor, 1000, 1);
+  ASSERT_EQ(ranges.size(), 8);
+  EXPECT_EQ(ranges.front(), std::make_pair(875, 1000));
+  EXPECT_EQ(ranges.back(), std::make_pair(0, 125));
+}
+
+TEST(ParallelFor, ThreadPool) {
+  ThreadPool thread_pool(3);
+
+  constexpr int kNumItems = 10000;
+
+  std::vector<int> values(kNumItems, 0);
+  ParallelFor(&thread_pool, kNumItems, 16, [&](const int begin, const int end) {
+    for (int i = begin; i < end; ++i) {
+      values[i] += i * 2;
+    }
+  });
+
+  for (int i = 0; i < kNumItems; ++i) {
+    EXPECT_EQ(values[i], i * 2);
+  }
+}
+
+}  // namespace astro_core
@@ -0,0 +1,213 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/parallel/thread_pool.h"
+
+#include <algorithm>
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+// The pool which the current thread is a worker of, and the index of the
+// worker queue of the thread.
+thread_local const ThreadPool* current_thread_pool{nullptr};
+thread_local int current_thread_queue_index{-1};
+
+}  // namespace
+
+// Tasks passed to a single call of Execute().
+struct ThreadPool::Batch {
+  ExecutorTaskFunction function;
+  void* data;
+
+  // Number of tasks which are not yet finished.
+  // Guarded by the mutex.
+  int num_remaining_tasks;
+
+  std::mutex mutex;
+  std::condition_variable condition;
+
+  // Mark a task of the batch as finished.
+  //
+  // The notification happens while the mutex is locked, so that the batch is
+  // not destroyed by the thread which waits for the batch until this function
+  // is finished.
+  void FinishTask() {
+    std::lock_guard lock(mutex);
+    if (--num_remaining_tasks == 0) {
+      condition.notify_all();
+    }
+  }
+
+  auto IsFinished() -> bool {
+    std::lock_guard lock(mutex);
+    return num_remaining_tasks == 0;
+  }
+};
+
+ThreadPool::ThreadPool(int num_threads) {
+  if (num_threads <= 0) {
+    // The thread which calls Execute() is also executing tasks.
+    num_threads = std::max(int(std::thread::hardware_concurrency()), 1) - 1;
+  }
+
+  queues_.resize(num_threads + 1);
+  for (std::unique_ptr<Queue>& queue : queues_) {
+    queue = std::make_unique<Queue>();
+  }
+
+  threads_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads_.emplace_back([this, i]() { WorkerMain(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(wake_mutex_);
+    is_stopping_ = true;
+  }
+  wake_condition_.notify_all();
+
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Execute(const int num_tasks,
+                         const ExecutorTaskFunction function,
+                         void* data) {
+  if (threads_.empty() || num_tasks == 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      function(data, i);
+    }
+    return;
+  }
+
+  if (num_tasks <= 0) {
+    return;
+  }
+
+  Batch batch;
+  batch.function = function;
+  batch.data = data;
+  batch.num_remaining_tasks = num_tasks;
+
+  // Queue the entire batch as a single range: it is split by this thread, and
+  // the halves are stolen by the idle workers.
+  const int queue_index = GetCurrentThreadQueueIndex();
+  Push(queue_index, {.batch = &batch, .begin = 0, .end = num_tasks});
+
+  while (!batch.IsFinished()) {
+    if (RunNextTask(queue_index)) {
+      continue;
+    }
+
+    // There are no queued tasks, so the remaining tasks of the batch are being
+    // executed by other threads.
+    std::unique_lock lock(batch.mutex);
+    batch.condition.wait(lock, [&] { return batch.num_remaining_tasks == 0; });
+    break;
+  }
+}
+
+void ThreadPool::Push(const int queue_index, const TaskRange& range) {
+  Queue& queue = *queues_[queue_index];
+  {
+    std::lock_guard lock(queue.mutex);
+    queue.ranges.push_back(range);
+    ++num_queued_ranges_;
+  }
+
+  // Lock the mutex to avoid the wake up being lost when it happens in between
+  // of a worker checking the wait condition and going to sleep.
+  { std::lock_guard lock(wake_mutex_); }
+  wake_condition_.notify_one();
+}
+
+auto ThreadPool::PopBack(const int queue_index, TaskRange& range) -> bool {
+  Queue& queue = *queues_[queue_index];
+  std::lock_guard lock(queue.mutex);
+  if (queue.ranges.empty()) {
+    return false;
+  }
+  range = queue.ranges.back();
+  queue.ranges.pop_back();
+  --num_queued_ranges_;
+  return true;
+}
+
+auto ThreadPool::PopFront(const int queue_index, TaskRange& range) -> bool {
+  Queue& queue = *queues_[queue_index];
+  std::lock_guard lock(queue.mutex);
+  if (queue.ranges.empty()) {
+    return false;
+  }
+  range = queue.ranges.front();
+  queue.ranges.pop_front();
+  --num_queued_ranges_;
+  return true;
+}
+
+auto ThreadPool::RunNextTask(const int queue_index) -> bool {
+  TaskRange range;
+
+  if (!PopBack(queue_index, range)) {
+    const int num_queues = queues_.size();
+    bool is_stolen = false;
+    for (int i = 1; i < num_queues && !is_stolen; ++i) {
+      is_stolen = PopFront((queue_index + i) % num_queues, range);
+    }
+    if (!is_stolen) {
+      return false;
+    }
+  }
+
+  // Leave a single task to be executed by this thread, and make the rest of
+  // the range available for stealing.
+  while (range.end - range.begin > 1) {
+    const int middle = range.begin + (range.end - range.begin) / 2;
+    Push(queue_index,
+         {.batch = range.batch, .begin = middle, .end = range.end});
+    range.end = middle;
+  }
+
+  Batch& batch = *range.batch;
+  batch.function(batch.data, range.begin);
+  batch.FinishTask();
+
+  return true;
+}
+
+void ThreadPool::WorkerMain(const int queue_index) {
+  current_thread_pool = this;
+  current_thread_queue_index = queue_index;
+
+  while (true) {
+    if (RunNextTask(queue_index)) {
+      continue;
+    }
+
+    std::unique_lock lock(wake_mutex_);
+    wake_condition_.wait(
+        lock, [&] { return is_stopping_ || num_queued_ranges_ > 0; });
+    if (is_stopping_) {
+      break;
+    }
+  }
+}
+
+auto ThreadPool::GetCurrentThreadQueueIndex() const -> int {
+  if (current_thread_pool == this) {
+    return current_thread_queue_index;
+  }
+
+  // The shared queue of non-worker threads.
+  return queues_.size() - 1;
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,94 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/parallel/thread_pool.h"
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+namespace {
+
+// Execute the function for every task index using the executor.
+void ExecuteFunction(Executor& executor,
+                     const int num_tasks,
+                     const std::function<void(int)>& function) {
+  executor.Execute(
+      num_tasks,
+      [](void* data, const int task_index) {
+        (*static_cast<const std::function<void(int)>*>(data))(task_index);
+      },
+      const_cast<std::function<void(int)>*>(&function));
+}
+
+}  // namespace
+
+TEST(ThreadPool, Concurrency) {
+  ThreadPool thread_pool(3);
+  EXPECT_EQ(thread_pool.GetNumThreads(), 3);
+  EXPECT_EQ(thread_pool.GetConcurrency(), 4);
+}
+
+TEST(ThreadPool, Execute) {
+  for (const int num_threads : {0, 1, 4}) {
+    ThreadPool thread_pool(num_threads);
+
+    for (const int num_tasks : {0, 1, 2, 7, 1000}) {
+      std::vector<std::atomic<int>> num_task_calls(num_tasks);
+      ExecuteFunction(
+          thread_pool, num_tasks, [&](const int i) { ++num_task_calls[i]; });
+
+      for (int i = 0; i < num_tasks; ++i) {
+        EXPECT_EQ(num_task_calls[i], 1) << "Task " << i << " of " << num_tasks;
+      }
+    }
+  }
+}
+
+TEST(ThreadPool, NestedExecute) {
+  ThreadPool thread_pool(2);
+
+  constexpr int kNumOuterTasks = 16;
+  constexpr int kNumInnerTasks = 64;
+
+  std::vector<std::atomic<int>> num_task_calls(kNumOuterTasks *
+                                               kNumInnerTasks);
+  ExecuteFunction(thread_pool, kNumOuterTasks, [&](const int i) {
+    ExecuteFunction(thread_pool, kNumInnerTasks, [&](const int j) {
+      ++num_task_calls[i * kNumInnerTasks + j];
+    });
+  });
+
+  for (const std::atomic<int>& num_calls : num_task_calls) {
+    EXPECT_EQ(num_calls, 1);
+  }
+}
+
+TEST(ThreadPool, ConcurrentExecute) {
+  ThreadPool thread_pool(2);
+
+  constexpr int kNumTasks = 1000;
+
+  std::vector<std::atomic<int>> num_task_calls_a(kNumTasks);
+  std::vector<std::atomic<int>> num_task_calls_b(kNumTasks);
+
+  std::thread thread([&]() {
+    ExecuteFunction(
+        thread_pool, kNumTasks, [&](const int i) { ++num_task_calls_a[i]; });
+  });
+  ExecuteFunction(
+      thread_pool, kNumTasks, [&](const int i) { ++num_task_calls_b[i]; });
+  thread.join();
+
+  for (int i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(num_task_calls_a[i], 1);
+    EXPECT_EQ(num_task_calls_b[i], 1);
+  }
+}
+
+}  // namespace astro_core
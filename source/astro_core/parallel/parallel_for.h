@@ -0,0 +1,85 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Parallel loop over a range of items using an Executor.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "astro_core/parallel/executor.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+// Invoke the function(begin, end) on non-overlapping sub-ranges which together
+// cover the [0, num_items) range.
+//
+// The sub-ranges are contiguous and contain at least grain_size items (except
+// for the case when there are less than grain_size items in total). The split
+// of the range only depends on the number of items, the grain size, and the
+// executor concurrency.
+//
+// The function is invoked concurrently on different sub-ranges using the given
+// executor. If the executor is nullptr the function is invoked once on the
+// entire range from the calling thread.
+template <class F>
+void ParallelFor(Executor* executor,
+                 const int num_items,
+                 const int grain_size,
+                 F&& function) {
+  using Function = std::remove_reference_t<F>;
+
+  // Number of chunks per thread of the executor, allowing to balance the work
+  // when some of the chunks take more time than others.
+  constexpr int kNumChunksPerThread = 4;
+
+  if (num_items <= 0) {
+    return;
+  }
+
+  int num_chunks = 1;
+  if (executor != nullptr) {
+    const int max_num_chunks =
+        std::max(executor->GetConcurrency(), 1) * kNumChunksPerThread;
+    num_chunks = std::clamp(
+        num_items / std::max(grain_size, 1), 1, std::max(max_num_chunks, 1));
+  }
+
+  if (num_chunks == 1) {
+    std::invoke(function, 0, num_items);
+    return;
+  }
+
+  struct Context {
+    Function* function;
+    int num_items;
+    int num_chunks;
+  };
+
+  Context context{.function = std::addressof(function),
+                  .num_items = num_items,
+                  .num_chunks = num_chunks};
+
+  executor->Execute(
+      num_chunks,
+      [](void* data, const int chunk_index) {
+        const Context& chunk_context = *static_cast<const Context*>(data);
+        const auto chunk_begin = [&](const int64_t index) -> int {
+          return index * chunk_context.num_items / chunk_context.num_chunks;
+        };
+        std::invoke(*chunk_context.function,
+                    chunk_begin(chunk_index),
+                    chunk_begin(chunk_index + 1));
+      },
+      &context);
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,113 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Pool of worker threads which implements the Executor interface.
+//
+// Every worker has its own queue of tasks. A batch of tasks passed to the
+// Execute() is distributed over the queues as contiguous ranges of task
+// indices. A worker takes the most recently queued range from its own queue,
+// splits it in halves, and queues the upper half back until a single task is
+// left, which is then executed. A worker with an empty queue steals the oldest
+// (and typically the largest) range from the queues of other workers.
+//
+// The thread which calls Execute() participates in the execution of tasks until
+// all tasks of its batch are finished.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "astro_core/parallel/executor.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class ThreadPool : public Executor {
+ public:
+  // Create a pool with the given number of worker threads.
+  // If the number of threads is not positive the number of worker threads is
+  // chosen to match the number of hardware threads.
+  explicit ThreadPool(int num_threads = 0);
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool(ThreadPool&& other) noexcept = delete;
+
+  // Stop and join all worker threads.
+  // Must not be called while any of the Execute() is in progress.
+  ~ThreadPool() override;
+
+  auto operator=(const ThreadPool& other) -> ThreadPool& = delete;
+  auto operator=(ThreadPool&& other) -> ThreadPool& = delete;
+
+  // Get the number of worker threads in the pool.
+  auto GetNumThreads() const -> int { return threads_.size(); }
+
+  // The concurrency of the pool includes the thread which calls Execute().
+  auto GetConcurrency() const -> int override { return GetNumThreads() + 1; }
+
+  void Execute(int num_tasks,
+               ExecutorTaskFunction function,
+               void* data) override;
+
+ private:
+  struct Batch;
+
+  // Contiguous range of indices of tasks of a batch.
+  struct TaskRange {
+    Batch* batch;
+    int begin;
+    int end;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<TaskRange> ranges;
+  };
+
+  // Push the range to the back of the queue at the given index.
+  void Push(int queue_index, const TaskRange& range);
+
+  // Pop the most recently pushed range from the queue at the given index.
+  // Returns false if the queue is empty.
+  auto PopBack(int queue_index, TaskRange& range) -> bool;
+
+  // Pop the oldest range from the queue at the given index.
+  // Returns false if the queue is empty.
+  auto PopFront(int queue_index, TaskRange& range) -> bool;
+
+  // Run a single task, preferably from the queue at the given index, stealing
+  // from other queues if it is empty.
+  // Returns false if there were no tasks in any of the queues.
+  auto RunNextTask(int queue_index) -> bool;
+
+  // Main loop of the worker thread.
+  void WorkerMain(int queue_index);
+
+  // Index of the queue which the current thread is to use.
+  auto GetCurrentThreadQueueIndex() const -> int;
+
+  std::vector<std::thread> threads_;
+
+  // Queues of the worker threads, followed by a queue which is shared by all
+  // other threads which call Execute().
+  std::vector<std::unique_ptr<Queue>> queues_;
+
+  // Total number of ranges in all queues.
+  std::atomic<int> num_queued_ranges_{0};
+
+  // Mutex and condition variable used to wake up idle worker threads.
+  std::mutex wake_mutex_;
+  std::condition_variable wake_condition_;
+  bool is_stopping_{false};
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
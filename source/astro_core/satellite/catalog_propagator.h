@@ -0,0 +1,157 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// Propagator of a catalog of satellites to a single time.
+//
+// The propagator is optimized for the case when all satellites of a catalog
+// are to be propagated to the same time, for example to visualize the current
+// position of all satellites.
+//
+// The time scale conversion is done once for all satellites. The initialized
+// SGP4 models of the near-Earth satellites are packed in a contiguous array and
+// are propagated in a tight loop over it. The deep-space satellites are
+// propagated using the regular OrbitalState, which keeps the checkpoints of the
+// resonance integrator. The result of propagation of a satellite is the same as
+// OrbitalState::Predict() at the same time.
+//
+// The SGP4 model is evaluated one satellite at a time. Most of its time is
+// spent in the sin, cos, pow, and atan2 functions and in the Kepler iteration,
+// which do not vectorize without a vector math library that changes the
+// result, so a structure-of-arrays layout of the models gives little gain.
+//
+// The propagation can be parallelized using an Executor. The result does not
+// depend on whether an executor is used or on its number of threads.
+//
+// NOTE: This is an experimental API, it might get changed or even moved outside
+// of the library.
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "astro_core/numeric/numeric.h"
+#include "astro_core/satellite/orbital_state.h"
+#include "astro_core/time/time.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class Executor;
+class TLE;
+
+namespace experimental {
+
+class SatelliteDatabase;
+
+class CatalogPropagator {
+ public:
+  using Error = OrbitalState::Error;
+
+  CatalogPropagator() = default;
+
+  // Remove all satellites from the propagator.
+  void Clear();
+
+  // Add satellite with the given catalog number and TLE to the propagator.
+  //
+  // Returns false if the SGP4 model can not be initialized from the TLE, in
+  // which case the satellite is not added.
+  auto AddSatellite(int catalog_number, const TLE& tle) -> bool;
+
+  // Add all satellites from the database to the propagator.
+  //
+  // Satellites for which the SGP4 model can not be initialized are skipped.
+  // Returns the number of added satellites.
+  auto AddSatellites(const SatelliteDatabase& database) -> int;
+
+  // Get the number of satellites in the propagator.
+  auto GetNumSatellites() const -> int { return catalog_numbers_.size(); }
+
+  // Get catalog number of the satellite at the given index.
+  // The satellites are indexed in the order they were added to the propagator.
+  auto GetCatalogNumber(const int index) const -> int {
+    return catalog_numbers_[index];
+  }
+
+  // Propagate all satellites to the given time.
+  //
+  // The result is available via GetPositions(), GetVelocities() and GetError()
+  // until the next propagation.
+  void Propagate(const Time& time);
+
+  // Propagate all satellites to the given time, using the executor to
+  // propagate multiple satellites concurrently.
+  void Propagate(const Time& time, Executor& executor);
+
+  // Time of the last propagation.
+  auto GetTime() const -> const Time& { return time_; }
+
+  // Position and velocity of the satellites in the TEME frame at the time of
+  // the last propagation.
+  //
+  // The i-th element corresponds to the satellite at the i-th index. The value
+  // is undefined if the propagation of the satellite has failed.
+  //
+  // Position is measured in meters, velocity is measured in meters per second.
+  auto GetPositions() const -> std::span<const Vec3> { return positions_; }
+  auto GetVelocities() const -> std::span<const Vec3> { return velocities_; }
+
+  // Get the error of the propagation of the satellite at the given index.
+  // Returns nullopt if the propagation has succeeded.
+  auto GetError(const int index) const -> std::optional<Error> {
+    return errors_[index];
+  }
+
+ private:
+  // Near-Earth satellite.
+  struct NearEarthSatellite {
+    // Index of the satellite in the propagator.
+    int index;
+
+    // SGP4 model initialized from the TLE of the satellite. It is only read by
+    // the propagation.
+    sgp_internal::elsetrec satrec;
+  };
+
+  // Deep-space satellite.
+  struct DeepSpaceSatellite {
+    // Index of the satellite in the propagator.
+    int index;
+
+    OrbitalState orbital_state;
+  };
+
+  // Propagate all satellites, using the executor if it is not nullptr.
+  void PropagateUsingExecutor(const Time& time, Executor* executor);
+
+  // Propagate near-Earth satellites within the [begin, end) range of indices
+  // in the near_earth_ to the time given as a Julian date in the UTC scale.
+  void PropagateNearEarth(const DoubleDouble& jd_utc, int begin, int end);
+
+  // Propagate deep-space satellites within the [begin, end) range of indices
+  // in the deep_space_ to the time in the UTC scale.
+  void PropagateDeepSpace(const Time& time_utc,
+                          const Time& time,
+                          int begin,
+                          int end);
+
+  std::vector<int> catalog_numbers_;
+
+  std::vector<NearEarthSatellite> near_earth_;
+  std::vector<DeepSpaceSatellite> deep_space_;
+
+  // Result of the last propagation.
+  Time time_;
+  std::vector<Vec3> positions_;
+  std::vector<Vec3> velocities_;
+  std::vector<std::optional<Error>> errors_;
+};
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
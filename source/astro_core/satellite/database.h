@@ -21,10 +21,13 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "astro_core/base/exception.h"
 #include "astro_core/base/linked_list.h"
+#include "astro_core/parallel/parallel_for.h"
 #include "astro_core/satellite/tle.h"
+#include "astro_core/table/hash_index.h"
 #include "astro_core/table/paged_table.h"
 #include "astro_core/version/version.h"
 
@@ -180,6 +183,39 @@ class Satellite {
   // List of transmitters, organized in a list.
   // The actual storage is a dedicated table in the database.
   LinkedList<Transmitter> transmitters;
+
+  // Indices of the words of the catalog number and the name in the table of
+  // search words of the database, in the order the search visits them.
+  std::vector<int, Allocator<int>> search_word_indices;
+
+  // Index of the row of this satellite in the table of satellites.
+  // The search words refer to the satellites which use them by this index.
+  int row_index{-1};
+};
+
+// Row of search words table: a distinct word of the satellite names and catalog
+// numbers.
+class SearchWord {
+ public:
+  DatabaseString text{};
+
+  // Set of characters of the text, in the case-insensitive manner.
+  // Every character sets a bit of the mask, and the characters which are
+  // neither Latin letters nor digits share the same bit.
+  uint64_t character_mask{0};
+
+  // Posting list of the word: rows of the satellites which use the word, in
+  // no particular order. A satellite which uses the word multiple times is
+  // listed multiple times.
+  //
+  // The word which is not used by any satellite is unlinked from the hash
+  // index, and its row is re-used for the next added word.
+  std::vector<int, Allocator<int>> satellite_row_indices;
+
+  // Index of the next word with the same hash of the text, or -1 if this is
+  // the last word with this hash.
+  // For the unused words this is the index of the next unused word.
+  int next_word_index{-1};
 };
 
 // A row of an index.
@@ -242,11 +278,34 @@ class SatelliteDatabase {
   // This operation does not invalidate existing DAO.
   auto AddSatellite(int catalog_number, std::string_view name) -> SatelliteDAO;
 
+  // Bulk load of satellites.
+  //
+  // Adding a satellite keeps the catalog number index sorted, which costs
+  // O(N) per satellite. When many satellites are added at once the index rows
+  // of the satellites added between the BeginBulkLoad() and CommitBulkLoad()
+  // are appended to the index as-is, and the index is sorted once on commit.
+  //
+  // On commit satellites with the same catalog number are merged into the one
+  // which was added first: it keeps its name, gets the TLE of the satellite
+  // added last, and the transmitters of all of them. This includes satellites
+  // which were in the database before the bulk load.
+  //
+  // The bulk loads can be nested: the index is only sorted when the outermost
+  // bulk load is committed.
+  //
+  // Lookup of a catalog number which was added multiple times during the bulk
+  // load gives the satellite which was added first.
+  //
+  // The commit invalidates DAO of the satellites which were merged, and of the
+  // satellites stored after them in the database.
+  void BeginBulkLoad();
+  void CommitBulkLoad();
+
   // Lookup satellite with the given catalog number in the database.
   // If such satellite does not exist an invalid DAO is returned.
   //
-  // The complexity of the lookup is O(log N) where N is the number of
-  // satellites in the database.
+  // The lookup uses hash index on the catalog number, and its complexity is
+  // O(1) on average.
   auto LookupSatelliteByCatalogNumber(int catalog_number) -> SatelliteDAO;
   auto LookupSatelliteByCatalogNumber(int catalog_number) const
       -> ConstSatelliteDAO;
@@ -269,6 +328,32 @@ class SatelliteDatabase {
   template <class F, class... Args>
   void ForeachSatellite(F&& callback, Args&&... args) const;
 
+  // Invoke the given callback with all satellite DAO objects from the database,
+  // using the executor to invoke the callback for multiple satellites
+  // concurrently.
+  //
+  // The given list of args... is passed to the callback, and they are followed
+  // with the index of the satellite and the DAO. The satellites are indexed
+  // from 0 in the order in which the ForeachSatellite() visits them, so the
+  // callback can store its result at the index to get an output which does not
+  // depend on the order of the callback invocation.
+  //
+  // The database must not be modified until the function returns. The callback
+  // is allowed to read the satellite it is invoked for and to set its TLE with
+  // SetTLE(). Other modifications update tables shared by all satellites and
+  // are not allowed from the callback: AddTransmitter() appends to the table
+  // of transmitters, and SetName() updates the search words of the database.
+  // In the debug builds these calls assert that they are not invoked from the
+  // callback.
+  template <class F, class... Args>
+  void ParallelForeachSatellite(Executor& executor,
+                                F&& callback,
+                                Args&&... args);
+  template <class F, class... Args>
+  void ParallelForeachSatellite(Executor& executor,
+                                F&& callback,
+                                Args&&... args) const;
+
   // Invoke the callback on the best matches of the satellites to the query.
   //
   // The query does fuzzy-matching on the satellite name and the satellite
@@ -312,9 +397,14 @@ class SatelliteDatabase {
   // Used by all tables in this database.
   static constexpr int kNumRowPerPage = 32;
 
+  // Minimum number of satellites handled by a single task of an executor in the
+  // ParallelForeachSatellite().
+  static constexpr int kNumSatellitesPerParallelTask = 64;
+
   // Aliases for shorter access.
   using Satellite = satellite_database_internal::Satellite;
   using Transmitter = satellite_database_internal::Transmitter;
+  using SearchWord = satellite_database_internal::SearchWord;
   template <class Key, class Row>
   using IndexRow = satellite_database_internal::IndexRow<Key, Row>;
 
@@ -338,6 +428,50 @@ class SatelliteDatabase {
   // Add empty-initialized transmitter to the satellite.
   auto AddTransmitter(Satellite& satellite) -> TransmitterDAO;
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Search index.
+
+  // Set name of the satellite, updating its search words.
+  void SetSatelliteName(Satellite& satellite, std::string_view name);
+
+  // Update the search words of the satellite from its catalog number and name.
+  void IndexSatelliteSearchWords(Satellite& satellite);
+
+  // Add the word with the given text to the search words of the satellite.
+  void AddSatelliteSearchWord(Satellite& satellite, std::string_view text);
+
+  // Remove the satellite from the posting lists of its search words.
+  void ReleaseSatelliteSearchWords(Satellite& satellite);
+
+  // Update the posting lists of the search words of the satellite after it has
+  // been moved to the given row of the satellites table.
+  void MoveSatelliteSearchWords(Satellite& satellite, int row_index);
+
+  // Re-build the posting lists of all search words from the satellites.
+  // Used when many satellites moved in the satellites table.
+  void RebuildSearchWordPostings();
+
+  // Find the search word with the given text, adding it when it does not exist
+  // yet. Returns index of the word in the search words table.
+  auto FindOrAddSearchWord(std::string_view text) -> int;
+
+  // Remove one entry of the satellite row from the posting list of the search
+  // word, making the word unused when its posting list becomes empty.
+  void ReleaseSearchWord(int word_index, int satellite_row_index);
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Bulk load.
+
+  // Sort the index rows appended during the bulk load into the index.
+  // Satellites with the same catalog number are kept in the order they were
+  // added.
+  void SortPendingIndexRows();
+
+  // Merge satellites with the same catalog number into the first one of them,
+  // and remove the rest from the database.
+  // The index is expected to be sorted.
+  void MergeDuplicateSatellites();
+
   //////////////////////////////////////////////////////////////////////////////
   // Properties.
 
@@ -354,9 +488,65 @@ class SatelliteDatabase {
       PagedTable<IndexRow<int, Satellite*>, kNumRowPerPage, Allocator>;
   CatalogNumberIndex catalog_number_index_;
 
+  // Hash index on the satellite catalog number.
+  //
+  // Points to the satellite of the first row of the catalog number in the
+  // sorted index (or, during the bulk load, to the first added satellite), and
+  // is used for the lookup of satellites.
+  using CatalogNumberHashIndex = HashIndex<int, Satellite*, Allocator>;
+  CatalogNumberHashIndex catalog_number_hash_index_;
+
+  // The number of the bulk loads which began but did not commit yet.
+  int num_bulk_loads_{0};
+
+  // The number of rows at the end of the catalog number index which were added
+  // during the bulk load, and which are not sorted yet.
+  size_t num_pending_index_rows_{0};
+
+  // Table with distinct words of the satellite names and catalog numbers.
+  //
+  // The search scores every word of this table against the query once, and
+  // only visits the satellites from the posting lists of the words which
+  // matched the query. Rows of the words which are no longer used by any
+  // satellite are skipped by the search and re-used for new words.
+  using SearchWordTable = PagedTable<SearchWord, kNumRowPerPage, Allocator>;
+  SearchWordTable search_words_;
+
+  // Index of the first unused row of the search words table, or -1 if all rows
+  // are used. The unused rows are linked via their next_word_index.
+  int first_unused_search_word_index_{-1};
+
+  // Index of the search words on the hash of their text.
+  // Points to the first word of the list of words with the same hash.
+  using SearchWordHashIndex = HashIndex<uint64_t, int, Allocator>;
+  SearchWordHashIndex search_word_hash_index_;
+
   // Table with satellite transmitters.
   using TransmitterTable = PagedTable<Transmitter, kNumRowPerPage, Allocator>;
   TransmitterTable transmitters_;
+
+  // True while the ParallelForeachSatellite() invokes its callback.
+  // Used to assert that the callback does not modify the tables which are
+  // shared by all satellites.
+  bool is_in_parallel_foreach_{false};
+
+  // Sets the is_in_parallel_foreach_ for the lifetime of the object, so that
+  // it is cleared even when the executor or the callback throws.
+  class ParallelForeachScope {
+   public:
+    explicit ParallelForeachScope(SatelliteDatabase& database)
+        : database_(database) {
+      database_.is_in_parallel_foreach_ = true;
+    }
+    ~ParallelForeachScope() { database_.is_in_parallel_foreach_ = false; }
+
+    ParallelForeachScope(const ParallelForeachScope& other) = delete;
+    auto operator=(const ParallelForeachScope& other)
+        -> ParallelForeachScope& = delete;
+
+   private:
+    SatelliteDatabase& database_;
+  };
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -540,6 +730,12 @@ class SatelliteDAO : public ConstSatelliteDAO {
  public:
   SatelliteDAO() = default;
 
+  // Set name of the satellite.
+  // Updates the search index, so that the satellite is found by the new name.
+  inline void SetName(const std::string_view name) {
+    GetDatabase()->SetSatelliteName(*GetSatellite(), name);
+  }
+
   inline void SetTLE(const TLE& tle) { GetSatellite()->tle = tle; }
 
   // Add transmitter to the back of the list of the current satellite
@@ -619,6 +815,56 @@ void SatelliteDatabase::ForeachSatellite(F&& callback, Args&&... args) const {
   }
 }
 
+template <class F, class... Args>
+void SatelliteDatabase::ParallelForeachSatellite(Executor& executor,
+                                                 F&& callback,
+                                                 Args&&... args) {
+  std::vector<Satellite*, Allocator<Satellite*>> satellites;
+  satellites.reserve(satellites_.size());
+  for (Satellite& satellite : satellites_) {
+    satellites.push_back(&satellite);
+  }
+
+  // The flag is only written by this thread before the tasks are started and
+  // after they are finished, so reading it from the callbacks does not race.
+  const ParallelForeachScope parallel_foreach_scope(*this);
+
+  ParallelFor(&executor,
+              satellites.size(),
+              kNumSatellitesPerParallelTask,
+              [&](const int begin, const int end) {
+                for (int i = begin; i < end; ++i) {
+                  std::invoke(callback,
+                              args...,
+                              i,
+                              SatelliteDAO(this, satellites[i]));
+                }
+              });
+}
+
+template <class F, class... Args>
+void SatelliteDatabase::ParallelForeachSatellite(Executor& executor,
+                                                 F&& callback,
+                                                 Args&&... args) const {
+  std::vector<const Satellite*, Allocator<const Satellite*>> satellites;
+  satellites.reserve(satellites_.size());
+  for (const Satellite& satellite : satellites_) {
+    satellites.push_back(&satellite);
+  }
+
+  ParallelFor(&executor,
+              satellites.size(),
+              kNumSatellitesPerParallelTask,
+              [&](const int begin, const int end) {
+                for (int i = begin; i < end; ++i) {
+                  std::invoke(callback,
+                              args...,
+                              i,
+                              ConstSatelliteDAO(this, satellites[i]));
+                }
+              });
+}
+
 template <class F, class... Args>
 void SatelliteDatabase::ForeachSearchSatellite(std::string_view query,
                                                F&& callback,
@@ -32,9 +32,11 @@ class SatelliteDatabase;
 // added to the database.
 //
 // If the database is not empty, the records will either be added or updated for
-// the new TLE from the text.
+// the new TLE from the text. The satellites which already exist in the database
+// are updated in place, and their DAO stay valid.
 //
-// There is no check for duplicate satellite catalog numbers in the 3LE text.
+// Satellites which are repeated in the 3LE text are added once, with the name
+// from their first record and the TLE from the last one.
 auto Load3LE(SatelliteDatabase& database, std::string_view text) -> bool;
 
 }  // namespace experimental
@@ -7,12 +7,19 @@
 
 #pragma once
 
+#include <vector>
+
+#include "astro_core/base/result.h"
+#include "astro_core/satellite/orbital_state.h"
+#include "astro_core/time/time.h"
+#include "astro_core/time/time_difference.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class ITRF;
+class ObserverFrame;
 
 // Calculate the factor of the doppler effect:
 //
@@ -22,5 +29,62 @@ class ITRF;
 // frequency received by an observer.
 auto CalculateDopplerFactor(const ITRF& site, const ITRF& satellite) -> double;
 
+// Range and range rate of a satellite relative to an observer at a point in
+// time, and the corresponding doppler factor.
+struct DopplerSample {
+  Time time;
+
+  // Distance from the observer to the satellite, in meters.
+  double range{0};
+
+  // Rate of change of the range, in meters per second.
+  // Positive when the satellite is moving away from the observer.
+  double range_rate{0};
+
+  // Factor of the doppler effect, as per CalculateDopplerFactor().
+  double doppler_factor{1};
+};
+
+struct DopplerTableOptions {
+  // Time step between samples of the table.
+  TimeDifference time_step{TimeDifference::FromSeconds(0.1)};
+
+  // Time step at which the satellite position is predicted.
+  //
+  // The position and velocity of the satellite in ITRF in between of the
+  // predictions are interpolated using the cubic Hermite spline, so the range
+  // rate matches the predicted velocity at the prediction times.
+  //
+  // The interpolation error is dominated by the velocity of the SGP4 model not
+  // being the exact derivative of its position (the difference is up to a few
+  // centimeters per second for satellites in low Earth orbit), and the range
+  // error grows linearly with this step. For the default step of 10 seconds and
+  // satellites in low Earth orbit the range and the range rate are within 1 cm
+  // and 1 cm/s from the values calculated from the predictions at every sample.
+  // This corresponds to an error of the doppler factor below 5e-11, or 0.05 Hz
+  // at 1 GHz.
+  TimeDifference propagation_step{TimeDifference::FromSeconds(10)};
+};
+
+using DopplerTableResult =
+    Result<std::vector<DopplerSample>, OrbitalState::Error>;
+
+// Calculate a time-ordered table of the range, range rate, and doppler factor
+// of the satellite relative to an observer, with samples at
+// start_time + i * options.time_step up to and including the end_time.
+//
+// This is typically used to generate doppler correction for an entire pass,
+// between its AOS and LOS. The doppler factor does not depend on the
+// frequency, so the same table is used for all transmitters of the satellite:
+// the received frequency is the transmitter frequency multiplied by the factor.
+//
+// Returns an error if the prediction of the satellite fails at any point
+// within the time range.
+auto CalculateDopplerTable(const DopplerTableOptions& options,
+                           const OrbitalState& orbital_state,
+                           const ObserverFrame& observer_frame,
+                           const Time& start_time,
+                           const Time& end_time) -> DopplerTableResult;
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -0,0 +1,170 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/catalog_propagator.h"
+
+#include "astro_core/base/constants.h"
+#include "astro_core/parallel/parallel_for.h"
+#include "astro_core/satellite/database.h"
+#include "astro_core/time/format/julian_date.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+namespace {
+
+namespace SGP4Funcs = sgp_internal::SGP4Funcs;
+
+// Minimum number of satellites propagated by a single task of an executor.
+constexpr int kNumNearEarthSatellitesPerTask = 256;
+constexpr int kNumDeepSpaceSatellitesPerTask = 32;
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Catalog propagator.
+
+void CatalogPropagator::Clear() {
+  catalog_numbers_.clear();
+
+  near_earth_.clear();
+  deep_space_.clear();
+
+  positions_.clear();
+  velocities_.clear();
+  errors_.clear();
+}
+
+auto CatalogPropagator::AddSatellite(const int catalog_number, const TLE& tle)
+    -> bool {
+  OrbitalState orbital_state;
+  if (!orbital_state.InitializeFromTLE(tle)) {
+    return false;
+  }
+
+  const int index = catalog_numbers_.size();
+
+  const sgp_internal::elsetrec& satrec = orbital_state.sgp4_satrec_;
+  if (satrec.method == 'd') {
+    deep_space_.push_back({.index = index, .orbital_state = orbital_state});
+  } else {
+    near_earth_.push_back({.index = index, .satrec = satrec});
+  }
+
+  catalog_numbers_.push_back(catalog_number);
+
+  positions_.emplace_back();
+  velocities_.emplace_back();
+  errors_.emplace_back();
+
+  return true;
+}
+
+auto CatalogPropagator::AddSatellites(const SatelliteDatabase& database)
+    -> int {
+  int num_added_satellites = 0;
+
+  database.ForeachSatellite([&](const ConstSatelliteDAO satellite_dao) {
+    if (AddSatellite(satellite_dao.GetCatalogNumber(),
+                     satellite_dao.GetTLE())) {
+      ++num_added_satellites;
+    }
+  });
+
+  return num_added_satellites;
+}
+
+void CatalogPropagator::Propagate(const Time& time) {
+  PropagateUsingExecutor(time, nullptr);
+}
+
+void CatalogPropagator::Propagate(const Time& time, Executor& executor) {
+  PropagateUsingExecutor(time, &executor);
+}
+
+void CatalogPropagator::PropagateUsingExecutor(const Time& time,
+                                               Executor* executor) {
+  const Time time_utc = time.ToScale<TimeScale::kUTC>();
+  const DoubleDouble jd_utc(time_utc.AsFormat<JulianDate>());
+
+  time_ = time;
+
+  // Every satellite writes its result to its own element of the result arrays,
+  // so the satellites can be propagated in any order.
+  ParallelFor(executor,
+              near_earth_.size(),
+              kNumNearEarthSatellitesPerTask,
+              [&](const int begin, const int end) {
+                PropagateNearEarth(jd_utc, begin, end);
+              });
+  ParallelFor(executor,
+              deep_space_.size(),
+              kNumDeepSpaceSatellitesPerTask,
+              [&](const int begin, const int end) {
+                PropagateDeepSpace(time_utc, time, begin, end);
+              });
+}
+
+void CatalogPropagator::PropagateNearEarth(const DoubleDouble& jd_utc,
+                                           const int begin,
+                                           const int end) {
+  for (int i = begin; i < end; ++i) {
+    const NearEarthSatellite& satellite = near_earth_[i];
+    const sgp_internal::elsetrec& satrec = satellite.satrec;
+
+    const DoubleDouble jd_epoch{satrec.jdsatepoch, satrec.jdsatepochF};
+    const double time_since_epoch_min =
+        double((jd_utc - jd_epoch) * constants::kNumMinutesInDay);
+
+    // The prediction only reads the satrec, the values modified by the SGP4
+    // model are stored in the local state.
+    sgp_internal::elsetrec_state state;
+    SGP4Funcs::sgp4initstate(satrec, state);
+
+    Vec3 position, velocity;
+    if (!SGP4Funcs::sgp4(satrec,
+                         state,
+                         time_since_epoch_min,
+                         position.Pointer(),
+                         velocity.Pointer())) {
+      errors_[satellite.index] = OrbitalState::TranslateSGP4Error(state.error);
+      continue;
+    }
+
+    // Convert kilometers provided by the SGP4 to meters which is the expected
+    // units in the API.
+    positions_[satellite.index] = position * 1000.0;
+    velocities_[satellite.index] = velocity * 1000.0;
+    errors_[satellite.index] = std::nullopt;
+  }
+}
+
+void CatalogPropagator::PropagateDeepSpace(const Time& time_utc,
+                                           const Time& time,
+                                           const int begin,
+                                           const int end) {
+  for (int i = begin; i < end; ++i) {
+    const DeepSpaceSatellite& satellite = deep_space_[i];
+
+    const OrbitalState::PredictResult result =
+        satellite.orbital_state.PredictUTC(time_utc, time);
+    if (!result.Ok()) {
+      errors_[satellite.index] = result.GetError();
+      continue;
+    }
+
+    const TEME& teme = result.GetValue();
+
+    positions_[satellite.index] = teme.position.GetCartesian();
+    velocities_[satellite.index] = teme.velocity.GetCartesian();
+    errors_[satellite.index] = std::nullopt;
+  }
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,96 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/catalog_propagator.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "tl_io/tl_io_file.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/satellite/database.h"
+#include "astro_core/satellite/database_3le.h"
+#include "astro_core/time/format/date_time.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Load the active satellites list provided by CelesTrak.
+// Returns false if the list could not be read.
+auto LoadActiveSatellites(SatelliteDatabase& database) -> bool {
+  using File = tiny_lib::io_file::File;
+  using Path = std::filesystem::path;
+
+  std::string elements_3le;
+  if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                          Path("celestrak") / "active.txt"),
+                      elements_3le)) {
+    return false;
+  }
+
+  return Load3LE(database, elements_3le);
+}
+
+// Time to which the satellites are propagated: close to the epochs of the
+// active satellites list.
+const Time kPropagationTime{DateTime(2023, 1, 1, 12, 0, 0), TimeScale::kUTC};
+
+}  // namespace
+
+// Propagation of the entire active satellites catalog to a single time.
+BENCHMARK(CatalogPropagator, Propagate_Active) {
+  SatelliteDatabase database;
+  if (!LoadActiveSatellites(database)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  CatalogPropagator propagator;
+  propagator.AddSatellites(database);
+
+  for (auto _ : state) {
+    propagator.Propagate(kPropagationTime);
+    DoNotOptimize(propagator.GetPositions());
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() *
+                             propagator.GetNumSatellites());
+}
+
+// Prediction of the same satellites using individual OrbitalState::Predict()
+// calls, for comparison.
+BENCHMARK(CatalogPropagator, Predict_Active) {
+  SatelliteDatabase database;
+  if (!LoadActiveSatellites(database)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  std::vector<OrbitalState> orbital_states;
+  database.ForeachSatellite([&](const ConstSatelliteDAO satellite_dao) {
+    OrbitalState orbital_state;
+    if (orbital_state.InitializeFromTLE(satellite_dao.GetTLE())) {
+      orbital_states.push_back(orbital_state);
+    }
+  });
+
+  for (auto _ : state) {
+    for (const OrbitalState& orbital_state : orbital_states) {
+      DoNotOptimize(orbital_state.Predict(kPropagationTime));
+    }
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() * orbital_states.size());
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
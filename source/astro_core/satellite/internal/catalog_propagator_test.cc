@@ -0,0 +1,159 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/catalog_propagator.h"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "astro_core/parallel/thread_pool.h"
+#include "astro_core/satellite/database.h"
+#include "astro_core/satellite/database_3le.h"
+#include "astro_core/satellite/tle_parser.h"
+#include "astro_core/time/format/date_time.h"
+#include "astro_core/unittest/test.h"
+#include "tl_io/tl_io_file.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+class CatalogPropagatorTest : public testing::Test {
+ protected:
+  auto LoadActiveElementsDatabase() -> SatelliteDatabase {
+    using Path = std::filesystem::path;
+    using File = tiny_lib::io_file::File;
+
+    const Path active_elements_path =
+        testing::TestFileAbsolutePath(Path("celestrak") / "active.txt");
+
+    std::string elements_3le;
+    if (!File::ReadText(active_elements_path, elements_3le)) {
+      ADD_FAILURE() << "Error reading " << active_elements_path;
+      return {};
+    }
+
+    SatelliteDatabase db;
+    Load3LE(db, elements_3le);
+
+    return db;
+  }
+};
+
+TEST_F(CatalogPropagatorTest, AddSatellite) {
+  CatalogPropagator propagator;
+
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563");
+  ASSERT_TRUE(tle.Ok());
+
+  EXPECT_TRUE(propagator.AddSatellite(25544, tle.GetValue()));
+
+  EXPECT_EQ(propagator.GetNumSatellites(), 1);
+  EXPECT_EQ(propagator.GetCatalogNumber(0), 25544);
+
+  propagator.Clear();
+  EXPECT_EQ(propagator.GetNumSatellites(), 0);
+}
+
+// Propagate all satellites from the active elements database, which includes
+// both near-Earth and deep-space satellites, and compare the result with the
+// prediction of individual satellites.
+TEST_F(CatalogPropagatorTest, Propagate) {
+  const SatelliteDatabase db = LoadActiveElementsDatabase();
+
+  CatalogPropagator propagator;
+  const int num_satellites = propagator.AddSatellites(db);
+  ASSERT_GT(num_satellites, 0);
+  EXPECT_EQ(propagator.GetNumSatellites(), num_satellites);
+
+  const Time time{DateTime(2023, 1, 1, 12, 0, 0), TimeScale::kUTC};
+
+  propagator.Propagate(time);
+
+  EXPECT_EQ(propagator.GetTime(), time);
+  ASSERT_EQ(propagator.GetPositions().size(), num_satellites);
+  ASSERT_EQ(propagator.GetVelocities().size(), num_satellites);
+
+  for (int i = 0; i < num_satellites; ++i) {
+    const int catalog_number = propagator.GetCatalogNumber(i);
+
+    OrbitalState orbital_state;
+    ASSERT_TRUE(orbital_state.InitializeFromTLE(
+        db.LookupSatelliteByCatalogNumber(catalog_number).GetTLE()));
+
+    const OrbitalState::PredictResult result = orbital_state.Predict(time);
+
+    if (!result.Ok()) {
+      EXPECT_EQ(propagator.GetError(i), result.GetError())
+          << "Catalog number " << catalog_number;
+      continue;
+    }
+
+    EXPECT_EQ(propagator.GetError(i), std::nullopt)
+        << "Catalog number " << catalog_number;
+
+    EXPECT_EQ(propagator.GetPositions()[i], result->position.GetCartesian())
+        << "Catalog number " << catalog_number;
+    EXPECT_EQ(propagator.GetVelocities()[i], result->velocity.GetCartesian())
+        << "Catalog number " << catalog_number;
+  }
+}
+
+TEST_F(CatalogPropagatorTest, PropagateWithExecutor) {
+  const SatelliteDatabase db = LoadActiveElementsDatabase();
+
+  CatalogPropagator propagator;
+  const int num_satellites = propagator.AddSatellites(db);
+  ASSERT_GT(num_satellites, 0);
+
+  const Time time{DateTime(2023, 1, 1, 12, 0, 0), TimeScale::kUTC};
+
+  propagator.Propagate(time);
+
+  const std::vector<Vec3> expected_positions(propagator.GetPositions().begin(),
+                                             propagator.GetPositions().end());
+  const std::vector<Vec3> expected_velocities(
+      propagator.GetVelocities().begin(), propagator.GetVelocities().end());
+  std::vector<std::optional<CatalogPropagator::Error>> expected_errors;
+  for (int i = 0; i < num_satellites; ++i) {
+    expected_errors.push_back(propagator.GetError(i));
+  }
+
+  for (const int num_threads : {1, 3}) {
+    ThreadPool thread_pool(num_threads);
+
+    // Propagate to a different time first, so that the result of the previous
+    // propagation is overwritten.
+    propagator.Propagate(time + TimeDifference::FromDays(1), thread_pool);
+    propagator.Propagate(time, thread_pool);
+
+    EXPECT_EQ(propagator.GetTime(), time);
+
+    for (int i = 0; i < num_satellites; ++i) {
+      const int catalog_number = propagator.GetCatalogNumber(i);
+
+      EXPECT_EQ(propagator.GetError(i), expected_errors[i])
+          << "Catalog number " << catalog_number;
+
+      if (expected_errors[i]) {
+        continue;
+      }
+
+      EXPECT_EQ(propagator.GetPositions()[i], expected_positions[i])
+          << "Catalog number " << catalog_number;
+      EXPECT_EQ(propagator.GetVelocities()[i], expected_velocities[i])
+          << "Catalog number " << catalog_number;
+    }
+  }
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -6,8 +6,15 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <vector>
 
+#include "astro_core/base/algorithm.h"
 #include "astro_core/base/convert.h"
+#include "astro_core/base/ctype.h"
 #include "astro_core/base/levenshtein_distance.h"
 #include "astro_core/base/static_vector.h"
 #include "astro_core/base/string.h"
@@ -58,32 +65,18 @@ auto IndexLookupIterator(Index& index,
   return it;
 }
 
-// Lookup value for the given key in the index.
-// The index is expected to be sorted by this key.
-//
-// If the key does not exist in the index false is returned and value is kept
-// untouched. Otherwise the value is assigned to the one stored in the index and
-// true is returned.
-template <typename Index>
-auto IndexLookup(Index& index,
-                 const typename Index::value_type::key_type& key,
-                 typename Index::value_type::value_type& value) -> bool {
-  auto it = IndexLookupIterator(index, key);
-  if (it == index.end()) {
-    return false;
-  }
-
-  value = it->value;
-
-  return true;
-}
-
 }  // namespace
 
 void SatelliteDatabase::Clear() {
   satellites_.clear();
   catalog_number_index_.clear();
+  catalog_number_hash_index_.Clear();
   transmitters_.clear();
+  search_words_.clear();
+  search_word_hash_index_.Clear();
+  first_unused_search_word_index_ = -1;
+
+  num_pending_index_rows_ = 0;
 }
 
 auto SatelliteDatabase::AddSatellite(const int catalog_number_id,
@@ -91,23 +84,148 @@ auto SatelliteDatabase::AddSatellite(const int catalog_number_id,
     -> SatelliteDAO {
   // Trim the name to the one which fits the database.
   Satellite& satellite = satellites_.emplace_back(catalog_number_id, name);
+  satellite.row_index = int(satellites_.size()) - 1;
 
-  IndexInsert(catalog_number_index_, catalog_number_id, &satellite);
+  IndexSatelliteSearchWords(satellite);
+
+  if (num_bulk_loads_ != 0) {
+    catalog_number_index_.emplace_back(catalog_number_id, &satellite);
+    ++num_pending_index_rows_;
+  } else {
+    IndexInsert(catalog_number_index_, catalog_number_id, &satellite);
+  }
+
+  // The satellite which was added first stays in the hash index.
+  catalog_number_hash_index_.Insert(catalog_number_id, &satellite);
 
   return SatelliteDAO(this, &satellite);
 }
 
+void SatelliteDatabase::BeginBulkLoad() { ++num_bulk_loads_; }
+
+void SatelliteDatabase::CommitBulkLoad() {
+  assert(num_bulk_loads_ > 0);
+
+  if (--num_bulk_loads_ != 0) {
+    return;
+  }
+
+  SortPendingIndexRows();
+  MergeDuplicateSatellites();
+}
+
+void SatelliteDatabase::SortPendingIndexRows() {
+  using Row = CatalogNumberIndex::value_type;
+
+  if (num_pending_index_rows_ == 0) {
+    return;
+  }
+
+  auto key_less = [](const Row& lhs, const Row& rhs) {
+    return lhs.key < rhs.key;
+  };
+
+  // The stable algorithms keep the rows with the same key in the order in which
+  // they were added to the index.
+  const auto pending_begin_it =
+      catalog_number_index_.end() - num_pending_index_rows_;
+  std::stable_sort(pending_begin_it, catalog_number_index_.end(), key_less);
+  std::inplace_merge(catalog_number_index_.begin(),
+                     pending_begin_it,
+                     catalog_number_index_.end(),
+                     key_less);
+
+  num_pending_index_rows_ = 0;
+}
+
+void SatelliteDatabase::MergeDuplicateSatellites() {
+  // Merge the satellites, and remove index rows of the merged ones.
+  auto write_it = catalog_number_index_.begin();
+  for (auto read_it = catalog_number_index_.begin();
+       read_it != catalog_number_index_.end();
+       ++read_it) {
+    if (write_it == catalog_number_index_.begin() ||
+        std::prev(write_it)->key != read_it->key) {
+      if (write_it != read_it) {
+        *write_it = std::move(*read_it);
+      }
+      ++write_it;
+      continue;
+    }
+
+    Satellite& satellite = *std::prev(write_it)->value;
+    Satellite& duplicate = *read_it->value;
+
+    satellite.tle = duplicate.tle;
+
+    Transmitter* transmitter = duplicate.transmitters.GetHead();
+    while (transmitter != nullptr) {
+      Transmitter* next_transmitter = transmitter->next;
+      satellite.transmitters.Append(transmitter);
+      transmitter = next_transmitter;
+    }
+    duplicate.transmitters.Clear();
+  }
+
+  const size_t num_unique_satellites =
+      write_it - catalog_number_index_.begin();
+  if (num_unique_satellites == satellites_.size()) {
+    return;
+  }
+
+  while (catalog_number_index_.size() != num_unique_satellites) {
+    catalog_number_index_.pop_back();
+  }
+
+  // Remove the merged satellites from the table, which are the ones the index
+  // does not point to. The order of the remaining satellites is preserved.
+  // Most of the satellites past the first merged one move, so the posting
+  // lists of the search words are re-built once afterwards.
+  size_t write_index = 0;
+  for (size_t read_index = 0; read_index < satellites_.size(); ++read_index) {
+    Satellite& satellite = satellites_[read_index];
+
+    Satellite** hash_value =
+        catalog_number_hash_index_.Lookup(satellite.catalog_number);
+    if (*hash_value != &satellite) {
+      ReleaseSatelliteSearchWords(satellite);
+      continue;
+    }
+
+    if (write_index != read_index) {
+      Satellite& moved_satellite = satellites_[write_index];
+      moved_satellite = std::move(satellite);
+      moved_satellite.row_index = int(write_index);
+
+      *hash_value = &moved_satellite;
+      IndexLookupIterator(catalog_number_index_,
+                          moved_satellite.catalog_number)
+          ->value = &moved_satellite;
+    }
+    ++write_index;
+  }
+
+  while (satellites_.size() != write_index) {
+    satellites_.pop_back();
+  }
+
+  RebuildSearchWordPostings();
+}
+
 auto SatelliteDatabase::LookupSatelliteByCatalogNumber(const int catalog_number)
     -> SatelliteDAO {
-  Satellite* satellite{nullptr};
-  if (!IndexLookup(catalog_number_index_, catalog_number, satellite)) {
+  Satellite* const* satellite =
+      catalog_number_hash_index_.Lookup(catalog_number);
+  if (!satellite) {
     return SatelliteDAO(nullptr, nullptr);
   }
-  return SatelliteDAO(this, satellite);
+  return SatelliteDAO(this, *satellite);
 }
 
 void SatelliteDatabase::RemoveSatelliteByCatalogNumber(
     const int catalog_number) {
+  SortPendingIndexRows();
+
   auto index_it = IndexLookupIterator(catalog_number_index_, catalog_number);
   if (index_it == catalog_number_index_.end()) {
     return;
@@ -115,6 +233,20 @@ void SatelliteDatabase::RemoveSatelliteByCatalogNumber(
 
   Satellite* satellite = index_it->value;
 
+  // The first row of the catalog number is the one the hash index points to.
+  // Point the hash index to the next satellite with the same catalog number,
+  // if there is one.
+  {
+    const auto next_index_it = std::next(index_it);
+    if (next_index_it != catalog_number_index_.end() &&
+        next_index_it->key == catalog_number) {
+      catalog_number_hash_index_.InsertOrAssign(catalog_number,
+                                                next_index_it->value);
+    } else {
+      catalog_number_hash_index_.Erase(catalog_number);
+    }
+  }
+
   // TODO(sergey): Re-claim the memory used by transmitters of the satellite.
   // Either re-locate transmitters from the end of the table to the freed slots,
   // or mark the freed transmitters as such and re-use them when new items are
@@ -123,29 +255,48 @@ void SatelliteDatabase::RemoveSatelliteByCatalogNumber(
   // Currently the transmitters of the removed satellites are dangling pointers,
   // which don't have any other side effect as extra memory usage.
 
+  ReleaseSatelliteSearchWords(*satellite);
+
   if (satellite == &satellites_.back()) {
     satellites_.pop_back();
     catalog_number_index_.erase(index_it);
     return;
   }
 
+  const Satellite* moved_satellite = &satellites_.back();
+
+  const int row_index = satellite->row_index;
   *satellite = std::move(satellites_.back());
   satellites_.pop_back();
 
+  MoveSatelliteSearchWords(*satellite, row_index);
+
   catalog_number_index_.erase(index_it);
 
+  // During the bulk load there might be multiple satellites with the same
+  // catalog number, so find the index row which points to the moved one.
   auto moved_index_it =
       IndexLookupIterator(catalog_number_index_, satellite->catalog_number);
+  while (moved_index_it->value != moved_satellite) {
+    ++moved_index_it;
+  }
   moved_index_it->value = satellite;
+
+  Satellite** moved_hash_value =
+      catalog_number_hash_index_.Lookup(satellite->catalog_number);
+  if (*moved_hash_value == moved_satellite) {
+    *moved_hash_value = satellite;
+  }
 }
 
 auto SatelliteDatabase::LookupSatelliteByCatalogNumber(
     const int catalog_number) const -> ConstSatelliteDAO {
-  Satellite* satellite{nullptr};
-  if (!IndexLookup(catalog_number_index_, catalog_number, satellite)) {
+  Satellite* const* satellite =
+      catalog_number_hash_index_.Lookup(catalog_number);
+  if (!satellite) {
     return ConstSatelliteDAO(nullptr, nullptr);
   }
-  return ConstSatelliteDAO(this, satellite);
+  return ConstSatelliteDAO(this, *satellite);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +310,13 @@ void SatelliteDatabase::SatelliteSearchResult::Add(SatelliteDAO satellite_dao,
   }
 
   // Remove the least plausible element.
+  // If the new element is not more plausible than the one before it, it is
+  // inserted at its place.
   if (satellite_scores.size() == satellite_scores.capacity()) {
+    if (score <= satellite_scores[satellite_scores.size() - 2].score) {
+      satellite_scores.back() = SatelliteScore{satellite_dao, score};
+      return;
+    }
     satellite_scores.pop_back();
   }
 
@@ -240,83 +397,380 @@ auto WordSearchScore(const std::string_view word, const std::string_view query)
   return (max_cost - levenshtein_distance.GetCost()) / max_cost;
 }
 
-// Calculate score of the satellite: how well it matches the query. Higher the
-// score better the match is.
-auto SatelliteSearchScore(SatelliteDAO satellite_dao,
-                          const QueryWords& query_words) -> float {
-  float final_score = 0;
+// Bit of the character in the SearchWord::character_mask.
+inline auto SearchCharacterBit(const char ch) -> uint64_t {
+  const int lower_ch = ToLowerASCII(ch);
 
-  std::array<bool, QueryWords::kMaxWords> used_query_words{};
+  if (lower_ch >= 'a' && lower_ch <= 'z') {
+    return uint64_t(1) << (lower_ch - 'a');
+  }
+  if (lower_ch >= '0' && lower_ch <= '9') {
+    return uint64_t(1) << (lower_ch - '0' + 26);
+  }
 
-  auto handle_satellite_word = [&](const std::string_view satellite_word) {
-    int best_query_word_index = -1;
-    float best_score = 0.0f;
+  return uint64_t(1) << 63;
+}
 
-    for (int i = 0; i < query_words.words.size(); ++i) {
-      if (used_query_words[i]) {
-        continue;
-      }
-      const std::string_view query_word = query_words.words[i];
-      const float score = WordSearchScore(satellite_word, query_word);
-
-      // Ignore scores of 0 (happens due to the initial value of best_score)
-      // as it means the word did not match the query at all.
-      if (score > best_score) {
-        best_score = score;
-        best_query_word_index = i;
-      }
+// Calculate the SearchWord::character_mask of the text.
+auto SearchCharacterMask(const std::string_view text) -> uint64_t {
+  uint64_t mask = 0;
+  for (const char ch : text) {
+    mask |= SearchCharacterBit(ch);
+  }
+  return mask;
+}
+
+// FNV-1a hash of the text of a search word.
+auto SearchWordHash(const std::string_view text) -> uint64_t {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (const char ch : text) {
+    hash ^= uint8_t(ch);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+// Query word prepared for calculation of the score of many words.
+//
+// Gives the same score as the WordSearchScore(), but uses the character mask of
+// the word to skip the checks which can not succeed, and calculates the
+// Levenshtein distance using the bit-parallel algorithm.
+class QueryWordMatcher {
+  using LevenshteinCost = CaseInsensitiveLevenshteinCost;
+  using SearchWord = satellite_database_internal::SearchWord;
+
+ public:
+  explicit QueryWordMatcher(const std::string_view query)
+      : query_(query),
+        character_mask_(SearchCharacterMask(query)),
+        has_letters_(std::any_of(query.begin(), query.end(), IsLatin)),
+        levenshtein_cost_(
+            query.substr(0, Min(query.size(), kMaxFastQueryLength))) {}
+
+  auto Score(const SearchWord& word) const -> float {
+    const std::string_view text = word.text;
+
+    // The WordSearchScore() trims the strings to kMaxFastWordLength for the
+    // Levenshtein distance. Such long words and queries are not expected, and
+    // are handled by it.
+    if (query_.size() > kMaxFastQueryLength ||
+        text.size() > kMaxFastWordLength) {
+      return WordSearchScore(text, query_);
     }
 
-    if (best_query_word_index != -1) {
-      used_query_words[best_query_word_index] = true;
+    if (text.empty() || query_.empty()) {
+      return 0.0f;
+    }
 
-      // Simple accumulation, which also makes it so more words from the
-      // query matched higher the satellite will be in the result.
-      //
-      // TODO(sergey): There could be better normalization strategies to
-      // either give extra priority to results where all words matched, or
-      // give extra penalty if some query words were not used.
-      final_score += best_score;
+    if (text == query_) {
+      return 3.0f;
     }
-  };
 
-  char catalog_number_str[32];
-  IntToStringBuffer(satellite_dao.GetCatalogNumber(), catalog_number_str);
+    const uint64_t common_character_mask =
+        word.character_mask & character_mask_;
+
+    // The word can only contain the query if it has all of its characters.
+    // The case-insensitive comparison is the same as the exact one when the
+    // query has no letters, such as a query of a catalog number.
+    if (common_character_mask == character_mask_) {
+      if (has_letters_ ? CaseInsensitiveStartsWith(text, query_)
+                       : text.starts_with(query_)) {
+        return 2.0f;
+      }
+      if ((has_letters_ ? CaseInsensitiveFind(text, query_)
+                        : text.find(query_)) != std::string_view::npos) {
+        return 1.0f;
+      }
+    }
+
+    // The Levenshtein distance is not less than the difference of the lengths
+    // of the strings, and is the length of the longer string if they have no
+    // characters in common. Either way it is too big for the query.
+    if (text.size() >= 2 * query_.size() || common_character_mask == 0) {
+      return 0.0f;
+    }
 
-  handle_satellite_word(catalog_number_str);
+    const int cost = levenshtein_cost_(text);
+    if (size_t(cost) >= query_.size()) {
+      return 0.0f;
+    }
 
-  // Greedy maximization of the match between words of the name and the query.
-  for (const std::string_view name_word :
-       ForeachWord(satellite_dao.GetName())) {
-    handle_satellite_word(name_word);
+    const float max_cost = text.size() + query_.size();
+    return (max_cost - cost) / max_cost;
   }
 
-  return final_score;
-}
+ private:
+  static constexpr size_t kMaxFastQueryLength =
+      LevenshteinCost::kMaxPatternLength;
+  static constexpr size_t kMaxFastWordLength = 256;
+
+  std::string_view query_;
+  uint64_t character_mask_;
+  bool has_letters_;
+  LevenshteinCost levenshtein_cost_;
+};
 
 }  // namespace
 
 auto SatelliteDatabase::SearchSatellites(const std::string_view query)
     -> SatelliteSearchResult {
   const QueryWords query_words(query);
+  const size_t num_query_words = query_words.words.size();
 
   SatelliteSearchResult result;
 
-  ForeachSatellite([&](SatelliteDAO satellite_dao) {
-    const float score = SatelliteSearchScore(satellite_dao, query_words);
+  if (num_query_words == 0) {
+    return result;
+  }
+
+  std::vector<QueryWordMatcher> query_word_matchers;
+  query_word_matchers.reserve(num_query_words);
+  for (const std::string_view query_word : query_words.words) {
+    query_word_matchers.emplace_back(query_word);
+  }
+
+  // Score every distinct word against every query word.
+  // The scores of a word are stored next to each other.
+  //
+  // The satellites which use a word which matched the query are marked in a
+  // bit mask of the rows of the satellites table. Satellite none of which words
+  // matched the query has score of 0, and is not visited.
+  const size_t num_words = search_words_.size();
+  std::vector<float> word_scores(num_words * num_query_words);
+  std::vector<uint64_t> matched_satellite_rows((satellites_.size() + 63) / 64);
+  for (size_t word_index = 0; word_index < num_words; ++word_index) {
+    const SearchWord& word = search_words_[word_index];
+    if (word.satellite_row_indices.empty()) {
+      continue;
+    }
+
+    float* scores = &word_scores[word_index * num_query_words];
+
+    bool is_word_matched = false;
+    for (size_t i = 0; i < num_query_words; ++i) {
+      scores[i] = query_word_matchers[i].Score(word);
+      if (scores[i] != 0) {
+        is_word_matched = true;
+      }
+    }
+
+    if (is_word_matched) {
+      for (const int row_index : word.satellite_row_indices) {
+        matched_satellite_rows[row_index / 64] |= uint64_t(1)
+                                                  << (row_index % 64);
+      }
+    }
+  }
+
+  // Visit the satellites in the order of the table, so that the order of the
+  // satellites with the same score does not depend on the posting lists.
+  for (size_t block_index = 0; block_index < matched_satellite_rows.size();
+       ++block_index) {
+    for (uint64_t block = matched_satellite_rows[block_index]; block != 0;
+         block &= block - 1) {
+      Satellite& satellite =
+          satellites_[block_index * 64 + std::countr_zero(block)];
+      const auto& word_indices = satellite.search_word_indices;
+
+      float score = 0;
+
+      std::array<bool, QueryWords::kMaxWords> used_query_words{};
+
+      // Greedy maximization of the match between words of the satellite and
+      // the query: every word of the satellite takes the best matching query
+      // word which is not used yet.
+      for (const int word_index : word_indices) {
+        const float* scores = &word_scores[word_index * num_query_words];
+
+        int best_query_word_index = -1;
+        float best_score = 0.0f;
+
+        for (int i = 0; i < num_query_words; ++i) {
+          if (used_query_words[i]) {
+            continue;
+          }
+
+          // Ignore scores of 0 (happens due to the initial value of
+          // best_score) as it means the word did not match the query at all.
+          if (scores[i] > best_score) {
+            best_score = scores[i];
+            best_query_word_index = i;
+          }
+        }
+
+        if (best_query_word_index != -1) {
+          used_query_words[best_query_word_index] = true;
+
+          // Simple accumulation, which also makes it so more words from the
+          // query matched higher the satellite will be in the result.
+          //
+          // TODO(sergey): There could be better normalization strategies to
+          // either give extra priority to results where all words matched, or
+          // give extra penalty if some query words were not used.
+          score += best_score;
+        }
+      }
 
-    if (score != 0) {
-      result.Add(satellite_dao, score);
+      if (score != 0) {
+        result.Add(SatelliteDAO(this, &satellite), score);
+      }
     }
-  });
+  }
 
   return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Search index.
+
+void SatelliteDatabase::SetSatelliteName(Satellite& satellite,
+                                         const std::string_view name) {
+  assert(!is_in_parallel_foreach_);
+
+  satellite.name = name;
+
+  IndexSatelliteSearchWords(satellite);
+}
+
+void SatelliteDatabase::IndexSatelliteSearchWords(Satellite& satellite) {
+  ReleaseSatelliteSearchWords(satellite);
+
+  char catalog_number_str[32];
+  IntToStringBuffer(satellite.catalog_number, catalog_number_str);
+
+  AddSatelliteSearchWord(satellite, catalog_number_str);
+
+  for (const std::string_view name_word : ForeachWord(satellite.name)) {
+    AddSatelliteSearchWord(satellite, name_word);
+  }
+}
+
+void SatelliteDatabase::AddSatelliteSearchWord(Satellite& satellite,
+                                               const std::string_view text) {
+  const int word_index = FindOrAddSearchWord(text);
+
+  search_words_[word_index].satellite_row_indices.push_back(
+      satellite.row_index);
+  satellite.search_word_indices.push_back(word_index);
+}
+
+void SatelliteDatabase::ReleaseSatelliteSearchWords(Satellite& satellite) {
+  for (const int word_index : satellite.search_word_indices) {
+    ReleaseSearchWord(word_index, satellite.row_index);
+  }
+  satellite.search_word_indices.clear();
+}
+
+void SatelliteDatabase::MoveSatelliteSearchWords(Satellite& satellite,
+                                                 const int row_index) {
+  for (const int word_index : satellite.search_word_indices) {
+    auto& satellite_row_indices =
+        search_words_[word_index].satellite_row_indices;
+    *std::find(satellite_row_indices.begin(),
+               satellite_row_indices.end(),
+               satellite.row_index) = row_index;
+  }
+  satellite.row_index = row_index;
+}
+
+void SatelliteDatabase::RebuildSearchWordPostings() {
+  for (SearchWord& word : search_words_) {
+    word.satellite_row_indices.clear();
+  }
+
+  for (const Satellite& satellite : satellites_) {
+    for (const int word_index : satellite.search_word_indices) {
+      search_words_[word_index].satellite_row_indices.push_back(
+          satellite.row_index);
+    }
+  }
+}
+
+auto SatelliteDatabase::FindOrAddSearchWord(const std::string_view text)
+    -> int {
+  const uint64_t hash = SearchWordHash(text);
+
+  int next_word_index = -1;
+
+  if (const int* first_word_index = search_word_hash_index_.Lookup(hash)) {
+    for (int word_index = *first_word_index; word_index != -1;
+         word_index = search_words_[word_index].next_word_index) {
+      if (search_words_[word_index].text == text) {
+        return word_index;
+      }
+    }
+    next_word_index = *first_word_index;
+  }
+
+  int word_index;
+  if (first_unused_search_word_index_ != -1) {
+    word_index = first_unused_search_word_index_;
+    first_unused_search_word_index_ =
+        search_words_[word_index].next_word_index;
+  } else {
+    word_index = int(search_words_.size());
+    search_words_.emplace_back();
+  }
+
+  SearchWord& word = search_words_[word_index];
+  word.text = text;
+  word.character_mask = SearchCharacterMask(text);
+  word.next_word_index = next_word_index;
+
+  search_word_hash_index_.InsertOrAssign(hash, word_index);
+
+  return word_index;
+}
+
+void SatelliteDatabase::ReleaseSearchWord(const int word_index,
+                                          const int satellite_row_index) {
+  SearchWord& word = search_words_[word_index];
+  auto& satellite_row_indices = word.satellite_row_indices;
+
+  const auto row_it = std::find(satellite_row_indices.begin(),
+                                satellite_row_indices.end(),
+                                satellite_row_index);
+  assert(row_it != satellite_row_indices.end());
+  *row_it = satellite_row_indices.back();
+  satellite_row_indices.pop_back();
+
+  if (!satellite_row_indices.empty()) {
+    return;
+  }
+
+  // Unlink the word from the list of words with the same hash.
+  const uint64_t hash = SearchWordHash(word.text);
+  int* first_word_index = search_word_hash_index_.Lookup(hash);
+  if (*first_word_index == word_index) {
+    if (word.next_word_index == -1) {
+      search_word_hash_index_.Erase(hash);
+    } else {
+      *first_word_index = word.next_word_index;
+    }
+  } else {
+    int previous_word_index = *first_word_index;
+    while (search_words_[previous_word_index].next_word_index != word_index) {
+      previous_word_index = search_words_[previous_word_index].next_word_index;
+    }
+    search_words_[previous_word_index].next_word_index = word.next_word_index;
+  }
+
+  // Free the memory of the text and of the posting list, and link the row to
+  // the list of unused rows.
+  word.text.clear();
+  word.text.shrink_to_fit();
+  satellite_row_indices.shrink_to_fit();
+  word.character_mask = 0;
+  word.next_word_index = first_unused_search_word_index_;
+  first_unused_search_word_index_ = word_index;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Satellite transmitters.
 
 auto SatelliteDatabase::AddTransmitter(Satellite& satellite) -> TransmitterDAO {
+  assert(!is_in_parallel_foreach_);
+
   Transmitter& transmitter = transmitters_.emplace_back();
 
   satellite.transmitters.Append(&transmitter);
@@ -29,9 +29,11 @@ auto TrimName(const std::string_view line1) -> std::string_view {
   return line1.substr(0, pos + 1);
 }
 
+// Parse the 3LE and add satellite to the database, or update the TLE of the
+// satellite with the same catalog number if it is already in the database.
 auto Parse3LEAndAddToDatabase(SatelliteDatabase& database,
-                              const std::array<std::string_view, 3> lines,
-                              const bool check_existing) -> bool {
+                              const std::array<std::string_view, 3> lines)
+    -> bool {
   const std::string_view name = TrimName(lines[0]);
 
   const TLEParser::Result result = TLEParser::FromLines(lines[1], lines[2]);
@@ -41,13 +43,10 @@ auto Parse3LEAndAddToDatabase(SatelliteDatabase& database,
 
   const TLE& tle = result.GetValue();
 
-  SatelliteDAO satellite_dao;
-
-  if (check_existing) {
-    satellite_dao =
-        database.LookupSatelliteByCatalogNumber(tle.satellite_catalog_number);
-  }
-
+  // The lookup uses the hash index, so it is cheap even during the bulk load.
+  // It also finds the satellites added earlier from the same text.
+  SatelliteDAO satellite_dao =
+      database.LookupSatelliteByCatalogNumber(tle.satellite_catalog_number);
   if (!satellite_dao) {
     satellite_dao = database.AddSatellite(tle.satellite_catalog_number, name);
   }
@@ -62,9 +61,9 @@ auto Parse3LEAndAddToDatabase(SatelliteDatabase& database,
 auto Load3LE(SatelliteDatabase& database, const std::string_view text) -> bool {
   bool result = true;
 
-  // If the database is currently empty can skip lookup of satellites for
-  // update, as there will be none.
-  const bool check_existing = !database.IsEmpty();
+  // The satellites which already exist in the database are updated in place,
+  // and the bulk load takes care of the index of the new ones.
+  database.BeginBulkLoad();
 
   std::array<std::string_view, 3> lines;
   int current_line_index = 0;
@@ -73,14 +72,14 @@ auto Load3LE(SatelliteDatabase& database, const std::string_view text) -> bool {
     lines[current_line_index++] = line;
 
     if (current_line_index == 3) {
-      if (!Parse3LEAndAddToDatabase(database, lines, check_existing)) {
+      if (!Parse3LEAndAddToDatabase(database, lines)) {
         result = false;
       }
       current_line_index = 0;
     }
   }
 
-  (void)database;
+  database.CommitBulkLoad();
 
   return result;
 }
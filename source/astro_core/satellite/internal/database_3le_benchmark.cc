@@ -0,0 +1,77 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/database_3le.h"
+
+#include <filesystem>
+#include <string>
+
+#include "tl_io/tl_io_file.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/satellite/database.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+using benchmark::DoNotOptimize;
+
+// Load the active satellites list provided by CelesTrak into an empty
+// database.
+BENCHMARK(Database3LE, Load3LE) {
+  using File = tiny_lib::io_file::File;
+  using Path = std::filesystem::path;
+
+  std::string elements_3le;
+  if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                          Path("celestrak") / "active.txt"),
+                      elements_3le)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  int64_t num_satellites = 0;
+  for (auto _ : state) {
+    SatelliteDatabase database;
+    DoNotOptimize(Load3LE(database, elements_3le));
+
+    database.ForeachSatellite(
+        [&](const ConstSatelliteDAO& /*satellite*/) { ++num_satellites; });
+  }
+  state.SetNumItemsProcessed(num_satellites);
+}
+
+// Load the active satellites list into a database which already has all of
+// them, updating their TLE.
+BENCHMARK(Database3LE, Load3LEUpdate) {
+  using File = tiny_lib::io_file::File;
+  using Path = std::filesystem::path;
+
+  std::string elements_3le;
+  if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                          Path("celestrak") / "active.txt"),
+                      elements_3le)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  SatelliteDatabase database;
+  Load3LE(database, elements_3le);
+
+  int64_t num_satellites = 0;
+  database.ForeachSatellite(
+      [&](const ConstSatelliteDAO& /*satellite*/) { ++num_satellites; });
+
+  for (auto _ : state) {
+    DoNotOptimize(Load3LE(database, elements_3le));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() * num_satellites);
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -33,6 +33,59 @@ TEST(satellite, Load3LE) {
   EXPECT_EQ(satellite_dao.GetTLE().element_set_number, 999);
 }
 
+TEST(satellite, Load3LEUpdate) {
+  SatelliteDatabase database;
+
+  // clang-format off
+  Load3LE(
+    database,
+    "NOAA 15                 \r\n"
+    "1 25338U 98030A   22353.84630254  .00000161  00000+0  85293-4 0  9996\r\n"
+    "2 25338  98.6264  20.7971 0011354 115.1312 245.1047 14.26209908279442\r\n"
+  );
+  SatelliteDAO noaa15_dao = database.LookupSatelliteByCatalogNumber(25338);
+  noaa15_dao.AddTransmitter();
+
+  // The satellite is repeated in the text, and already exists in the database.
+  Load3LE(
+    database,
+    "NOAA 15 UPDATED\n"
+    "1 25338U 98030A   22354.84630254  .00000161  00000+0  85293-4 0  9986\n"
+    "2 25338  98.6264  20.7971 0011354 115.1312 245.1047 14.26209908279442\n"
+    "NOAA 18\n"
+    "1 28654U 04018A   22353.89312590  .00000270  00000+0  16880-3 0  9994\n"
+    "2 28654  98.9794  49.5917 0014104 206.2549 153.7911 14.12863362954546\n"
+    "NOAA 15 UPDATED AGAIN\n"
+    "1 25338U 98030A   22355.84630254  .00000161  00000+0  85293-4 0  9976\n"
+    "2 25338  98.6264  20.7971 0011354 115.1312 245.1047 14.26209908279442\n"
+  );
+  // clang-format on
+
+  int num_satellites = 0;
+  database.ForeachSatellite(
+      [&](const SatelliteDAO& /*satellite_dao*/) { ++num_satellites; });
+  EXPECT_EQ(num_satellites, 2);
+
+  {
+    SatelliteDAO satellite_dao = database.LookupSatelliteByCatalogNumber(25338);
+    ASSERT_TRUE(satellite_dao);
+    EXPECT_EQ(satellite_dao.GetName(), "NOAA 15");
+    EXPECT_EQ(satellite_dao.GetTLE().element_set_number, 997);
+    EXPECT_NEAR(
+        satellite_dao.GetTLE().epoch.GetDecimalDay(), 355.84630254, 1e-8);
+    EXPECT_TRUE(satellite_dao.GetFirstTransmitter());
+  }
+
+  // The existing satellite is updated in place.
+  EXPECT_EQ(noaa15_dao.GetTLE().element_set_number, 997);
+
+  {
+    SatelliteDAO satellite_dao = database.LookupSatelliteByCatalogNumber(28654);
+    ASSERT_TRUE(satellite_dao);
+    EXPECT_EQ(satellite_dao.GetName(), "NOAA 18");
+  }
+}
+
 }  // namespace experimental
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -0,0 +1,171 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/database.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "tl_io/tl_io_file.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/satellite/database_3le.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Load the active satellites list provided by CelesTrak.
+// Returns false if the list could not be read.
+auto LoadActiveSatellites(SatelliteDatabase& database) -> bool {
+  using File = tiny_lib::io_file::File;
+  using Path = std::filesystem::path;
+
+  std::string elements_3le;
+  if (!File::ReadText(benchmark::BenchmarkFileAbsolutePath(
+                          Path("celestrak") / "active.txt"),
+                      elements_3le)) {
+    return false;
+  }
+
+  return Load3LE(database, elements_3le);
+}
+
+// Load the active satellites list the given number of times, which simulates a
+// larger catalog. The catalog numbers of the i-th copy of the list are offset
+// by i * 100000.
+// Returns false if the list could not be read.
+auto LoadActiveSatellitesCopies(SatelliteDatabase& database,
+                                const int num_copies) -> bool {
+  SatelliteDatabase active_database;
+  if (!LoadActiveSatellites(active_database)) {
+    return false;
+  }
+
+  database.BeginBulkLoad();
+  for (int i = 0; i < num_copies; ++i) {
+    active_database.ForeachSatellite([&](const ConstSatelliteDAO& satellite) {
+      database
+          .AddSatellite(satellite.GetCatalogNumber() + i * 100000,
+                        satellite.GetName())
+          .SetTLE(satellite.GetTLE());
+    });
+  }
+  database.CommitBulkLoad();
+
+  return true;
+}
+
+// Search the database for the given queries in a round-robin manner.
+// The database contains the given number of copies of the active satellites.
+void BenchmarkSearch(benchmark::State& state,
+                     const std::vector<std::string>& queries,
+                     const int num_copies = 1) {
+  SatelliteDatabase database;
+  if (!LoadActiveSatellitesCopies(database, num_copies)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const std::string& query = queries[i++ % queries.size()];
+
+    // Only the best few matches are typically needed by the applications,
+    // but the entire search is to be performed to find them.
+    int num_matches = 0;
+    database.ForeachSearchSatellite(
+        query, [&](const ConstSatelliteDAO& satellite) {
+          DoNotOptimize(satellite);
+          ++num_matches;
+        });
+    DoNotOptimize(num_matches);
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+}  // namespace
+
+BENCHMARK(SatelliteDatabase, SearchName) {
+  BenchmarkSearch(state, {"iss", "zarya", "noaa 19", "starlink-1007", "hst"});
+}
+
+BENCHMARK(SatelliteDatabase, SearchCatalogNumber) {
+  BenchmarkSearch(state, {"25544", "33591", "20580", "4451"});
+}
+
+// Search in a catalog of about 27000 satellites, four copies of the active
+// satellites.
+BENCHMARK(SatelliteDatabase, SearchNameLargeCatalog) {
+  BenchmarkSearch(
+      state, {"iss", "zarya", "noaa 19", "starlink-1007", "hst"}, 4);
+}
+
+BENCHMARK(SatelliteDatabase, SearchCatalogNumberLargeCatalog) {
+  BenchmarkSearch(state, {"25544", "33591", "20580", "4451"}, 4);
+}
+
+BENCHMARK(SatelliteDatabase, LookupSatelliteByCatalogNumber) {
+  SatelliteDatabase database;
+  if (!LoadActiveSatellites(database)) {
+    state.SkipWithError("Error reading active satellites");
+    return;
+  }
+
+  std::vector<int> catalog_numbers;
+  database.ForeachSatellite([&](const ConstSatelliteDAO& satellite) {
+    catalog_numbers.push_back(satellite.GetCatalogNumber());
+  });
+
+  size_t i = 0;
+  for (auto _ : state) {
+    // Alternate between existing and missing catalog numbers.
+    const int catalog_number =
+        (i % 2) ? catalog_numbers[(i * 7919) % catalog_numbers.size()]
+                : int(i % 100000) + 100000;
+    ++i;
+
+    DoNotOptimize(database.LookupSatelliteByCatalogNumber(catalog_number));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+// Add satellites in the descending order of their catalog numbers, which is
+// the worst case for keeping the index sorted.
+BENCHMARK(SatelliteDatabase, AddSatellite) {
+  constexpr int kNumSatellites = 10000;
+
+  for (auto _ : state) {
+    SatelliteDatabase database;
+    for (int i = kNumSatellites; i > 0; --i) {
+      DoNotOptimize(database.AddSatellite(i, "SATELLITE"));
+    }
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() * kNumSatellites);
+}
+
+BENCHMARK(SatelliteDatabase, BulkLoad) {
+  constexpr int kNumSatellites = 10000;
+
+  for (auto _ : state) {
+    SatelliteDatabase database;
+    database.BeginBulkLoad();
+    for (int i = kNumSatellites; i > 0; --i) {
+      DoNotOptimize(database.AddSatellite(i, "SATELLITE"));
+    }
+    database.CommitBulkLoad();
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() * kNumSatellites);
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -5,8 +5,11 @@
 #include "astro_core/satellite/database.h"
 
 #include <filesystem>
+#include <stdexcept>
 #include <vector>
 
+#include "astro_core/parallel/executor.h"
+#include "astro_core/parallel/thread_pool.h"
 #include "astro_core/satellite/database_3le.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
@@ -17,7 +20,9 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 namespace experimental {
 
+using testing::Contains;
 using testing::ElementsAre;
+using testing::Not;
 
 class SatelliteDatabaseTest : public testing::Test {
  protected:
@@ -110,6 +115,31 @@ TEST_F(SatelliteDatabaseTest, LookupSatelliteByCatalogNumber) {
   }
 }
 
+TEST_F(SatelliteDatabaseTest, LookupSatelliteByAlpha5CatalogNumber) {
+  SatelliteDatabase db;
+
+  // An analyst object seen by the space fence, with the Alpha-5 catalog
+  // number T0000.
+  // clang-format off
+  Load3LE(
+    db,
+    "ISS (ZARYA)\n"
+    "1 25544U 98067A   21275.52277778  .00006056  00000-0  11838-3 0  9993\n"
+    "2 25544  51.6416 247.4627 0006703 130.5360 325.0288 15.72125391563537\n"
+    "ANALYST\n"
+    "1 T0000U          20341.14572529  .00000446  00000-0  15605-2 0  9998\n"
+    "2 T0000  90.2902 300.0888 0031941  22.1325 338.1165 12.95152933 48676\n"
+  );
+  // clang-format on
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(25544).GetName(), "ISS (ZARYA)");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(270000).GetName(), "ANALYST");
+  EXPECT_FALSE(db.LookupSatelliteByCatalogNumber(339999));
+
+  db.AddSatellite(339999, "Z9999");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(339999).GetName(), "Z9999");
+}
+
 TEST_F(SatelliteDatabaseTest, RemoveSatelliteByCatalogNumber) {
   SatelliteDatabase db;
 
@@ -136,6 +166,177 @@ TEST_F(SatelliteDatabaseTest, RemoveSatelliteByCatalogNumber) {
   EXPECT_EQ(db.LookupSatelliteByCatalogNumber(3).GetName(), "SAT 3");
 }
 
+TEST_F(SatelliteDatabaseTest, BulkLoad) {
+  SatelliteDatabase db;
+
+  db.AddSatellite(5, "SAT 5");
+
+  db.BeginBulkLoad();
+  for (int i = 0; i < 100; ++i) {
+    db.AddSatellite((i * 37) % 100 + 10, "SAT " + std::to_string(i));
+  }
+  db.AddSatellite(1, "SAT 1");
+  db.CommitBulkLoad();
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(5).GetName(), "SAT 5");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(1).GetName(), "SAT 1");
+  for (int i = 0; i < 100; ++i) {
+    const SatelliteDAO satellite =
+        db.LookupSatelliteByCatalogNumber((i * 37) % 100 + 10);
+    ASSERT_TRUE(satellite);
+    EXPECT_EQ(std::string(satellite.GetName()), "SAT " + std::to_string(i));
+  }
+  EXPECT_FALSE(db.LookupSatelliteByCatalogNumber(0));
+  EXPECT_FALSE(db.LookupSatelliteByCatalogNumber(110));
+
+  // Adding satellites after the commit keeps the index sorted.
+  db.AddSatellite(0, "SAT 0");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(0).GetName(), "SAT 0");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(10).GetName(), "SAT 0");
+}
+
+TEST_F(SatelliteDatabaseTest, BulkLoadMergeDuplicates) {
+  SatelliteDatabase db;
+
+  SatelliteDAO existing = db.AddSatellite(2, "SAT 2");
+  existing.AddTransmitter().SetName("TX 2");
+
+  db.BeginBulkLoad();
+  {
+    SatelliteDAO satellite = db.AddSatellite(3, "SAT 3");
+    satellite.SetTLE({.element_set_number = 1});
+    satellite.AddTransmitter().SetName("TX 3.1");
+  }
+  db.AddSatellite(1, "SAT 1");
+  {
+    SatelliteDAO satellite = db.AddSatellite(2, "SAT 2 NEW");
+    satellite.SetTLE({.element_set_number = 2});
+  }
+  {
+    SatelliteDAO satellite = db.AddSatellite(3, "SAT 3 NEW");
+    satellite.SetTLE({.element_set_number = 3});
+    satellite.AddTransmitter().SetName("TX 3.2");
+  }
+  db.CommitBulkLoad();
+
+  std::vector<std::string> traversed_names;
+  db.ForeachSatellite([&traversed_names](const SatelliteDAO& satellite) {
+    traversed_names.push_back(std::string(satellite.GetName()));
+  });
+  EXPECT_THAT(traversed_names, ElementsAre("SAT 2", "SAT 3", "SAT 1"));
+
+  {
+    const SatelliteDAO satellite = db.LookupSatelliteByCatalogNumber(2);
+    EXPECT_EQ(satellite.GetName(), "SAT 2");
+    EXPECT_EQ(satellite.GetTLE().element_set_number, 2);
+    EXPECT_EQ(satellite.GetFirstTransmitter().GetName(), "TX 2");
+  }
+
+  {
+    const SatelliteDAO satellite = db.LookupSatelliteByCatalogNumber(3);
+    EXPECT_EQ(satellite.GetName(), "SAT 3");
+    EXPECT_EQ(satellite.GetTLE().element_set_number, 3);
+
+    std::vector<std::string> transmitter_names;
+    for (ConstTransmitterDAO transmitter = satellite.GetFirstTransmitter();
+         transmitter;
+         transmitter = transmitter.Next()) {
+      transmitter_names.push_back(std::string(transmitter.GetName()));
+    }
+    EXPECT_THAT(transmitter_names, ElementsAre("TX 3.1", "TX 3.2"));
+  }
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(1).GetName(), "SAT 1");
+}
+
+TEST_F(SatelliteDatabaseTest, BulkLoadLookup) {
+  SatelliteDatabase db;
+
+  db.AddSatellite(20, "SAT 20");
+
+  db.BeginBulkLoad();
+
+  // Nested bulk load does not sort the index on commit.
+  db.BeginBulkLoad();
+  db.AddSatellite(30, "SAT 30");
+  db.AddSatellite(10, "SAT 10");
+  db.AddSatellite(30, "SAT 30 NEW");
+  db.CommitBulkLoad();
+
+  // Lookup finds satellites which are not sorted into the index yet.
+  {
+    const SatelliteDatabase& const_db = db;
+    EXPECT_EQ(const_db.LookupSatelliteByCatalogNumber(20).GetName(), "SAT 20");
+    EXPECT_EQ(const_db.LookupSatelliteByCatalogNumber(10).GetName(), "SAT 10");
+    EXPECT_EQ(const_db.LookupSatelliteByCatalogNumber(30).GetName(), "SAT 30");
+    EXPECT_FALSE(const_db.LookupSatelliteByCatalogNumber(40));
+  }
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(10).GetName(), "SAT 10");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(30).GetName(), "SAT 30");
+
+  db.AddSatellite(15, "SAT 15");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(15).GetName(), "SAT 15");
+
+  db.CommitBulkLoad();
+
+  int num_satellites = 0;
+  db.ForeachSatellite([&](const SatelliteDAO& /*satellite*/) {
+    ++num_satellites;
+  });
+  EXPECT_EQ(num_satellites, 4);
+}
+
+TEST_F(SatelliteDatabaseTest, BulkLoadRemoveSatellite) {
+  SatelliteDatabase db;
+
+  db.BeginBulkLoad();
+  db.AddSatellite(1, "SAT 1");
+  db.AddSatellite(2, "SAT 2");
+  db.AddSatellite(1, "SAT 1 NEW");
+  db.AddSatellite(3, "SAT 3");
+  db.AddSatellite(1, "SAT 1 NEWER");
+
+  // Removes the first of the duplicates, and moves the last added satellite
+  // in its place.
+  db.RemoveSatelliteByCatalogNumber(1);
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(1).GetName(), "SAT 1 NEW");
+  db.CommitBulkLoad();
+
+  std::vector<std::string> traversed_names;
+  db.ForeachSatellite([&traversed_names](const SatelliteDAO& satellite) {
+    traversed_names.push_back(std::string(satellite.GetName()));
+  });
+  EXPECT_THAT(traversed_names, ElementsAre("SAT 2", "SAT 1 NEW", "SAT 3"));
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(1).GetName(), "SAT 1 NEW");
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(2).GetName(), "SAT 2");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(3).GetName(), "SAT 3");
+}
+
+// Satellites with the same catalog number added outside of the bulk load are
+// not merged, and the lookup gives the first one of them.
+TEST_F(SatelliteDatabaseTest, RemoveSatelliteWithSameCatalogNumber) {
+  SatelliteDatabase db;
+
+  db.AddSatellite(7, "SAT 7");
+  db.AddSatellite(8, "SAT 8");
+  db.AddSatellite(7, "SAT 7 NEW");
+  db.AddSatellite(9, "SAT 9");
+
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(7).GetName(), "SAT 7");
+
+  db.RemoveSatelliteByCatalogNumber(7);
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(7).GetName(), "SAT 7 NEW");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(9).GetName(), "SAT 9");
+
+  db.RemoveSatelliteByCatalogNumber(7);
+  EXPECT_FALSE(db.LookupSatelliteByCatalogNumber(7));
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(8).GetName(), "SAT 8");
+  EXPECT_EQ(db.LookupSatelliteByCatalogNumber(9).GetName(), "SAT 9");
+}
+
 TEST_F(SatelliteDatabaseTest, ForeachSatellite) {
   SatelliteDatabase db;
 
@@ -167,6 +368,110 @@ TEST_F(SatelliteDatabaseTest, ForeachSatellite) {
   }
 }
 
+TEST_F(SatelliteDatabaseTest, ParallelForeachSatellite) {
+  SatelliteDatabase db = LoadActiveElementsDatabase();
+
+  std::vector<int> expected_catalog_numbers;
+  db.ForeachSatellite([&](const ConstSatelliteDAO& satellite) {
+    expected_catalog_numbers.push_back(satellite.GetCatalogNumber());
+  });
+  ASSERT_GT(expected_catalog_numbers.size(), 1000);
+
+  ThreadPool thread_pool(3);
+
+  // Non-const iteration.
+  {
+    std::vector<int> catalog_numbers(expected_catalog_numbers.size(), -1);
+    db.ParallelForeachSatellite(
+        thread_pool, [&](const int index, const SatelliteDAO& satellite) {
+          catalog_numbers[index] = satellite.GetCatalogNumber();
+        });
+
+    EXPECT_EQ(catalog_numbers, expected_catalog_numbers);
+  }
+
+  // Const iteration.
+  {
+    const SatelliteDatabase& const_db = db;
+
+    std::vector<int> catalog_numbers(expected_catalog_numbers.size(), -1);
+    const_db.ParallelForeachSatellite(
+        thread_pool, [&](const int index, const ConstSatelliteDAO& satellite) {
+          catalog_numbers[index] = satellite.GetCatalogNumber();
+        });
+
+    EXPECT_EQ(catalog_numbers, expected_catalog_numbers);
+  }
+}
+
+// The callback of the ParallelForeachSatellite() is allowed to set the TLE of
+// the satellite, but not to modify the tables shared by all satellites.
+TEST_F(SatelliteDatabaseTest, ParallelForeachSatelliteModify) {
+  SatelliteDatabase db = LoadActiveElementsDatabase();
+
+  ThreadPool thread_pool(3);
+
+  db.ParallelForeachSatellite(
+      thread_pool, [&](const int index, SatelliteDAO satellite) {
+        TLE tle = satellite.GetTLE();
+        tle.revolution_number_at_epoch = index;
+        satellite.SetTLE(tle);
+      });
+
+  int expected_index = 0;
+  db.ForeachSatellite([&](const ConstSatelliteDAO& satellite) {
+    EXPECT_EQ(satellite.GetTLE().revolution_number_at_epoch, expected_index);
+    ++expected_index;
+  });
+
+  // The thread pool is created by the statement, so that its threads exist in
+  // the process of the death test.
+  EXPECT_DEBUG_DEATH(
+      {
+        ThreadPool death_thread_pool(3);
+        db.ParallelForeachSatellite(
+            death_thread_pool, [&](const int index, SatelliteDAO satellite) {
+              if (index == 0) {
+                satellite.SetName("RENAMED");
+              }
+            });
+      },
+      "");
+}
+
+namespace {
+
+// Executor which fails to execute the tasks.
+class FailingExecutor : public Executor {
+ public:
+  auto GetConcurrency() const -> int override { return 4; }
+
+  void Execute(const int /*num_tasks*/,
+               ExecutorTaskFunction /*function*/,
+               void* /*data*/) override {
+    ThrowOrAbort<std::runtime_error>("Executor failure");
+  }
+};
+
+}  // namespace
+
+// The database can be modified after the ParallelForeachSatellite() failed.
+TEST_F(SatelliteDatabaseTest, ParallelForeachSatelliteThrow) {
+  SatelliteDatabase db = LoadActiveElementsDatabase();
+
+  FailingExecutor executor;
+  EXPECT_THROW_OR_ABORT(
+      db.ParallelForeachSatellite(
+          executor, [&](const int /*index*/, SatelliteDAO /*satellite*/) {}),
+      std::runtime_error);
+
+  SatelliteDAO satellite = db.LookupSatelliteByCatalogNumber(25338);
+  ASSERT_TRUE(satellite);
+  satellite.SetName("RENAMED");
+  satellite.AddTransmitter();
+  EXPECT_EQ(satellite.GetName(), "RENAMED");
+}
+
 TEST_F(SatelliteDatabaseTest, SearchSatellites) {
   SatelliteDatabase db = LoadActiveElementsDatabase();
 
@@ -219,6 +524,53 @@ TEST_F(SatelliteDatabaseTest, SearchSatellites) {
   }
 }
 
+// Search index follows the modifications of the database.
+TEST_F(SatelliteDatabaseTest, SearchSatellitesModified) {
+  SatelliteDatabase db;
+
+  auto search = [&](const std::string_view query) {
+    std::vector<std::string> traversed_names;
+    db.ForeachSearchSatellite(query, [&](const ConstSatelliteDAO& satellite) {
+      traversed_names.push_back(std::string(satellite.GetName()));
+    });
+    return traversed_names;
+  };
+
+  db.AddSatellite(25338, "NOAA 15");
+  db.AddSatellite(28654, "NOAA 18");
+  db.AddSatellite(33591, "NOAA 19");
+
+  EXPECT_THAT(search("noaa 18"), ElementsAre("NOAA 18", "NOAA 15", "NOAA 19"));
+  EXPECT_THAT(search("33591"), Contains("NOAA 19"));
+  EXPECT_EQ(search("33591").front(), "NOAA 19");
+
+  db.LookupSatelliteByCatalogNumber(28654).SetName("METEOR-M 2");
+  EXPECT_THAT(search("noaa 18"), ElementsAre("NOAA 15", "NOAA 19"));
+  EXPECT_THAT(search("meteor"), ElementsAre("METEOR-M 2"));
+
+  // The words which are no longer used are re-used for the new ones.
+  db.LookupSatelliteByCatalogNumber(28654).SetName("NOAA 18");
+  EXPECT_THAT(search("meteor"), ElementsAre());
+  EXPECT_EQ(search("noaa 18").front(), "NOAA 18");
+
+  // The words of the merged satellites are released.
+  db.BeginBulkLoad();
+  db.AddSatellite(33591, "NOAA 19 DUPLICATE");
+  db.CommitBulkLoad();
+  EXPECT_EQ(search("noaa 19").front(), "NOAA 19");
+
+  db.RemoveSatelliteByCatalogNumber(28654);
+  db.RemoveSatelliteByCatalogNumber(25338);
+  EXPECT_THAT(search("noaa"), ElementsAre("NOAA 19"));
+  EXPECT_THAT(search("25338"), Not(Contains("NOAA 15")));
+
+  db.Clear();
+  EXPECT_THAT(search("noaa"), ElementsAre());
+
+  db.AddSatellite(25338, "NOAA 15");
+  EXPECT_THAT(search("noaa"), ElementsAre("NOAA 15"));
+}
+
 namespace {
 
 struct AllocatorData {
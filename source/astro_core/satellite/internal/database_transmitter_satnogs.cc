@@ -78,10 +78,14 @@ auto LoadSatNOGSTransmitters(SatelliteDatabase& database,
     return false;
   }
 
+  database.BeginBulkLoad();
+
   for (const json& transmitter_json : data_json) {
     AddTransmitter(database, transmitter_json);
   }
 
+  database.CommitBulkLoad();
+
   return true;
 }
 
@@ -4,9 +4,19 @@
 
 #include "astro_core/satellite/doppler.h"
 
+#include <algorithm>
+#include <cassert>
+#include <optional>
+
 #include "astro_core/base/constants.h"
+#include "astro_core/coordinate/frame_transform.h"
 #include "astro_core/coordinate/itrf.h"
+#include "astro_core/coordinate/observer_frame.h"
+#include "astro_core/coordinate/teme.h"
+#include "astro_core/math/math.h"
 #include "astro_core/numeric/numeric.h"
+#include "astro_core/table/shared_table.h"
+#include "astro_core/time/format/julian_date.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
@@ -31,5 +41,157 @@ auto CalculateDopplerFactor(const ITRF& site, const ITRF& satellite) -> double {
   return constants::kSpeedOfLight / (constants::kSpeedOfLight + v_relative);
 }
 
+namespace {
+
+// Position and velocity of the satellite in ITRF at a point in time, given as
+// an offset in seconds from the start time of the table.
+struct DopplerKnot {
+  double offset{0};
+  Vec3 position;
+  Vec3 velocity;
+};
+
+// Predict position and velocity of the satellite in ITRF at the given time.
+auto PredictKnot(const OrbitalState& orbital_state,
+                 const Time& start_time,
+                 const double offset,
+                 DopplerKnot& knot) -> std::optional<OrbitalState::Error> {
+  const TimeScales scales(start_time + TimeDifference::FromSeconds(offset));
+
+  const OrbitalState::PredictResult result = orbital_state.Predict(scales);
+  if (!result.Ok()) {
+    return result.GetError();
+  }
+
+  const TEME& teme = result.GetValue();
+
+  knot.offset = offset;
+  TEMEToITRFTransform::At(scales).Apply(teme.position.GetCartesian(),
+                                        teme.velocity.GetCartesian(),
+                                        knot.position,
+                                        knot.velocity);
+
+  return std::nullopt;
+}
+
+// Interpolate position and velocity between two knots at the given offset
+// using the cubic Hermite spline.
+void InterpolateKnots(const DopplerKnot& k0,
+                      const DopplerKnot& k1,
+                      const double offset,
+                      Vec3& position,
+                      Vec3& velocity) {
+  const double h = k1.offset - k0.offset;
+  if (h == 0) {
+    // Happens when the table consists of a single sample.
+    position = k0.position;
+    velocity = k0.velocity;
+    return;
+  }
+
+  const double s = (offset - k0.offset) / h;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+
+  // Basis functions and their derivatives with respect to the offset.
+  const double h00 = 2 * s3 - 3 * s2 + 1;
+  const double h10 = s3 - 2 * s2 + s;
+  const double h01 = -2 * s3 + 3 * s2;
+  const double h11 = s3 - s2;
+
+  const double dh00 = (6 * s2 - 6 * s) / h;
+  const double dh10 = 3 * s2 - 4 * s + 1;
+  const double dh01 = (-6 * s2 + 6 * s) / h;
+  const double dh11 = 3 * s2 - 2 * s;
+
+  position = k0.position * h00 + k0.velocity * (h10 * h) +
+             k1.position * h01 + k1.velocity * (h11 * h);
+  velocity = k0.position * dh00 + k0.velocity * dh10 + k1.position * dh01 +
+             k1.velocity * dh11;
+}
+
+}  // namespace
+
+auto CalculateDopplerTable(const DopplerTableOptions& options,
+                           const OrbitalState& orbital_state,
+                           const ObserverFrame& observer_frame,
+                           const Time& start_time,
+                           const Time& end_time) -> DopplerTableResult {
+  const double duration =
+      double((DoubleDouble(end_time.ToScale(start_time.GetScale())
+                               .AsFormat<JulianDate>()) -
+              DoubleDouble(start_time.AsFormat<JulianDate>())) *
+             constants::kNumSecondsInDay);
+  const double time_step = double(options.time_step.InSeconds());
+  const double propagation_step =
+      double(options.propagation_step.InSeconds());
+
+  assert(time_step > 0);
+  assert(propagation_step > 0);
+
+  std::vector<DopplerSample> samples;
+  if (duration < 0) {
+    return samples;
+  }
+
+  // Every knot looks up the Earth orientation, pin the thread for the cheap
+  // access to the tables.
+  const SharedTablePin shared_table_pin;
+
+  const Vec3& r_site = observer_frame.GetPosition();
+
+  // The last knot is at the end time, so that the interpolation never goes
+  // past the time range covered by the predictions.
+  const int num_intervals = std::max(int(Ceil(duration / propagation_step)), 1);
+  const auto knot_offset = [&](const int knot_index) {
+    return knot_index == num_intervals ? duration
+                                       : knot_index * propagation_step;
+  };
+
+  DopplerKnot k0, k1;
+  if (auto error = PredictKnot(orbital_state, start_time, 0, k0)) {
+    return *error;
+  }
+  if (auto error =
+          PredictKnot(orbital_state, start_time, knot_offset(1), k1)) {
+    return *error;
+  }
+  int interval_index = 0;
+
+  const int num_samples = int(Floor(duration / time_step)) + 1;
+  samples.reserve(num_samples);
+
+  for (int i = 0; i < num_samples; ++i) {
+    const double offset = i * time_step;
+
+    // Advance to the interval which contains the offset.
+    while (offset > k1.offset && interval_index + 1 < num_intervals) {
+      ++interval_index;
+      k0 = k1;
+      if (auto error = PredictKnot(
+              orbital_state, start_time, knot_offset(interval_index + 1), k1)) {
+        return *error;
+      }
+    }
+
+    Vec3 r_satellite, v_satellite;
+    InterpolateKnots(k0, k1, offset, r_satellite, v_satellite);
+
+    const Vec3 rho = r_satellite - r_site;
+    const double range = rho.Norm();
+    const double range_rate = v_satellite.Dot(rho) / range;
+
+    samples.push_back({
+        .time = start_time + TimeDifference::FromSeconds(offset),
+        .range = range,
+        .range_rate = range_rate,
+        .doppler_factor =
+            constants::kSpeedOfLight / (constants::kSpeedOfLight + range_rate),
+    });
+  }
+
+  return samples;
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
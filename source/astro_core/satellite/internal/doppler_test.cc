@@ -4,7 +4,20 @@
 
 #include "astro_core/satellite/doppler.h"
 
+#include <algorithm>
+
+#include "astro_core/coordinate/geodetic.h"
+#include "astro_core/coordinate/geographic.h"
 #include "astro_core/coordinate/itrf.h"
+#include "astro_core/coordinate/observer_frame.h"
+#include "astro_core/coordinate/teme.h"
+#include "astro_core/math/math.h"
+#include "astro_core/satellite/orbital_state.h"
+#include "astro_core/satellite/pass.h"
+#include "astro_core/satellite/tle.h"
+#include "astro_core/satellite/tle_parser.h"
+#include "astro_core/time/format/date_time.h"
+#include "astro_core/time/format/julian_date.h"
 #include "astro_core/unittest/test.h"
 
 namespace astro_core {
@@ -24,4 +37,77 @@ TEST(satellite, CalculateDopplerFactor) {
       CalculateDopplerFactor(site, satellite), 1.000100079243412, 1e-12);
 }
 
+TEST(satellite, CalculateDopplerTable) {
+  // ISS.
+  const TLEParser::Result tle_result = TLEParser::FromLines(
+      "1 25544U 98067A   22360.45362469  .00010331  00000+0  19125-3 0  9990",
+      "2 25544  51.6432 104.1404 0005590 189.8055 206.4927 15.49615193375001");
+  ASSERT_TRUE(tle_result.Ok());
+
+  OrbitalState orbital_state;
+  ASSERT_TRUE(orbital_state.InitializeFromTLE(tle_result.GetValue()));
+
+  const Time time{DateTime(2022, 12, 28, 12, 0), TimeScale::kUTC};
+  const ITRF site_itrf = ITRF::FromGeodetic(
+      Geodetic::FromGeographic(Geographic({
+                                   .latitude = DegreesToRadians(50.0),
+                                   .longitude = DegreesToRadians(5.0),
+                               }),
+                               time));
+  const ObserverFrame observer_frame(site_itrf);
+
+  const SatellitePass pass = PredictNextPass(
+      PredictPassOptions{.site_position = observer_frame}, orbital_state, time);
+  ASSERT_TRUE(pass.aos);
+  ASSERT_TRUE(pass.los);
+
+  const DopplerTableOptions options;
+  const DopplerTableResult result = CalculateDopplerTable(
+      options, orbital_state, observer_frame, *pass.aos, *pass.los);
+  ASSERT_TRUE(result.Ok());
+
+  const std::vector<DopplerSample>& samples = result.GetValue();
+
+  // The samples are 0.1 seconds apart, and cover the entire pass.
+  const double pass_duration =
+      double((DoubleDouble(pass.los->AsFormat<JulianDate>()) -
+              DoubleDouble(pass.aos->AsFormat<JulianDate>())) *
+             constants::kNumSecondsInDay);
+  ASSERT_EQ(samples.size(), int(Floor(pass_duration / 0.1)) + 1);
+  EXPECT_EQ(samples.front().time, *pass.aos);
+
+  double max_range_error = 0;
+  double max_range_rate_error = 0;
+  double max_doppler_factor_error = 0;
+
+  for (const DopplerSample& sample : samples) {
+    // Calculate the expected values from the prediction at the sample time.
+    const OrbitalState::PredictResult predict_result =
+        orbital_state.Predict(sample.time);
+    ASSERT_TRUE(predict_result.Ok());
+    const ITRF satellite_itrf = ITRF::FromTEME(predict_result.GetValue());
+
+    const Vec3 rho =
+        satellite_itrf.position.GetCartesian() - observer_frame.GetPosition();
+    const double expected_range = rho.Norm();
+    const double expected_range_rate =
+        Vec3(satellite_itrf.velocity.GetCartesian()).Dot(rho) / expected_range;
+    const double expected_doppler_factor =
+        CalculateDopplerFactor(site_itrf, satellite_itrf);
+
+    max_range_error =
+        std::max(max_range_error, Abs(sample.range - expected_range));
+    max_range_rate_error = std::max(
+        max_range_rate_error, Abs(sample.range_rate - expected_range_rate));
+    max_doppler_factor_error =
+        std::max(max_doppler_factor_error,
+                 Abs(sample.doppler_factor - expected_doppler_factor));
+  }
+
+  // The error bounds documented in the DopplerTableOptions.
+  EXPECT_LT(max_range_error, 1e-2);
+  EXPECT_LT(max_range_rate_error, 1e-2);
+  EXPECT_LT(max_doppler_factor_error, 5e-11);
+}
+
 }  // namespace astro_core
@@ -4,6 +4,15 @@
 
 #include "astro_core/satellite/orbital_state.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 #include "astro_core/base/constants.h"
 #include "astro_core/math/math.h"
 #include "astro_core/satellite/tle.h"
@@ -71,8 +80,168 @@ constexpr auto GetSGP4Parameters(const TLE& tle) -> SGP4Parameters {
   return parameters;
 }
 
+// Get epoch of the initialized satrec as a Julian date in the UTC scale.
+auto GetSatrecEpochInJD(const sgp_internal::elsetrec& satrec)
+    -> DoubleDouble {
+  return {satrec.jdsatepoch, satrec.jdsatepochF};
+}
+
+// Get time in minutes from the epoch to the given time in the UTC scale.
+auto GetTimeSinceEpochInMinutes(const Time& time_utc,
+                                const DoubleDouble& jd_epoch) -> double {
+  assert(time_utc.GetScale() == TimeScale::kUTC);
+
+  const DoubleDouble jd{time_utc.AsFormat<JulianDate>()};
+  return double((jd - jd_epoch) * constants::kNumMinutesInDay);
+}
+
+// Get the UTC-minus-scale difference in days which holds for all times of the
+// scale between the earliest and the latest time, or nullopt if the difference
+// changes in this range.
+//
+// The difference is 0 for UTC. For TAI and TT it only changes at leap seconds,
+// and as TAI-UTC never decreases it is the same for all times in the range if
+// it is the same at its ends. For UT1 it changes continuously.
+auto GetUTCMinusScaleInDays(const Time& earliest_time, const Time& latest_time)
+    -> std::optional<DoubleDouble> {
+  assert(earliest_time.GetScale() == latest_time.GetScale());
+
+  switch (earliest_time.GetScale()) {
+    case TimeScale::kUTC: return DoubleDouble(0);
+    case TimeScale::kUT1: return std::nullopt;
+    case TimeScale::kTAI:
+    case TimeScale::kTT: break;
+  }
+
+  const auto utc_minus_scale = [](const Time& time) -> DoubleDouble {
+    const Time time_utc = time.ToScale<TimeScale::kUTC>();
+    return DoubleDouble(time_utc.AsFormat<JulianDate>()) -
+           DoubleDouble(time.AsFormat<JulianDate>());
+  };
+
+  const DoubleDouble earliest_utc_minus_scale = utc_minus_scale(earliest_time);
+  if (utc_minus_scale(latest_time) != earliest_utc_minus_scale) {
+    return std::nullopt;
+  }
+
+  return earliest_utc_minus_scale;
+}
+
+// Get time in minutes from the epoch to the given time, using the known
+// UTC-minus-scale difference of the time, or converting the time to UTC if the
+// difference is not known.
+auto GetTimeSinceEpochInMinutes(
+    const Time& time,
+    const std::optional<DoubleDouble>& utc_minus_scale_days,
+    const DoubleDouble& jd_epoch) -> double {
+  if (!utc_minus_scale_days) {
+    return GetTimeSinceEpochInMinutes(time.ToScale<TimeScale::kUTC>(),
+                                      jd_epoch);
+  }
+
+  const DoubleDouble jd_utc =
+      DoubleDouble(time.AsFormat<JulianDate>()) + *utc_minus_scale_days;
+  return double((jd_utc - jd_epoch) * constants::kNumMinutesInDay);
+}
+
 }  // namespace
 
+// Checkpoints of the deep space resonance integrator.
+//
+// For the deep space objects in resonance the SGP4 integrates the resonance
+// effects from the epoch in steps of 720 minutes. A checkpoint is the state of
+// the integrator reached by a prediction. Prediction at a time further from the
+// epoch in the same direction resumes the integration from the closest
+// checkpoint. It performs the exact same steps as the integration from the
+// epoch, so the result is bitwise identical.
+//
+// A fixed number of the most recently used checkpoints is kept. The checkpoints
+// are safe to be used from multiple threads. The predictions do not wait for
+// each other: when the checkpoints are being accessed by another thread the
+// prediction integrates from the epoch and does not store its state, which
+// gives the same result.
+class OrbitalState::ResonanceCheckpoints {
+ public:
+  ResonanceCheckpoints() = default;
+
+  ResonanceCheckpoints(const ResonanceCheckpoints& other) {
+    const std::lock_guard lock(other.mutex_);
+    checkpoints_ = other.checkpoints_;
+    use_counter_ = other.use_counter_;
+  }
+
+  auto operator=(const ResonanceCheckpoints& other)
+      -> ResonanceCheckpoints& = delete;
+
+  // Initialize the integrator state for the prediction at the given time since
+  // epoch in minutes from the closest checkpoint.
+  //
+  // The state is not modified if there is no checkpoint to resume the
+  // integration from, or if the checkpoints are being accessed by another
+  // thread.
+  void Restore(double time_since_epoch_min,
+               sgp_internal::elsetrec_state& state);
+
+  // Store the integrator state reached by a prediction.
+  // The state is not stored if the checkpoints are being accessed by another
+  // thread.
+  void Store(const sgp_internal::elsetrec_state& state);
+
+ private:
+  static constexpr int kNumCheckpoints = 8;
+
+  struct Checkpoint {
+    // Time since epoch in minutes the integrator has reached, and the
+    // integrated values at this time. The atime of 0 denotes an unused
+    // checkpoint.
+    double atime{0};
+    double xli{0};
+    double xni{0};
+
+    // Value of the use_counter_ at the last use of this checkpoint.
+    uint64_t last_use{0};
+  };
+
+  std::array<Checkpoint, kNumCheckpoints> checkpoints_{};
+  uint64_t use_counter_{0};
+
+  mutable std::mutex mutex_;
+};
+
+OrbitalState::OrbitalState() = default;
+
+OrbitalState::OrbitalState(const OrbitalState& other)
+    : sgp4_satrec_(other.sgp4_satrec_) {
+  if (other.resonance_checkpoints_) {
+    resonance_checkpoints_ =
+        std::make_unique<ResonanceCheckpoints>(*other.resonance_checkpoints_);
+  }
+}
+
+OrbitalState::OrbitalState(OrbitalState&& other) noexcept = default;
+
+OrbitalState::~OrbitalState() = default;
+
+auto OrbitalState::operator=(const OrbitalState& other) -> OrbitalState& {
+  if (this == &other) {
+    return *this;
+  }
+
+  sgp4_satrec_ = other.sgp4_satrec_;
+
+  if (other.resonance_checkpoints_) {
+    resonance_checkpoints_ =
+        std::make_unique<ResonanceCheckpoints>(*other.resonance_checkpoints_);
+  } else {
+    resonance_checkpoints_.reset();
+  }
+
+  return *this;
+}
+
+auto OrbitalState::operator=(OrbitalState&& other) noexcept
+    -> OrbitalState& = default;
+
 auto OrbitalState::InitializeFromTLE(const TLE& tle) -> bool {
   const SGP4Parameters parameters = GetSGP4Parameters(tle);
 
@@ -84,70 +253,318 @@ auto OrbitalState::InitializeFromTLE(const TLE& tle) -> bool {
   sgp4_satrec_.epochyr = tle.epoch.GetYear() % 100;
   sgp4_satrec_.epochdays = tle.epoch.GetDecimalDay();
 
-  return SGP4Funcs::sgp4init(sgp_internal::wgs72,
-                             'i',
-                             "",
-                             parameters.epoch,
-                             parameters.bstar,
-                             parameters.ndot,
-                             parameters.nddot,
-                             parameters.ecco,
-                             parameters.argpo,
-                             parameters.inclo,
-                             parameters.mo,
-                             parameters.no_kozai,
-                             parameters.nodeo,
-                             sgp4_satrec_);
-}
+  resonance_checkpoints_.reset();
 
-namespace {
+  if (!SGP4Funcs::sgp4init(sgp_internal::wgs72,
+                               'i',
+                               "",
+                               parameters.epoch,
+                               parameters.bstar,
+                               parameters.ndot,
+                               parameters.nddot,
+                               parameters.ecco,
+                               parameters.argpo,
+                               parameters.inclo,
+                               parameters.mo,
+                               parameters.no_kozai,
+                               parameters.nodeo,
+                               sgp4_satrec_)) {
+    return false;
+  }
 
-inline auto TranslateError(const sgp_internal::elsetrec& sgp4_satrec)
-    -> OrbitalState::Error {
-  switch (sgp4_satrec.error) {
-    case 1: return OrbitalState::Error::kMeanElementsRange;
-    case 2: return OrbitalState::Error::kMeanMotionRange;
-    case 3: return OrbitalState::Error::kPortElementsRange;
-    case 4: return OrbitalState::Error::kSemiLatusRectumRange;
-    case 5: return OrbitalState::Error::kSuborbitalEpochElements;
-    case 6: return OrbitalState::Error::kSatelliteDecayed;
+  if (sgp4_satrec_.method == 'd' && sgp4_satrec_.irez != 0) {
+    resonance_checkpoints_ = std::make_unique<ResonanceCheckpoints>();
   }
 
-  return OrbitalState::Error::kError;
+  return true;
 }
 
-}  // namespace
+auto OrbitalState::TranslateSGP4Error(const int sgp4_error) -> Error {
+  switch (sgp4_error) {
+    case 1: return Error::kMeanElementsRange;
+    case 2: return Error::kMeanMotionRange;
+    case 3: return Error::kPortElementsRange;
+    case 4: return Error::kSemiLatusRectumRange;
+    case 5: return Error::kSuborbitalEpochElements;
+    case 6: return Error::kSatelliteDecayed;
+  }
+
+  return Error::kError;
+}
 
 auto OrbitalState::Predict(const Time& time) const -> PredictResult {
-  const DoubleDouble jd{time.ToScale<TimeScale::kUTC>().AsFormat<JulianDate>()};
+  return PredictUTC(time.ToScale<TimeScale::kUTC>(), time);
+}
 
-  const DoubleDouble jd_epoch{sgp4_satrec_.jdsatepoch,
-                              sgp4_satrec_.jdsatepochF};
-  const DoubleDouble time_since_epoch_min =
-      (jd - jd_epoch) * constants::kNumMinutesInDay;
+auto OrbitalState::Predict(const TimeScales& scales) const -> PredictResult {
+  return PredictUTC(scales.GetUTC(), scales.GetTime());
+}
 
-  // Make a copy to allow use from multiple threads.
-  // This is needed because the `SGP4Funcs::sgp4()` modifies the elsetrec struct
-  // passed to it.
-  //
-  // TODO(sergey): Investigate whether there is a performance impact of doing so
-  // for consecutive prediction requests.
-  sgp_internal::elsetrec local_sgp4_satrec = sgp4_satrec_;
+auto OrbitalState::PredictMany(const std::span<const Time> times,
+                               const std::span<TEME> teme) const
+    -> PredictManyResult {
+  assert(times.size() == teme.size());
+
+  const size_t num_times = times.size();
+  if (num_times == 0) {
+    return PredictManyResult(0);
+  }
+
+  // Find the range of the times, and whether they are all of the same scale
+  // which allows to convert them to UTC using a single difference.
+  const TimeScale scale = times[0].GetScale();
+  bool is_same_scale = true;
+  const Time* earliest_time = &times[0];
+  const Time* latest_time = &times[0];
+  for (const Time& time : times) {
+    if (time.GetScale() != scale) {
+      is_same_scale = false;
+      break;
+    }
+    if (time.AsFormat<JulianDate>() < earliest_time->AsFormat<JulianDate>()) {
+      earliest_time = &time;
+    }
+    if (time.AsFormat<JulianDate>() > latest_time->AsFormat<JulianDate>()) {
+      latest_time = &time;
+    }
+  }
+
+  const std::optional<DoubleDouble> utc_minus_scale_days =
+      is_same_scale ? GetUTCMinusScaleInDays(*earliest_time, *latest_time)
+                    : std::nullopt;
+
+  const DoubleDouble jd_epoch = GetSatrecEpochInJD(sgp4_satrec_);
+
+  std::vector<double> time_since_epoch_min(num_times);
+  for (size_t i = 0; i < num_times; ++i) {
+    time_since_epoch_min[i] =
+        GetTimeSinceEpochInMinutes(times[i], utc_minus_scale_days, jd_epoch);
+    teme[i].observation_time = times[i];
+  }
+
+  return PredictManySinceEpoch(time_since_epoch_min, teme);
+}
+
+auto OrbitalState::PredictMany(const Time& start_time,
+                               const TimeDifference& time_step,
+                               const std::span<TEME> teme) const
+    -> PredictManyResult {
+  const size_t num_times = teme.size();
+  if (num_times == 0) {
+    return PredictManyResult(0);
+  }
+
+  const DoubleDouble time_step_days = time_step.InDays();
+
+  // Calculate the time from the start rather than accumulate the step to
+  // avoid drift of the grid.
+  const auto grid_time = [&](const size_t i) -> Time {
+    return start_time + TimeDifference::FromDays(time_step_days * double(i));
+  };
+
+  const Time end_time = grid_time(num_times - 1);
+  const std::optional<DoubleDouble> utc_minus_scale_days =
+      time_step_days < DoubleDouble(0)
+          ? GetUTCMinusScaleInDays(end_time, start_time)
+          : GetUTCMinusScaleInDays(start_time, end_time);
+
+  const DoubleDouble jd_epoch = GetSatrecEpochInJD(sgp4_satrec_);
+
+  std::vector<double> time_since_epoch_min(num_times);
+  for (size_t i = 0; i < num_times; ++i) {
+    const Time time = grid_time(i);
+    time_since_epoch_min[i] =
+        GetTimeSinceEpochInMinutes(time, utc_minus_scale_days, jd_epoch);
+    teme[i].observation_time = time;
+  }
+
+  return PredictManySinceEpoch(time_since_epoch_min, teme);
+}
+
+auto OrbitalState::PredictManySinceEpoch(
+    const std::span<const double> time_since_epoch_min,
+    const std::span<TEME> teme) const -> PredictManyResult {
+  assert(time_since_epoch_min.size() == teme.size());
+
+  const size_t num_times = time_since_epoch_min.size();
+
+  // The deep space objects go through the prediction at individual times,
+  // which keeps the checkpoints of the resonance integrator.
+  if (sgp4_satrec_.method == 'd') {
+    sgp_internal::elsetrec_state initial_state;
+    SGP4Funcs::sgp4initstate(sgp4_satrec_, initial_state);
+
+    for (size_t i = 0; i < num_times; ++i) {
+      const PredictResult result = PredictSinceEpoch(
+          time_since_epoch_min[i], initial_state, teme[i].observation_time);
+      if (!result.Ok()) {
+        return PredictManyResult(i, result.GetError());
+      }
+      teme[i] = result.GetValue();
+    }
+
+    return PredictManyResult(num_times);
+  }
+
+  // Number of times predicted by a single call of the near-Earth model.
+  constexpr size_t kNumTimesPerBlock = 64;
+
+  double position[kNumTimesPerBlock][3];
+  double velocity[kNumTimesPerBlock][3];
+
+  for (size_t start = 0; start < num_times; start += kNumTimesPerBlock) {
+    const int num_block_times = int(Min(num_times - start, kNumTimesPerBlock));
+
+    int sgp4_error = 0;
+    const int num_predicted_times =
+        SGP4Funcs::sgp4nearearth(sgp4_satrec_,
+                                 num_block_times,
+                                 &time_since_epoch_min[start],
+                                 position,
+                                 velocity,
+                                 sgp4_error);
+
+    // Convert kilometers provided by the SGP4 to meters which is the expected
+    // units in the API.
+    for (int i = 0; i < num_predicted_times; ++i) {
+      TEME& sample_teme = teme[start + i];
+      sample_teme.position =
+          Vec3(position[i][0], position[i][1], position[i][2]) * 1000.0;
+      sample_teme.velocity =
+          Vec3(velocity[i][0], velocity[i][1], velocity[i][2]) * 1000.0;
+    }
+
+    if (num_predicted_times != num_block_times) {
+      return PredictManyResult(start + num_predicted_times,
+                               TranslateSGP4Error(sgp4_error));
+    }
+  }
+
+  return PredictManyResult(num_times);
+}
+
+auto OrbitalState::PredictUTC(const Time& time_utc,
+                              const Time& observation_time) const
+    -> PredictResult {
+  // The prediction only reads the initialized satrec, and all values which
+  // are modified by the SGP4 model are stored in the local state. This allows
+  // to use the orbital state from multiple threads without copying the satrec.
+  sgp_internal::elsetrec_state initial_state;
+  SGP4Funcs::sgp4initstate(sgp4_satrec_, initial_state);
+
+  return PredictSinceEpoch(
+      GetTimeSinceEpochInMinutes(time_utc, GetSatrecEpochInJD(sgp4_satrec_)),
+      initial_state,
+      observation_time);
+}
+
+auto OrbitalState::PredictSinceEpoch(
+    const double time_since_epoch_min,
+    const sgp_internal::elsetrec_state& initial_state,
+    const Time& observation_time) const -> PredictResult {
+  sgp_internal::elsetrec_state sgp4_state = initial_state;
+
+  if (resonance_checkpoints_) {
+    resonance_checkpoints_->Restore(time_since_epoch_min, sgp4_state);
+  }
 
   Vec3 position, velocity;
-  if (!SGP4Funcs::sgp4(local_sgp4_satrec,
-                       double(time_since_epoch_min),
-                       position.Pointer(),
-                       velocity.Pointer())) {
-    return PredictResult{TranslateError(local_sgp4_satrec)};
+  const bool ok = SGP4Funcs::sgp4(sgp4_satrec_,
+                                  sgp4_state,
+                                  time_since_epoch_min,
+                                  position.Pointer(),
+                                  velocity.Pointer());
+
+  // The integrator state is on the path from the epoch even if the prediction
+  // failed after the integration.
+  if (resonance_checkpoints_) {
+    resonance_checkpoints_->Store(sgp4_state);
+  }
+
+  if (!ok) {
+    return PredictResult{TranslateSGP4Error(sgp4_state.error)};
   }
 
   // Convert kilometers provided by the SGP4 to meters which is the expected
   // units in the API.
-  return PredictResult{TEME{{.observation_time = time,
+  return PredictResult{TEME{{.observation_time = observation_time,
                              .position = position * 1000.0,
                              .velocity = velocity * 1000.0}}};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// OrbitalState::ResonanceCheckpoints.
+
+void OrbitalState::ResonanceCheckpoints::Restore(
+    const double time_since_epoch_min, sgp_internal::elsetrec_state& state) {
+  // Resuming from a checkpoint is only an optimization, so rather than
+  // serializing concurrent predictions of the same object on the lock the
+  // contended ones integrate from the epoch.
+  const std::unique_lock lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+
+  // The dspace() resumes the integration from the state if the time is in the
+  // same direction from the epoch as the atime, and is not closer to the
+  // epoch than the atime.
+  Checkpoint* closest = nullptr;
+  for (Checkpoint& checkpoint : checkpoints_) {
+    if (checkpoint.atime * time_since_epoch_min <= 0.0 ||
+        std::abs(time_since_epoch_min) < std::abs(checkpoint.atime)) {
+      continue;
+    }
+    if (closest == nullptr ||
+        std::abs(checkpoint.atime) > std::abs(closest->atime)) {
+      closest = &checkpoint;
+    }
+  }
+
+  if (closest == nullptr) {
+    return;
+  }
+
+  closest->last_use = ++use_counter_;
+
+  state.atime = closest->atime;
+  state.xli = closest->xli;
+  state.xni = closest->xni;
+}
+
+void OrbitalState::ResonanceCheckpoints::Store(
+    const sgp_internal::elsetrec_state& state) {
+  if (state.atime == 0.0) {
+    return;
+  }
+
+  const std::unique_lock lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    return;
+  }
+
+  // The integration is deterministic, so the checkpoint at the same atime has
+  // the same values.
+  for (Checkpoint& checkpoint : checkpoints_) {
+    if (checkpoint.atime == state.atime) {
+      checkpoint.last_use = ++use_counter_;
+      return;
+    }
+  }
+
+  // Replace the least recently used checkpoint. The unused checkpoints have
+  // the smallest last_use.
+  Checkpoint& checkpoint = *std::min_element(
+      checkpoints_.begin(),
+      checkpoints_.end(),
+      [](const Checkpoint& a, const Checkpoint& b) {
+        return a.last_use < b.last_use;
+      });
+
+  checkpoint = {.atime = state.atime,
+                .xli = state.xli,
+                .xni = state.xni,
+                .last_use = ++use_counter_};
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
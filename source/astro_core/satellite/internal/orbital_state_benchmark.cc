@@ -0,0 +1,162 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/orbital_state.h"
+
+#include <vector>
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/earth/internal/earth_benchmark_data.h"
+#include "astro_core/satellite/tle.h"
+#include "astro_core/satellite/tle_parser.h"
+#include "astro_core/time/time.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Predict the satellite position every second starting from the given number
+// of days after the epoch of the TLE.
+void BenchmarkPredict(benchmark::State& state,
+                      const char* line1,
+                      const char* line2,
+                      const double num_days_since_epoch) {
+  if (!benchmark_data::SetTables()) {
+    state.SkipWithError("Error reading IERS tables");
+    return;
+  }
+
+  const TLEParser::Result tle = TLEParser::FromLines(line1, line2);
+  OrbitalState orbital_state;
+  if (!tle.Ok() || !orbital_state.InitializeFromTLE(tle.GetValue())) {
+    state.SkipWithError("Error initializing orbital state");
+    return;
+  }
+
+  const Time start_time = Time(tle->epoch, TimeScale::kUTC) +
+                          TimeDifference::FromDays(num_days_since_epoch);
+
+  int i = 0;
+  for (auto _ : state) {
+    DoNotOptimize(orbital_state.Predict(
+        start_time + TimeDifference::FromSeconds(i++ % 86400)));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+// Way of predicting the satellite position at many times.
+enum class PredictManyMode {
+  kPredict,      // Individual Predict() calls.
+  kPredictMany,  // PredictMany() at the given times.
+  kGrid,         // PredictMany() at the uniform time grid.
+};
+
+// Predict the satellite position every second during the given number of
+// seconds starting from the given number of days after the epoch of the TLE.
+// The times are in the TT scale, which requires conversion to UTC.
+void BenchmarkPredictMany(benchmark::State& state,
+                          const char* line1,
+                          const char* line2,
+                          const double num_days_since_epoch,
+                          const int num_times,
+                          const PredictManyMode mode) {
+  if (!benchmark_data::SetTables()) {
+    state.SkipWithError("Error reading IERS tables");
+    return;
+  }
+
+  const TLEParser::Result tle = TLEParser::FromLines(line1, line2);
+  OrbitalState orbital_state;
+  if (!tle.Ok() || !orbital_state.InitializeFromTLE(tle.GetValue())) {
+    state.SkipWithError("Error initializing orbital state");
+    return;
+  }
+
+  const Time start_time = (Time(tle->epoch, TimeScale::kUTC) +
+                           TimeDifference::FromDays(num_days_since_epoch))
+                              .ToScale<TimeScale::kTT>();
+  const TimeDifference time_step = TimeDifference::FromSeconds(1);
+
+  std::vector<Time> times(num_times);
+  for (int i = 0; i < num_times; ++i) {
+    times[i] = start_time + TimeDifference::FromSeconds(i);
+  }
+  std::vector<TEME> teme(num_times);
+
+  for (auto _ : state) {
+    switch (mode) {
+      case PredictManyMode::kPredict:
+        for (const Time& time : times) {
+          DoNotOptimize(orbital_state.Predict(time));
+        }
+        break;
+      case PredictManyMode::kPredictMany:
+        DoNotOptimize(orbital_state.PredictMany(times, teme));
+        break;
+      case PredictManyMode::kGrid:
+        DoNotOptimize(orbital_state.PredictMany(start_time, time_step, teme));
+        break;
+    }
+    DoNotOptimize(teme);
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations() * num_times);
+}
+
+}  // namespace
+
+// Near-Earth object.
+BENCHMARK(OrbitalState, Predict_ISS) {
+  BenchmarkPredict(
+      state,
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563",
+      1);
+}
+
+// Deep space object in geosynchronous resonance, with the TLE a month old.
+BENCHMARK(OrbitalState, Predict_GEO) {
+  BenchmarkPredict(
+      state,
+      "1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996",
+      "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428",
+      30);
+}
+
+// Prediction of the near-Earth object at 1000 times, individually and using
+// the PredictMany().
+BENCHMARK(OrbitalState, PredictManyTimes_ISS_Predict) {
+  BenchmarkPredictMany(
+      state,
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563",
+      1,
+      1000,
+      PredictManyMode::kPredict);
+}
+
+BENCHMARK(OrbitalState, PredictManyTimes_ISS_PredictMany) {
+  BenchmarkPredictMany(
+      state,
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563",
+      1,
+      1000,
+      PredictManyMode::kPredictMany);
+}
+
+BENCHMARK(OrbitalState, PredictManyTimes_ISS_Grid) {
+  BenchmarkPredictMany(
+      state,
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563",
+      1,
+      1000,
+      PredictManyMode::kGrid);
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
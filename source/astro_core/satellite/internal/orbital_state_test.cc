@@ -4,10 +4,15 @@
 
 #include "astro_core/satellite/orbital_state.h"
 
+#include <span>
+#include <thread>
+#include <vector>
+
 #include "astro_core/satellite/tle.h"
 #include "astro_core/satellite/tle_parser.h"
 #include "astro_core/time/format/date_time.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/unittest/mock.h"
 #include "astro_core/unittest/test.h"
 
@@ -90,4 +95,385 @@ TEST(OrbitalState, BasicPrediction) {
           {-2.176811755915935453, 5.163121595564016175, 5.215977759998599694}));
 }
 
+// Prediction of a deep-space object with resonance, which involves numerical
+// integration from the epoch.
+//
+// The expected values are obtained using the same code as above, with the
+// following TLE and tsince values. The difference between the TLE parsing in
+// the SGP4 library and the TLE parser in this library is at the level of 1e-10
+// km.
+//
+//   const char* gLine1 =
+//     "1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996";
+//   const char* gLine2 =
+//     "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428";
+//
+//   tsince = 31512.284304000178963179
+//     r: -40910.251179642691568006 -10220.458504273996368283
+//        0.957597855592970393
+//     v: 0.745386988775611492 -2.982824871575265213 -0.000122113233787563
+//
+//   tsince = 672.284304000177144189
+//     r: 38741.023711369671218563 16640.481577733800804708
+//        41.654485211656478327
+//     v: -1.213310091276944780 2.825254404441679412 -0.001577872664494646
+
+TEST(OrbitalState, DeepSpacePrediction) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996",
+      "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428");
+  EXPECT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  EXPECT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  const Time far_time = Time(DateTime(2023, 1, 20, 10, 0, 0), TimeScale::kUTC);
+  const Time near_time = Time(DateTime(2022, 12, 30, 0, 0, 0), TimeScale::kUTC);
+
+  // Predict the time far from the epoch first, so that if any state of the
+  // resonance integrator is kept between predictions it affects the result of
+  // the prediction at the time closer to the epoch.
+  const OrbitalState::PredictResult far_result =
+      orbital_state.Predict(far_time);
+  ASSERT_TRUE(far_result.Ok());
+
+  const OrbitalState::PredictResult near_result =
+      orbital_state.Predict(near_time);
+  ASSERT_TRUE(near_result.Ok());
+
+  EXPECT_THAT(Vec3(far_result->position.GetCartesian()) / 1000.0,
+              Pointwise(DoubleNear(1e-9),
+                        {-40910.251179642691568006,
+                         -10220.458504273996368283,
+                         0.957597855592970393}));
+  EXPECT_THAT(Vec3(far_result->velocity.GetCartesian()) / 1000.0,
+              Pointwise(DoubleNear(1e-12),
+                        {0.745386988775611492,
+                         -2.982824871575265213,
+                         -0.000122113233787563}));
+
+  EXPECT_THAT(Vec3(near_result->position.GetCartesian()) / 1000.0,
+              Pointwise(DoubleNear(1e-9),
+                        {38741.023711369671218563,
+                         16640.481577733800804708,
+                         41.654485211656478327}));
+  EXPECT_THAT(Vec3(near_result->velocity.GetCartesian()) / 1000.0,
+              Pointwise(DoubleNear(1e-12),
+                        {-1.213310091276944780,
+                         2.825254404441679412,
+                         -0.001577872664494646}));
+
+  // Repeated prediction gives exactly the same result.
+  const OrbitalState::PredictResult far_result_again =
+      orbital_state.Predict(far_time);
+  ASSERT_TRUE(far_result_again.Ok());
+  EXPECT_EQ(far_result_again->position.GetCartesian(),
+            far_result->position.GetCartesian());
+  EXPECT_EQ(far_result_again->velocity.GetCartesian(),
+            far_result->velocity.GetCartesian());
+}
+
+// Predictions which resume the resonance integration from checkpoints are
+// bitwise identical to the predictions which integrate from the epoch.
+TEST(OrbitalState, DeepSpaceResonanceCheckpoints) {
+  const char* kLines[][2] = {
+      // Geostationary, the one-day resonance.
+      {"1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996",
+       "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428"},
+      // Molniya, the half-day resonance.
+      {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+       "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"},
+  };
+
+  // Days since epoch, in an order which exercises resuming from checkpoints
+  // further and closer to the epoch, in both directions from it.
+  const double kDays[] = {
+      10.0, 10.3, 40.1, 3.2, 40.1, 20.7, -5.5, -2.25, -30.0, 0.1, 55.0, 12.0};
+
+  for (const auto& lines : kLines) {
+    const TLEParser::Result tle = TLEParser::FromLines(lines[0], lines[1]);
+    ASSERT_TRUE(tle.Ok());
+
+    OrbitalState orbital_state;
+    ASSERT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+    const Time epoch(tle->epoch, TimeScale::kUTC);
+
+    for (const double days : kDays) {
+      const Time time = epoch + TimeDifference::FromDays(days);
+
+      OrbitalState fresh_orbital_state;
+      ASSERT_TRUE(fresh_orbital_state.InitializeFromTLE(tle.GetValue()));
+
+      const OrbitalState::PredictResult expected_result =
+          fresh_orbital_state.Predict(time);
+      ASSERT_TRUE(expected_result.Ok());
+
+      const OrbitalState::PredictResult result = orbital_state.Predict(time);
+      ASSERT_TRUE(result.Ok());
+
+      EXPECT_EQ(result->position.GetCartesian(),
+                expected_result->position.GetCartesian());
+      EXPECT_EQ(result->velocity.GetCartesian(),
+                expected_result->velocity.GetCartesian());
+
+      // The copy of the orbital state keeps the checkpoints.
+      const OrbitalState copy = orbital_state;
+      const OrbitalState::PredictResult copy_result = copy.Predict(time);
+      ASSERT_TRUE(copy_result.Ok());
+      EXPECT_EQ(copy_result->position.GetCartesian(),
+                expected_result->position.GetCartesian());
+
+      // So does the assignment to an orbital state without checkpoints.
+      OrbitalState assigned;
+      assigned = orbital_state;
+      const OrbitalState::PredictResult assigned_result =
+          assigned.Predict(time);
+      ASSERT_TRUE(assigned_result.Ok());
+      EXPECT_EQ(assigned_result->position.GetCartesian(),
+                expected_result->position.GetCartesian());
+    }
+  }
+}
+
+TEST(OrbitalState, DeepSpaceResonanceCheckpointsConcurrent) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996",
+      "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428");
+  ASSERT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  ASSERT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  const Time epoch(tle->epoch, TimeScale::kUTC);
+
+  constexpr int kNumTimes = 64;
+
+  std::vector<Time> times;
+  std::vector<Vec3> expected_positions;
+  for (int i = 0; i < kNumTimes; ++i) {
+    const double days = (i % 2 ? 1.0 : -1.0) * double((i * 37) % kNumTimes);
+    times.push_back(epoch + TimeDifference::FromDays(days));
+
+    OrbitalState fresh_orbital_state;
+    ASSERT_TRUE(fresh_orbital_state.InitializeFromTLE(tle.GetValue()));
+
+    const OrbitalState::PredictResult result =
+        fresh_orbital_state.Predict(times.back());
+    ASSERT_TRUE(result.Ok());
+    expected_positions.push_back(result->position.GetCartesian());
+  }
+
+  constexpr int kNumThreads = 4;
+
+  std::vector<int> num_mismatches(kNumThreads, 0);
+  std::vector<std::thread> threads;
+  for (int thread_index = 0; thread_index < kNumThreads; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (int i = 0; i < kNumTimes * 4; ++i) {
+        const int time_index = (i * (thread_index + 1)) % kNumTimes;
+        const OrbitalState::PredictResult result =
+            orbital_state.Predict(times[time_index]);
+        if (!result.Ok() || result->position.GetCartesian() !=
+                                expected_positions[time_index]) {
+          ++num_mismatches[thread_index];
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (const int num_thread_mismatches : num_mismatches) {
+    EXPECT_EQ(num_thread_mismatches, 0);
+  }
+}
+
+TEST(OrbitalState, PredictTimeScales) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563");
+  EXPECT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  EXPECT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  const Time time = Time(DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kTT);
+
+  const OrbitalState::PredictResult expected_result =
+      orbital_state.Predict(time);
+  ASSERT_TRUE(expected_result.Ok());
+
+  const OrbitalState::PredictResult result =
+      orbital_state.Predict(TimeScales(time));
+  ASSERT_TRUE(result.Ok());
+
+  EXPECT_EQ(result->observation_time, time);
+  EXPECT_EQ(result->position.GetCartesian(),
+            expected_result->position.GetCartesian());
+  EXPECT_EQ(result->velocity.GetCartesian(),
+            expected_result->velocity.GetCartesian());
+}
+
+TEST(OrbitalState, PredictMany) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563");
+  EXPECT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  EXPECT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  const Time start_time = Time(DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kTT);
+  const TimeDifference time_step = TimeDifference::FromSeconds(10);
+
+  const auto expect_predictions = [&](const std::span<const Time> times,
+                                      const std::span<const TEME> teme) {
+    for (size_t i = 0; i < times.size(); ++i) {
+      const OrbitalState::PredictResult expected_result =
+          orbital_state.Predict(times[i]);
+      ASSERT_TRUE(expected_result.Ok());
+
+      EXPECT_EQ(teme[i].observation_time, times[i]);
+      EXPECT_EQ(teme[i].position.GetCartesian(),
+                expected_result->position.GetCartesian());
+      EXPECT_EQ(teme[i].velocity.GetCartesian(),
+                expected_result->velocity.GetCartesian());
+    }
+  };
+
+  // Prediction at the given times of the same scale, spanning multiple blocks
+  // of the near-Earth model.
+  {
+    std::vector<Time> times;
+    for (int i = 0; i < 150; ++i) {
+      times.push_back(start_time +
+                      TimeDifference::FromSeconds(((i * 7919) % 150) * 97.0));
+    }
+    std::vector<TEME> teme(times.size());
+
+    const OrbitalState::PredictManyResult result =
+        orbital_state.PredictMany(times, teme);
+    ASSERT_TRUE(result.Ok());
+    EXPECT_EQ(result.GetValue(), times.size());
+
+    expect_predictions(times, teme);
+  }
+
+  // Prediction at the given times of different scales.
+  {
+    const Time times[] = {
+        start_time,
+        (start_time + TimeDifference::FromSeconds(3600))
+            .ToScale<TimeScale::kUTC>(),
+        start_time - TimeDifference::FromSeconds(3600),
+    };
+    TEME teme[3];
+
+    const OrbitalState::PredictManyResult result =
+        orbital_state.PredictMany(times, teme);
+    ASSERT_TRUE(result.Ok());
+    EXPECT_EQ(result.GetValue(), 3);
+
+    expect_predictions(times, teme);
+  }
+
+  // Prediction at the uniform time grid.
+  {
+    std::vector<TEME> teme(100);
+
+    const OrbitalState::PredictManyResult result =
+        orbital_state.PredictMany(start_time, time_step, teme);
+    ASSERT_TRUE(result.Ok());
+    EXPECT_EQ(result.GetValue(), teme.size());
+
+    std::vector<Time> times;
+    for (size_t i = 0; i < teme.size(); ++i) {
+      times.push_back(start_time + TimeDifference::FromDays(
+                                       time_step.InDays() * double(i)));
+    }
+
+    expect_predictions(times, teme);
+  }
+}
+
+TEST(OrbitalState, PredictManyDeepSpace) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 41866U 16071A   22363.53313590 -.00000245  00000-0  00000+0 0  9996",
+      "2 41866   0.0752 249.2647 0000691  59.7958 265.6365  1.00271109 22428");
+  EXPECT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  EXPECT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  const Time start_time =
+      Time(DateTime(2023, 1, 20, 10, 0, 0), TimeScale::kUTC);
+  const TimeDifference time_step = TimeDifference::FromSeconds(-3600);
+
+  std::vector<TEME> teme(48);
+
+  const OrbitalState::PredictManyResult result =
+      orbital_state.PredictMany(start_time, time_step, teme);
+  ASSERT_TRUE(result.Ok());
+  EXPECT_EQ(result.GetValue(), teme.size());
+
+  for (size_t i = 0; i < teme.size(); ++i) {
+    const Time time =
+        start_time + TimeDifference::FromDays(time_step.InDays() * double(i));
+    const OrbitalState::PredictResult expected_result =
+        OrbitalState(orbital_state).Predict(time);
+    ASSERT_TRUE(expected_result.Ok());
+
+    EXPECT_EQ(teme[i].observation_time, time);
+    EXPECT_EQ(teme[i].position.GetCartesian(),
+              expected_result->position.GetCartesian());
+    EXPECT_EQ(teme[i].velocity.GetCartesian(),
+              expected_result->velocity.GetCartesian());
+  }
+}
+
+TEST(OrbitalState, PredictManyError) {
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 25544U 98067A   22222.24306052  .00006554  00000+0  12145-3 0  9997",
+      "2 25544  51.6455  68.8017 0005211 102.6998  65.7390 15.50299332353563");
+  EXPECT_TRUE(tle.Ok());
+
+  OrbitalState orbital_state;
+  EXPECT_TRUE(orbital_state.InitializeFromTLE(tle.GetValue()));
+
+  // The model of the satellite fails some time after the epoch: the prediction
+  // stops at the first failure, same as Predict().
+  const Time start_time =
+      Time(DateTime(2022, 8, 10, 22, 0, 0), TimeScale::kUTC);
+  const TimeDifference time_step = TimeDifference::FromDays(100);
+
+  std::vector<TEME> teme(200);
+
+  const OrbitalState::PredictManyResult result =
+      orbital_state.PredictMany(start_time, time_step, teme);
+  ASSERT_FALSE(result.Ok());
+
+  const size_t num_predicted_times = result.GetValue();
+  ASSERT_GT(num_predicted_times, 0);
+  ASSERT_LT(num_predicted_times, teme.size());
+
+  for (size_t i = 0; i <= num_predicted_times; ++i) {
+    const Time time =
+        start_time + TimeDifference::FromDays(time_step.InDays() * double(i));
+    const OrbitalState::PredictResult expected_result =
+        orbital_state.Predict(time);
+
+    if (i == num_predicted_times) {
+      ASSERT_FALSE(expected_result.Ok());
+      EXPECT_EQ(result.GetError(), expected_result.GetError());
+      break;
+    }
+
+    ASSERT_TRUE(expected_result.Ok());
+    EXPECT_EQ(teme[i].position.GetCartesian(),
+              expected_result->position.GetCartesian());
+  }
+}
+
 }  // namespace astro_core
@@ -4,13 +4,21 @@
 
 #include "astro_core/satellite/pass.h"
 
+#include <algorithm>
 #include <cassert>
 #include <optional>
+#include <vector>
 
+#include "astro_core/base/unreachable.h"
+#include "astro_core/coordinate/frame_transform.h"
 #include "astro_core/coordinate/horizontal.h"
+#include "astro_core/coordinate/observer_frame.h"
 #include "astro_core/coordinate/teme.h"
 #include "astro_core/math/math.h"
+#include "astro_core/numeric/numeric.h"
+#include "astro_core/parallel/parallel_for.h"
 #include "astro_core/satellite/orbital_state.h"
+#include "astro_core/table/shared_table.h"
 #include "astro_core/time/format/date_time.h"
 #include "astro_core/time/format/julian_date.h"
 #include "astro_core/time/time_difference.h"
@@ -53,13 +61,23 @@ namespace {
 constexpr auto kApproximateTimeStep = TimeDifference::FromSeconds(240);
 
 // TIme step used when AOS or LOS is refined from their approximate values.
+// Used by the PassRefineMethod::kStep.
 constexpr auto kRefineTimeStep = TimeDifference::FromSeconds(1);
 
 // The maximum number of steps which will be performed when looking for a
 // refined value of AOS or LOW.
+// Used by the PassRefineMethod::kStep.
 constexpr int kRefineMaxSteps = int(
     (kApproximateTimeStep.InSeconds() / kRefineTimeStep.InSeconds()).GetHi());
 
+// The maximum number of iterations of the root bracketing refinement of AOS or
+// LOS. Used by the PassRefineMethod::kRootBracketing.
+//
+// The bracket converges in a handful of iterations. The limit is only reached
+// when the time tolerance is too small to be achieved with the precision of the
+// time representation.
+constexpr int kRefineMaxIterations = 32;
+
 // Calculate the number of steps which can be done to cover the time window with
 // the time steps of given duration.
 auto GetNumPredictionSteps(const TimeDifference& time_window,
@@ -67,39 +85,37 @@ auto GetNumPredictionSteps(const TimeDifference& time_window,
   return int(Trunc(time_window.InSeconds() / time_step.InSeconds()).GetHi());
 }
 
+// Get the number of seconds from the time_a to the time_b.
+// The time points are expected to be in the same scale.
+auto GetSecondsBetween(const Time& time_a, const Time& time_b) -> double {
+  assert(time_a.GetScale() == time_b.GetScale());
+
+  return double((DoubleDouble(time_b.AsFormat<JulianDate>()) -
+                 DoubleDouble(time_a.AsFormat<JulianDate>())) *
+                constants::kNumSecondsInDay);
+}
+
 // Calculate elevation of satellite over horizon of an observer with the given
 // site coordinate at a given time.
 // If prediction is not possible then nullopt is returned.
-auto CalculateElevationAtTime(const ITRF& site_position,
+auto CalculateElevationAtTime(const ObserverFrame& site,
                               const OrbitalState& orbital_state,
                               const Time& time) -> std::optional<double> {
-  const OrbitalState::PredictResult result = orbital_state.Predict(time);
+  const TimeScales scales(time);
+
+  const OrbitalState::PredictResult result = orbital_state.Predict(scales);
   if (!result.Ok()) {
     return std::nullopt;
   }
 
   const TEME satellite_teme = result.GetValue();
-  const ITRF satellite_itrf = ITRF::FromTEME(satellite_teme);
+  const ITRF satellite_itrf =
+      ITRF::FromTEME(satellite_teme, TEMEToITRFTransform::At(scales));
 
-  const Horizontal horizontal =
-      Horizontal::FromITRF(satellite_itrf, site_position);
+  const Horizontal horizontal = site.ToHorizontal(satellite_itrf);
   return horizontal.elevation;
 }
 
-// Calculate the satellite elevation at the median of two time points.
-auto CalculateElevationAtMedian(const ITRF& site_position,
-                                const OrbitalState& orbital_state,
-                                const Time& time_a,
-                                const Time& time_b) -> std::optional<double> {
-  assert(time_a.GetScale() == time_b.GetScale());
-
-  const JulianDate median_jd =
-      (time_a.AsFormat<JulianDate>() + time_b.AsFormat<JulianDate>()) / 2;
-  const Time median_time{median_jd, time_a.GetScale()};
-
-  return CalculateElevationAtTime(site_position, orbital_state, median_time);
-}
-
 struct ApproximateAOSResult {
   // The satellite is visible at the start time point.
   bool is_visible_at_start_time{false};
@@ -203,13 +219,14 @@ auto FindApproximateAOSAboveHorizon(const PredictPassOptions& options,
 }
 
 // Refine AOS by looking backward in time until the satellite moves below the
-// horizon. Returns first time at which the satellite rise above the horizon.
+// horizon. Returns the last time point below the horizon before the satellite
+// rises above it.
 //
 // Assumes that the approximate AOS is within kApproximateTimeStep from the
 // actual AOS.
-auto RefineAOSAboveHorizon(const PredictPassOptions& options,
-                           const OrbitalState& orbital_state,
-                           const Time& approximate_aos_time) -> Time {
+auto RefineAOSAboveHorizonStep(const PredictPassOptions& options,
+                               const OrbitalState& orbital_state,
+                               const Time& approximate_aos_time) -> Time {
   Time refined_aos_time = approximate_aos_time;
   for (int i = 0; i < kRefineMaxSteps; ++i) {
     const Time previous_time = refined_aos_time - kRefineTimeStep;
@@ -269,9 +286,9 @@ auto ApproximateLOSAboveHorizon(const PredictPassOptions& options,
 //
 // Assumes that the approximate LOS is within kApproximateTimeStep from the
 // actual LOS.
-auto RefineLOSAboveHorizon(const PredictPassOptions& options,
-                           const OrbitalState& orbital_state,
-                           const astro_core::Time& approximate_los_time)
+auto RefineLOSAboveHorizonStep(const PredictPassOptions& options,
+                               const OrbitalState& orbital_state,
+                               const astro_core::Time& approximate_los_time)
     -> Time {
   Time refined_los_time = approximate_los_time;
   for (int i = 0; i < kRefineMaxSteps; ++i) {
@@ -294,6 +311,214 @@ auto RefineLOSAboveHorizon(const PredictPassOptions& options,
   return refined_los_time;
 }
 
+// Position of a satellite over the observer's horizon and the rate of change of
+// its elevation.
+struct ElevationSample {
+  Horizontal horizontal{};
+
+  // Rate of change of the elevation in radians per second.
+  double elevation_rate{0};
+};
+
+// Calculate elevation of satellite over horizon of an observer and its rate of
+// change at a given time.
+//
+// The elevation rate is derived from the satellite velocity.
+//
+// If prediction is not possible then nullopt is returned.
+auto CalculateElevationSampleAtTime(const ObserverFrame& site,
+                                    const OrbitalState& orbital_state,
+                                    const Time& time)
+    -> std::optional<ElevationSample> {
+  const TimeScales scales(time);
+
+  const OrbitalState::PredictResult result = orbital_state.Predict(scales);
+  if (!result.Ok()) {
+    return std::nullopt;
+  }
+
+  const TEME satellite_teme = result.GetValue();
+  const ITRF satellite_itrf =
+      ITRF::FromTEME(satellite_teme, TEMEToITRFTransform::At(scales));
+
+  const Horizontal horizontal = site.ToHorizontal(satellite_itrf);
+
+  // The observer is stationary in ITRF, so the rate of change of the range
+  // vector is the satellite velocity.
+  const Vec3 r_satellite = satellite_itrf.position.GetCartesian();
+  const Vec3& r_site = site.GetPosition();
+  const Vec3& site_zenith = site.GetZenith();
+  const Vec3 rho = r_satellite - r_site;
+  const Vec3 drho = satellite_itrf.velocity.GetCartesianOr({0, 0, 0});
+
+  // Differentiate elevation = atan2(z, h), where z is the component of the
+  // range vector along the local vertical, and h is the magnitude of its
+  // horizontal component. Unlike differentiation of the arc sine this is well
+  // conditioned when the satellite is close to the zenith.
+  const double z = rho.Dot(site_zenith);
+  const double dz = drho.Dot(site_zenith);
+  const Vec3 rho_horizontal = rho - site_zenith * z;
+  const Vec3 drho_horizontal = drho - site_zenith * dz;
+  const double h = rho_horizontal.Norm();
+  const double dh = h > 0 ? rho_horizontal.Dot(drho_horizontal) / h : 0;
+  const double elevation_rate = (dz * h - z * dh) / (z * z + h * h);
+
+  return ElevationSample{.horizontal = horizontal,
+                         .elevation_rate = elevation_rate};
+}
+
+// Refine the time at which the satellite crosses the horizon using root
+// bracketing of the elevation function.
+//
+// The satellite is expected to be above the horizon at the above_horizon_time
+// and below the horizon at below_horizon_offset seconds after it (the offset is
+// negative when the crossing is the AOS).
+//
+// Every iteration takes a Newton step from the end of the bracket which is
+// closest to the horizon, using the elevation rate derived from the satellite
+// velocity. If the Newton step leaves the bracket the Illinois variant of the
+// regula falsi is used instead. The new point is kept at least half of the time
+// tolerance away from the bracket ends, so that once the Newton iterations
+// converged the next evaluation closes the bracket from the other side.
+//
+// Returns the end of the final bracket at which the satellite is above the
+// horizon.
+auto RefineHorizonCrossing(const PredictPassOptions& options,
+                           const OrbitalState& orbital_state,
+                           const Time& above_horizon_time,
+                           const double below_horizon_offset) -> Time {
+  // End of the bracket: offset in seconds from the above_horizon_time, the
+  // elevation sample at it, and elevation used for the regula falsi (which gets
+  // scaled down by the Illinois modification).
+  struct BracketEnd {
+    double offset{0};
+    ElevationSample sample{};
+    double weighted_elevation{0};
+  };
+
+  auto evaluate = [&](const double offset) -> std::optional<BracketEnd> {
+    const std::optional<ElevationSample> sample =
+        CalculateElevationSampleAtTime(
+            options.site_position,
+            orbital_state,
+            above_horizon_time + TimeDifference::FromSeconds(offset));
+    if (!sample) {
+      return std::nullopt;
+    }
+    return BracketEnd{.offset = offset,
+                      .sample = *sample,
+                      .weighted_elevation = sample->horizontal.elevation};
+  };
+
+  std::optional<BracketEnd> above = evaluate(0);
+  std::optional<BracketEnd> below = evaluate(below_horizon_offset);
+  if (!above || !below) {
+    return {};
+  }
+
+  const double tolerance = double(options.time_tolerance.InSeconds());
+
+  // Which end of the bracket has been replaced on the previous iteration:
+  // positive for the above end, negative for the below end.
+  int previous_side = 0;
+
+  for (int i = 0; i < kRefineMaxIterations; ++i) {
+    const double lower = Min(above->offset, below->offset);
+    const double upper = Max(above->offset, below->offset);
+    if (upper - lower <= tolerance) {
+      break;
+    }
+
+    // Newton step from the end of the bracket closest to the horizon.
+    const BracketEnd& closest =
+        Abs(above->sample.horizontal.elevation) <
+                Abs(below->sample.horizontal.elevation)
+            ? *above
+            : *below;
+    double offset = upper;
+    if (closest.sample.elevation_rate != 0) {
+      offset = closest.offset - closest.sample.horizontal.elevation /
+                                    closest.sample.elevation_rate;
+    }
+
+    // Regula falsi when the Newton step is not inside the bracket.
+    if (!(offset > lower && offset < upper)) {
+      offset = (below->offset * above->weighted_elevation -
+                above->offset * below->weighted_elevation) /
+               (above->weighted_elevation - below->weighted_elevation);
+    }
+
+    const double margin = tolerance / 2;
+    offset = Clamp(offset, lower + margin, upper - margin);
+
+    std::optional<BracketEnd> sample = evaluate(offset);
+    if (!sample) {
+      return {};
+    }
+
+    // Illinois modification: halve the elevation of the end of the bracket
+    // which is retained for the second time in a row, so that the regula falsi
+    // does not converge from one side only.
+    if (sample->sample.horizontal.elevation < 0) {
+      below = sample;
+      if (previous_side < 0) {
+        above->weighted_elevation /= 2;
+      }
+      previous_side = -1;
+    } else {
+      above = sample;
+      if (previous_side > 0) {
+        below->weighted_elevation /= 2;
+      }
+      previous_side = 1;
+    }
+  }
+
+  return above_horizon_time + TimeDifference::FromSeconds(above->offset);
+}
+
+// Refine AOS from its approximation, where the approximate AOS is the first
+// time point above the horizon, and the satellite is below the horizon the
+// approximation_step before it.
+auto RefineAOSAboveHorizon(const PredictPassOptions& options,
+                           const OrbitalState& orbital_state,
+                           const Time& approximate_aos_time,
+                           const TimeDifference& approximation_step) -> Time {
+  switch (options.refine_method) {
+    case PassRefineMethod::kStep:
+      return RefineAOSAboveHorizonStep(
+          options, orbital_state, approximate_aos_time);
+    case PassRefineMethod::kRootBracketing:
+      return RefineHorizonCrossing(options,
+                                   orbital_state,
+                                   approximate_aos_time,
+                                   -double(approximation_step.InSeconds()));
+  }
+
+  Unreachable();
+}
+
+// Refine LOS from its approximation, where the approximate LOS is the last
+// time point above the horizon, and the satellite is below the horizon the
+// approximation_step after it.
+auto RefineLOSAboveHorizon(const PredictPassOptions& options,
+                           const OrbitalState& orbital_state,
+                           const Time& approximate_los_time,
+                           const TimeDifference& approximation_step) -> Time {
+  switch (options.refine_method) {
+    case PassRefineMethod::kStep:
+      return RefineLOSAboveHorizonStep(
+          options, orbital_state, approximate_los_time);
+    case PassRefineMethod::kRootBracketing:
+      return RefineHorizonCrossing(options,
+                                   orbital_state,
+                                   approximate_los_time,
+                                   double(approximation_step.InSeconds()));
+  }
+
+  Unreachable();
+}
+
 // Find the satellite LOS starting from the given moment in time.
 //
 // If the satellite never goes below the horizon throughout the prediction time
@@ -308,57 +533,224 @@ auto FindLOSAboveHorizon(const PredictPassOptions& options,
     return std::nullopt;
   }
 
-  return RefineLOSAboveHorizon(options, orbital_state, *approximate_los_time);
+  return RefineLOSAboveHorizon(
+      options, orbital_state, *approximate_los_time, kApproximateTimeStep);
+}
+
+// Refine the time of the maximum elevation of the satellite, given the time
+// bracket around it.
+//
+// The elevation is expected to be increasing at the lower_time and decreasing
+// at the upper_time. The zero crossing of the elevation rate is found using the
+// Illinois variant of the regula falsi, until the bracket is smaller than the
+// time tolerance. If the elevation rate does not change its sign within the
+// bracket the end of the bracket with the highest elevation is returned.
+//
+// Returns the position of the satellite at the maximum elevation over the
+// horizon, or nullopt if prediction is not possible.
+auto RefineMaxElevation(const PredictPassOptions& options,
+                        const OrbitalState& orbital_state,
+                        const Time& lower_time,
+                        const Time& upper_time) -> std::optional<Horizontal> {
+  // End of the bracket: offset in seconds from the lower_time, the elevation
+  // sample at it, and elevation rate used for the regula falsi (which gets
+  // scaled down by the Illinois modification).
+  struct BracketEnd {
+    double offset{0};
+    ElevationSample sample{};
+    double weighted_elevation_rate{0};
+  };
+
+  auto evaluate = [&](const double offset) -> std::optional<BracketEnd> {
+    const std::optional<ElevationSample> sample =
+        CalculateElevationSampleAtTime(
+            options.site_position,
+            orbital_state,
+            lower_time + TimeDifference::FromSeconds(offset));
+    if (!sample) {
+      return std::nullopt;
+    }
+    return BracketEnd{.offset = offset,
+                      .sample = *sample,
+                      .weighted_elevation_rate = sample->elevation_rate};
+  };
+
+  const double span = GetSecondsBetween(lower_time, upper_time);
+
+  std::optional<BracketEnd> lower = evaluate(0);
+  std::optional<BracketEnd> upper = evaluate(span);
+  if (!lower || !upper) {
+    return std::nullopt;
+  }
+
+  if (!(lower->sample.elevation_rate > 0 && upper->sample.elevation_rate < 0)) {
+    return lower->sample.horizontal.elevation >
+                   upper->sample.horizontal.elevation
+               ? lower->sample.horizontal
+               : upper->sample.horizontal;
+  }
+
+  const double tolerance = double(options.time_tolerance.InSeconds());
+
+  // Which end of the bracket has been replaced on the previous iteration:
+  // positive for the upper end, negative for the lower end.
+  int previous_side = 0;
+
+  for (int i = 0; i < kRefineMaxIterations; ++i) {
+    if (upper->offset - lower->offset <= tolerance) {
+      break;
+    }
+
+    double offset = (lower->offset * upper->weighted_elevation_rate -
+                     upper->offset * lower->weighted_elevation_rate) /
+                    (upper->weighted_elevation_rate -
+                     lower->weighted_elevation_rate);
+
+    const double margin = tolerance / 2;
+    offset = Clamp(offset, lower->offset + margin, upper->offset - margin);
+
+    std::optional<BracketEnd> sample = evaluate(offset);
+    if (!sample) {
+      return std::nullopt;
+    }
+
+    if (sample->sample.elevation_rate > 0) {
+      lower = sample;
+      if (previous_side < 0) {
+        upper->weighted_elevation_rate /= 2;
+      }
+      previous_side = -1;
+    } else {
+      upper = sample;
+      if (previous_side > 0) {
+        lower->weighted_elevation_rate /= 2;
+      }
+      previous_side = 1;
+    }
+  }
+
+  return lower->sample.horizontal.elevation >
+                 upper->sample.horizontal.elevation
+             ? lower->sample.horizontal
+             : upper->sample.horizontal;
+}
+
+// Refine the maximum elevation of the satellite around the highest sample of
+// the elevation taken with the kApproximateTimeStep.
+//
+// The maximum is refined between the neighbor samples, clipped to the time
+// window between min_time and max_time.
+auto RefineMaxElevationAroundSample(const PredictPassOptions& options,
+                                    const OrbitalState& orbital_state,
+                                    const Time& min_time,
+                                    const Time& max_time,
+                                    const Horizontal& max_sample)
+    -> std::optional<Horizontal> {
+  const Time& max_sample_time = max_sample.observation_time;
+
+  Time lower_time = max_sample_time - kApproximateTimeStep;
+  if (lower_time.AsFormat<JulianDate>() < min_time.AsFormat<JulianDate>()) {
+    lower_time = min_time;
+  }
+
+  Time upper_time = max_sample_time + kApproximateTimeStep;
+  if (upper_time.AsFormat<JulianDate>() > max_time.AsFormat<JulianDate>()) {
+    upper_time = max_time;
+  }
+
+  const std::optional<Horizontal> refined =
+      RefineMaxElevation(options, orbital_state, lower_time, upper_time);
+  if (!refined) {
+    return std::nullopt;
+  }
+
+  // For objects which barely move relative to the observer (such as the
+  // geostationary satellites) the elevation rate is comparable to the errors of
+  // the velocity, and the refinement is not reliable. Never give a result which
+  // is lower than the highest sample.
+  if (refined->elevation < max_sample.elevation) {
+    return max_sample;
+  }
+
+  return refined;
 }
 
-// Calculate the maximum satellite elevation during the given pass.
+// Calculate position of the satellite at the time of closest approach (TCA)
+// during the given pass: the time at which the satellite reaches its maximum
+// elevation.
 //
-// If the satellite is not visible during the pass a value of 0 is returned.
+// When both AOS and LOS are known the maximum is refined directly within the
+// pass. Otherwise the part of the pass which is within the prediction time
+// window is sampled with the kApproximateTimeStep, and the maximum is refined
+// around the highest sample.
 //
 // The start_time is the time from which the satellite pass prediction started.
-auto CalculatePassMaxElevation(const PredictPassOptions& options,
-                               const OrbitalState& orbital_state,
-                               const SatellitePass& pass,
-                               const Time& start_time) -> double {
+//
+// If the satellite is not visible during the pass or the prediction has failed
+// nullopt is returned.
+auto CalculatePassTCA(const PredictPassOptions& options,
+                      const OrbitalState& orbital_state,
+                      const SatellitePass& pass,
+                      const Time& start_time) -> std::optional<Horizontal> {
   if (pass.is_never_visible) {
-    return 0;
+    return std::nullopt;
   }
 
   if (pass.aos && pass.los) {
-    const std::optional<double> elevation = CalculateElevationAtMedian(
-        options.site_position, orbital_state, *pass.aos, *pass.los);
-    if (!elevation) {
-      // Prediction failed, so can not get reliable elevation.
-      return 0;
-    }
-    return *elevation;
+    return RefineMaxElevation(options, orbital_state, *pass.aos, *pass.los);
   }
 
-  double max_elevation = 0;
-  Time time = pass.aos ? *pass.aos : start_time;
-
+  const Time min_time = pass.aos ? *pass.aos : start_time;
   const Time max_time =
       pass.los
           ? *pass.los
           : start_time + TimeDifference::FromDays(options.num_days_to_predict);
   const JulianDate max_jd = max_time.AsFormat<JulianDate>();
 
-  for (;;) {
-    const std::optional<double> elevation =
-        CalculateElevationAtTime(options.site_position, orbital_state, time);
-    if (!elevation) {
-      return 0;
+  // Find the highest sample.
+  std::optional<Horizontal> max_sample;
+  for (Time time = min_time; time.AsFormat<JulianDate>() <= max_jd;
+       time += kApproximateTimeStep) {
+    const std::optional<ElevationSample> sample =
+        CalculateElevationSampleAtTime(
+            options.site_position, orbital_state, time);
+    if (!sample) {
+      return std::nullopt;
     }
 
-    max_elevation = Max(max_elevation, *elevation);
-
-    time += kApproximateTimeStep;
-    if (time.AsFormat<JulianDate>() > max_jd) {
-      break;
+    if (!max_sample || sample->horizontal.elevation > max_sample->elevation) {
+      max_sample = sample->horizontal;
     }
   }
 
-  return max_elevation;
+  if (!max_sample) {
+    return std::nullopt;
+  }
+
+  return RefineMaxElevationAroundSample(
+      options, orbital_state, min_time, max_time, *max_sample);
+}
+
+// Store information about the TCA in the pass.
+void SetPassTCA(SatellitePass& pass, const Horizontal& tca_horizontal) {
+  pass.tca = tca_horizontal.observation_time;
+  pass.max_elevation = tca_horizontal.elevation;
+  pass.tca_azimuth = tca_horizontal.azimuth;
+  pass.tca_distance = tca_horizontal.distance;
+}
+
+// Calculate TCA of the pass and store its information in the pass.
+void UpdatePassTCA(const PredictPassOptions& options,
+                   const OrbitalState& orbital_state,
+                   SatellitePass& pass,
+                   const Time& start_time) {
+  const std::optional<Horizontal> tca_horizontal =
+      CalculatePassTCA(options, orbital_state, pass, start_time);
+  if (!tca_horizontal) {
+    return;
+  }
+
+  SetPassTCA(pass, *tca_horizontal);
 }
 
 // Get prediction of the currently visible pass, or the next visible pass.
@@ -390,8 +782,8 @@ auto PredictCurrentOrNextPassAboveHorizon(const PredictPassOptions& options,
   // Refine AOS if there was detected transition of the satellite to ever leave
   // the horizon.
   if (!approximate_aos.is_always_visible) {
-    pass.aos =
-        RefineAOSAboveHorizon(options, orbital_state, *approximate_aos.time);
+    pass.aos = RefineAOSAboveHorizon(
+        options, orbital_state, *approximate_aos.time, kApproximateTimeStep);
   }
 
   // If the satellite is visible at the start time then start looking for LOS
@@ -409,8 +801,7 @@ auto PredictCurrentOrNextPassAboveHorizon(const PredictPassOptions& options,
     pass.is_always_visible = true;
   }
 
-  pass.max_elevation =
-      CalculatePassMaxElevation(options, orbital_state, pass, start_time);
+  UpdatePassTCA(options, orbital_state, pass, start_time);
 
   return pass;
 }
@@ -479,8 +870,7 @@ auto PredictNextPass(const PredictPassOptions& options,
       SatellitePass pass = {
           .is_always_visible = true,
       };
-      pass.max_elevation =
-          CalculatePassMaxElevation(options, orbital_state, pass, start_time);
+      UpdatePassTCA(options, orbital_state, pass, start_time);
       return pass;
     }
 
@@ -490,5 +880,354 @@ auto PredictNextPass(const PredictPassOptions& options,
   return PredictCurrentOrNextPass(options, orbital_state, next_time);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Prediction of passes of multiple satellites over multiple sites.
+
+namespace pass_internal {
+
+namespace {
+
+// Number of satellites which passes are predicted by a single task when an
+// executor is used.
+constexpr int kNumSatellitesPerTask = 1;
+
+// Sample of the coarse time grid which is shared by all satellites and sites.
+struct PassGridSample {
+  // Time of the sample in all time scales.
+  TimeScales scales;
+
+  // Transformation from TEME to ITRF at the time of the sample.
+  TEMEToITRFTransform teme_to_itrf;
+};
+
+// State of the pass prediction of a satellite over a site.
+struct PassSiteState {
+  // True when the satellite is above the horizon of the site at the last
+  // processed sample of the grid.
+  bool is_visible{false};
+
+  // AOS of the current pass.
+  // Set to nullopt if the pass started before the first sample of the grid.
+  std::optional<Time> aos;
+
+  // Time and elevation of the highest sample of the current pass.
+  Time max_sample_time;
+  double max_sample_elevation{0};
+};
+
+// Calculate elevation of a satellite over the horizon of the site given the
+// satellite position in ITRF.
+//
+// The site_options are the options of the prediction with the observer frame
+// of the site.
+auto CalculateSiteElevation(const PredictPassOptions& site_options,
+                            const Vec3& r_itrf) -> double {
+  const ObserverFrame& observer_frame = site_options.site_position;
+  const Vec3& zenith = observer_frame.GetZenith();
+
+  const Vec3 rho = r_itrf - observer_frame.GetPosition();
+  const double z = rho.Dot(zenith);
+  const double h = (rho - zenith * z).Norm();
+  return ArcTan2(z, h);
+}
+
+// Calculate TCA of the pass detected on the coarse grid, and store it in the
+// pass.
+//
+// The min_time and max_time define the time window of the prediction.
+//
+// Returns false if the prediction has failed.
+auto CalculateSitePassTCA(const PredictPassOptions& site_options,
+                          const OrbitalState& orbital_state,
+                          const PassSiteState& state,
+                          const Time& min_time,
+                          const Time& max_time,
+                          SatellitePass& pass) -> bool {
+  std::optional<Horizontal> tca_horizontal;
+
+  if (pass.aos && pass.los) {
+    tca_horizontal =
+        RefineMaxElevation(site_options, orbital_state, *pass.aos, *pass.los);
+  } else {
+    const std::optional<ElevationSample> max_sample =
+        CalculateElevationSampleAtTime(site_options.site_position,
+                                       orbital_state,
+                                       state.max_sample_time);
+    if (!max_sample) {
+      return false;
+    }
+
+    tca_horizontal =
+        RefineMaxElevationAroundSample(site_options,
+                                       orbital_state,
+                                       pass.aos ? *pass.aos : min_time,
+                                       pass.los ? *pass.los : max_time,
+                                       max_sample->horizontal);
+  }
+
+  if (!tca_horizontal) {
+    return false;
+  }
+
+  SetPassTCA(pass, *tca_horizontal);
+
+  return true;
+}
+
+// Time window, sampling grid and sites shared by all satellites of the
+// PredictPasses().
+struct PassPrediction {
+  PredictPassOptions options;
+
+  Time min_time;
+  Time max_time;
+
+  std::vector<PassGridSample> grid;
+
+  // Options of the prediction with the observer frame of every site.
+  std::vector<PredictPassOptions> sites;
+};
+
+// Predict passes of a single satellite over all sites of the prediction, and
+// invoke the callback with every found pass.
+//
+// The states are used as a storage of per-site state of the search, and are
+// expected to have an element for every site.
+void PredictSatellitePasses(const PassPrediction& prediction,
+                            const OrbitalState& orbital_state,
+                            const int satellite_index,
+                            std::vector<PassSiteState>& states,
+                            const PredictPassesCallback callback,
+                            void* callback_data) {
+  const PredictPassOptions& options = prediction.options;
+  const Time& min_time = prediction.min_time;
+  const Time& max_time = prediction.max_time;
+  const std::vector<PassGridSample>& grid = prediction.grid;
+  const std::vector<PredictPassOptions>& sites = prediction.sites;
+
+  const int num_sites = sites.size();
+  const int num_samples = grid.size();
+
+  // Report that the prediction of the satellite has failed.
+  auto report_failure = [&]() {
+    callback(callback_data,
+             SatelliteSitePass{.satellite_index = satellite_index,
+                               .is_failed = true});
+  };
+
+  // Calculate TCA of the pass and report it if it is high enough.
+  // Returns false if the prediction has failed.
+  auto report_pass = [&](const int site_index, SatellitePass& pass) {
+    if (!CalculateSitePassTCA(sites[site_index],
+                              orbital_state,
+                              states[site_index],
+                              min_time,
+                              max_time,
+                              pass)) {
+      return false;
+    }
+
+    if (pass.max_elevation >= options.min_elevation) {
+      callback(callback_data,
+               SatelliteSitePass{.satellite_index = satellite_index,
+                                 .site_index = site_index,
+                                 .pass = pass});
+    }
+
+    return true;
+  };
+
+  for (int sample_index = 0; sample_index < num_samples; ++sample_index) {
+    const PassGridSample& sample = grid[sample_index];
+    const Time& time = sample.scales.GetTime();
+
+    // Propagate the satellite once for all sites.
+    const OrbitalState::PredictResult result =
+        orbital_state.Predict(sample.scales);
+    if (!result.Ok()) {
+      report_failure();
+      return;
+    }
+    const Vec3 r_teme = result.GetValue().position.GetCartesian();
+    const Vec3 r_itrf = sample.teme_to_itrf.Apply(r_teme);
+
+    for (int site_index = 0; site_index < num_sites; ++site_index) {
+      const PredictPassOptions& site_options = sites[site_index];
+      PassSiteState& state = states[site_index];
+
+      const double elevation = CalculateSiteElevation(site_options, r_itrf);
+      const bool is_visible = elevation > 0;
+
+      if (sample_index == 0) {
+        state = {
+            .is_visible = is_visible,
+            .max_sample_time = time,
+            .max_sample_elevation = elevation,
+        };
+        continue;
+      }
+
+      if (is_visible == state.is_visible) {
+        if (is_visible && elevation > state.max_sample_elevation) {
+          state.max_sample_time = time;
+          state.max_sample_elevation = elevation;
+        }
+        continue;
+      }
+
+      const Time& previous_time = grid[sample_index - 1].scales.GetTime();
+      const TimeDifference step = TimeDifference::FromSeconds(
+          GetSecondsBetween(previous_time, time));
+
+      if (is_visible) {
+        state.is_visible = true;
+        state.aos =
+            RefineAOSAboveHorizon(site_options, orbital_state, time, step);
+        state.max_sample_time = time;
+        state.max_sample_elevation = elevation;
+        continue;
+      }
+
+      state.is_visible = false;
+
+      SatellitePass pass;
+      pass.aos = state.aos;
+      pass.los = RefineLOSAboveHorizon(
+          site_options, orbital_state, previous_time, step);
+
+      if (!report_pass(site_index, pass)) {
+        report_failure();
+        return;
+      }
+    }
+  }
+
+  // Report passes which did not end within the time window.
+  for (int site_index = 0; site_index < num_sites; ++site_index) {
+    const PassSiteState& state = states[site_index];
+    if (!state.is_visible) {
+      continue;
+    }
+
+    SatellitePass pass;
+    pass.aos = state.aos;
+    pass.is_always_visible = !state.aos;
+
+    if (!report_pass(site_index, pass)) {
+      report_failure();
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+void PredictPasses(const PredictPassOptions& options,
+                   const std::span<const OrbitalState> orbital_states,
+                   const std::span<const ITRF> site_positions,
+                   const Time& start_time,
+                   const Time& end_time,
+                   Executor* executor,
+                   const PredictPassesCallback callback,
+                   void* callback_data) {
+  PassPrediction prediction;
+  prediction.options = options;
+  prediction.min_time = start_time;
+  prediction.max_time = end_time.ToScale(start_time.GetScale());
+
+  const Time& min_time = prediction.min_time;
+  const Time& max_time = prediction.max_time;
+  const JulianDate max_jd = max_time.AsFormat<JulianDate>();
+
+  if (!(min_time.AsFormat<JulianDate>() < max_jd)) {
+    return;
+  }
+
+  // Sample the time window, and calculate the Earth orientation once for all
+  // satellites. The last sample is at the end of the time window.
+  // Pin the thread for the cheap access to the Earth orientation tables.
+  const SharedTablePin shared_table_pin;
+  std::vector<PassGridSample>& grid = prediction.grid;
+  for (Time time = min_time; time.AsFormat<JulianDate>() < max_jd;
+       time += kApproximateTimeStep) {
+    const TimeScales scales(time);
+    grid.push_back(
+        {.scales = scales, .teme_to_itrf = TEMEToITRFTransform::At(scales)});
+  }
+  const TimeScales max_scales(max_time);
+  grid.push_back({.scales = max_scales,
+                  .teme_to_itrf = TEMEToITRFTransform::At(max_scales)});
+
+  std::vector<PredictPassOptions>& sites = prediction.sites;
+  sites.reserve(site_positions.size());
+  for (const ITRF& site_position : site_positions) {
+    PredictPassOptions& site_options = sites.emplace_back(options);
+    site_options.site_position = site_position;
+  }
+
+  const int num_satellites = orbital_states.size();
+  const int num_sites = sites.size();
+
+  if (executor == nullptr) {
+    std::vector<PassSiteState> states(num_sites);
+    for (int satellite_index = 0; satellite_index < num_satellites;
+         ++satellite_index) {
+      PredictSatellitePasses(prediction,
+                             orbital_states[satellite_index],
+                             satellite_index,
+                             states,
+                             callback,
+                             callback_data);
+    }
+    return;
+  }
+
+  // The satellites are processed in blocks. The passes of the satellites of a
+  // block are predicted concurrently and stored in per-satellite buffers, and
+  // then reported in the order of satellites. This gives the same order of the
+  // callback invocation as the serial prediction, while keeping the memory
+  // used by the buffers bounded.
+  const int block_size = executor->GetConcurrency() * kNumSatellitesPerTask * 4;
+
+  std::vector<std::vector<SatelliteSitePass>> block_passes(
+      std::min(block_size, num_satellites));
+
+  for (int block_begin = 0; block_begin < num_satellites;
+       block_begin += block_size) {
+    const int block_end = std::min(block_begin + block_size, num_satellites);
+
+    ParallelFor(
+        executor,
+        block_end - block_begin,
+        kNumSatellitesPerTask,
+        [&](const int begin, const int end) {
+          std::vector<PassSiteState> states(num_sites);
+          for (int i = begin; i < end; ++i) {
+            std::vector<SatelliteSitePass>& passes = block_passes[i];
+            passes.clear();
+
+            PredictSatellitePasses(
+                prediction,
+                orbital_states[block_begin + i],
+                block_begin + i,
+                states,
+                [](void* data, const SatelliteSitePass& pass) {
+                  static_cast<std::vector<SatelliteSitePass>*>(data)
+                      ->push_back(pass);
+                },
+                &passes);
+          }
+        });
+
+    for (int i = 0; i < block_end - block_begin; ++i) {
+      for (const SatelliteSitePass& pass : block_passes[i]) {
+        callback(callback_data, pass);
+      }
+    }
+  }
+}
+
+}  // namespace pass_internal
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
@@ -0,0 +1,78 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/satellite/pass.h"
+
+#include "astro_core/benchmark/benchmark.h"
+#include "astro_core/coordinate/geodetic.h"
+#include "astro_core/coordinate/geographic.h"
+#include "astro_core/coordinate/itrf.h"
+#include "astro_core/earth/internal/earth_benchmark_data.h"
+#include "astro_core/math/math.h"
+#include "astro_core/satellite/orbital_state.h"
+#include "astro_core/satellite/tle.h"
+#include "astro_core/satellite/tle_parser.h"
+#include "astro_core/time/format/date_time.h"
+#include "astro_core/time/time.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+void BenchmarkPredictNextPass(benchmark::State& state,
+                              const PassRefineMethod refine_method) {
+  if (!benchmark_data::SetTables()) {
+    state.SkipWithError("Error reading IERS tables");
+    return;
+  }
+
+  const TLEParser::Result tle = TLEParser::FromLines(
+      "1 25338U 98030A   22362.54560834  .00000123  00000+0  69546-4 0  9990",
+      "2 25338  98.6255  29.3628 0011429  91.9881 268.2609 14.26213421280684");
+  OrbitalState orbital_state;
+  if (!tle.Ok() || !orbital_state.InitializeFromTLE(tle.GetValue())) {
+    state.SkipWithError("Error initializing orbital state");
+    return;
+  }
+
+  const Time start_time{DateTime(2022, 12, 28), TimeScale::kUTC};
+
+  const PredictPassOptions options = {
+      .site_position = ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(50.0),
+                                       .longitude = DegreesToRadians(5.0),
+                                   }),
+                                   start_time)),
+      .min_elevation = DegreesToRadians(10.0),
+      .refine_method = refine_method,
+  };
+
+  // Predict passes starting from different times within a day, so that the
+  // benchmark covers different distances to the next pass.
+  int i = 0;
+  for (auto _ : state) {
+    DoNotOptimize(PredictNextPass(
+        options,
+        orbital_state,
+        start_time + TimeDifference::FromSeconds((i++ % 24) * 3600)));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+}  // namespace
+
+BENCHMARK(Pass, PredictNextPass) {
+  BenchmarkPredictNextPass(state, PassRefineMethod::kRootBracketing);
+}
+
+BENCHMARK(Pass, PredictNextPass_RefineStep) {
+  BenchmarkPredictNextPass(state, PassRefineMethod::kStep);
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -4,14 +4,20 @@
 
 #include "astro_core/satellite/pass.h"
 
+#include <vector>
+
 #include "astro_core/coordinate/geodetic.h"
 #include "astro_core/coordinate/geographic.h"
+#include "astro_core/coordinate/horizontal.h"
 #include "astro_core/coordinate/itrf.h"
+#include "astro_core/coordinate/teme.h"
 #include "astro_core/math/math.h"
+#include "astro_core/parallel/thread_pool.h"
 #include "astro_core/satellite/orbital_state.h"
 #include "astro_core/satellite/tle.h"
 #include "astro_core/satellite/tle_parser.h"
 #include "astro_core/time/format/date_time.h"
+#include "astro_core/time/format/julian_date.h"
 #include "astro_core/time/time.h"
 #include "astro_core/unittest/test.h"
 
@@ -29,6 +35,23 @@ class PassTest : public testing::Test {
 
     return orbital_state;
   }
+
+  // Get the number of seconds from the time b to the time a.
+  static auto SecondsBetween(const Time& a, const Time& b) -> double {
+    return double((DoubleDouble(a.AsFormat<JulianDate>()) -
+                   DoubleDouble(b.AsFormat<JulianDate>())) *
+                  constants::kNumSecondsInDay);
+  }
+
+  static auto CalculateElevation(const ITRF& site_position,
+                                 const OrbitalState& orbital_state,
+                                 const Time& time) -> double {
+    const OrbitalState::PredictResult result = orbital_state.Predict(time);
+    EXPECT_TRUE(result.Ok());
+
+    const ITRF satellite_itrf = ITRF::FromTEME(result.GetValue());
+    return Horizontal::FromITRF(satellite_itrf, site_position).elevation;
+  }
 };
 
 TEST_F(PassTest, PredictCurrentOrNextPass_PolarOrbiting) {
@@ -65,11 +88,26 @@ TEST_F(PassTest, PredictCurrentOrNextPass_PolarOrbiting) {
     ASSERT_TRUE(pass.aos);
     ASSERT_TRUE(pass.los);
 
-    EXPECT_EQ(pass.aos->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 15, 25));
-    EXPECT_EQ(pass.los->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 30, 35));
-    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.94732027103807), 1e-8);
+    EXPECT_NEAR(SecondsBetween(*pass.aos,
+                               Time{DateTime(2022, 12, 28, 18, 15, 25, 540000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(SecondsBetween(*pass.los,
+                               Time{DateTime(2022, 12, 28, 18, 30, 35, 600000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.95421400410945), 1e-8);
+
+    ASSERT_TRUE(pass.tca);
+    EXPECT_NEAR(SecondsBetween(*pass.tca,
+                               Time{DateTime(2022, 12, 28, 18, 22, 59, 414214),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(pass.tca_azimuth, DegreesToRadians(73.09217676743938), 1e-6);
+    EXPECT_NEAR(pass.tca_distance, 811584.8445296432, 1e-3);
   }
 
   // The satellite at this time is over the observer, with AOS 16:37:40, LOS
@@ -94,11 +132,17 @@ TEST_F(PassTest, PredictCurrentOrNextPass_PolarOrbiting) {
     ASSERT_TRUE(pass.aos);
     ASSERT_TRUE(pass.los);
 
-    EXPECT_EQ(pass.aos->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 15, 25));
-    EXPECT_EQ(pass.los->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 30, 35));
-    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.94732027103807), 1e-8);
+    EXPECT_NEAR(SecondsBetween(*pass.aos,
+                               Time{DateTime(2022, 12, 28, 18, 15, 25, 540000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(SecondsBetween(*pass.los,
+                               Time{DateTime(2022, 12, 28, 18, 30, 35, 600000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.95421400410945), 1e-8);
   }
 }
 
@@ -186,11 +230,17 @@ TEST_F(PassTest, PredictNextPass_PolarOrbiting) {
     ASSERT_TRUE(pass.aos);
     ASSERT_TRUE(pass.los);
 
-    EXPECT_EQ(pass.aos->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 15, 25));
-    EXPECT_EQ(pass.los->AsFormat<DateTime>(),
-              DateTime(2022, 12, 28, 18, 30, 35));
-    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.94732027103807), 1e-8);
+    EXPECT_NEAR(SecondsBetween(*pass.aos,
+                               Time{DateTime(2022, 12, 28, 18, 15, 25, 540000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(SecondsBetween(*pass.los,
+                               Time{DateTime(2022, 12, 28, 18, 30, 35, 600000),
+                                    TimeScale::kUTC}),
+                0,
+                0.1);
+    EXPECT_NEAR(pass.max_elevation, DegreesToRadians(82.95421400410945), 1e-8);
   }
 }
 
@@ -268,4 +318,335 @@ TEST_F(PassTest, PredictNextPass_Geostationary) {
   }
 }
 
+// Compare the root bracketing refinement of AOS and LOS against the refinement
+// which walks with 1 second steps, and check the TCA is at the maximum
+// elevation.
+TEST_F(PassTest, PredictNextPass_RefineMethod) {
+  const OrbitalState orbital_state = CreateOrbitalStateFromTLE(
+      "1 25338U 98030A   22362.54560834  .00000123  00000+0  69546-4 0  9990",
+      "2 25338  98.6255  29.3628 0011429  91.9881 268.2609 14.26213421280684");
+
+  const ITRF site_position = ITRF::FromGeodetic(
+      Geodetic::FromGeographic(Geographic({
+                                   .latitude = DegreesToRadians(50.0),
+                                   .longitude = DegreesToRadians(5.0),
+                               }),
+                               Time{DateTime(2022, 12, 28), TimeScale::kUTC}));
+
+  const PredictPassOptions step_options = {
+      .site_position = site_position,
+      .refine_method = PassRefineMethod::kStep,
+  };
+
+  const PredictPassOptions root_options = {
+      .site_position = site_position,
+      .refine_method = PassRefineMethod::kRootBracketing,
+      .time_tolerance = TimeDifference::FromSeconds(0.01),
+  };
+  const double tolerance = double(root_options.time_tolerance.InSeconds());
+
+  // Go through all passes within two days.
+  Time start_time{DateTime(2022, 12, 28), TimeScale::kUTC};
+  int num_passes = 0;
+  for (; num_passes < 64; ++num_passes) {
+    const SatellitePass step_pass =
+        PredictNextPass(step_options, orbital_state, start_time);
+    const SatellitePass root_pass =
+        PredictNextPass(root_options, orbital_state, start_time);
+
+    ASSERT_TRUE(step_pass.aos);
+    ASSERT_TRUE(step_pass.los);
+    ASSERT_TRUE(root_pass.aos);
+    ASSERT_TRUE(root_pass.los);
+
+    // The step refinement gives the last second below the horizon before the
+    // AOS, and the last second above the horizon before the LOS.
+    const double aos_difference =
+        SecondsBetween(*root_pass.aos, *step_pass.aos);
+    EXPECT_GT(aos_difference, 0);
+    EXPECT_LE(aos_difference, 1 + tolerance);
+
+    const double los_difference =
+        SecondsBetween(*root_pass.los, *step_pass.los);
+    EXPECT_GE(los_difference, -tolerance);
+    EXPECT_LT(los_difference, 1);
+
+    // The root bracketing gives time points above the horizon, within the
+    // tolerance from the actual horizon crossing.
+    EXPECT_GE(
+        CalculateElevation(site_position, orbital_state, *root_pass.aos), 0);
+    EXPECT_LT(CalculateElevation(site_position,
+                                 orbital_state,
+                                 *root_pass.aos -
+                                     TimeDifference::FromSeconds(tolerance)),
+              0);
+
+    EXPECT_GE(
+        CalculateElevation(site_position, orbital_state, *root_pass.los), 0);
+    EXPECT_LT(CalculateElevation(site_position,
+                                 orbital_state,
+                                 *root_pass.los +
+                                     TimeDifference::FromSeconds(tolerance)),
+              0);
+
+    // The maximum elevation is at the TCA.
+    ASSERT_TRUE(root_pass.tca);
+    EXPECT_LE(
+        CalculateElevation(site_position,
+                           orbital_state,
+                           *root_pass.tca - TimeDifference::FromSeconds(1)),
+        root_pass.max_elevation);
+    EXPECT_LE(
+        CalculateElevation(site_position,
+                           orbital_state,
+                           *root_pass.tca + TimeDifference::FromSeconds(1)),
+        root_pass.max_elevation);
+
+    start_time = *step_pass.los + TimeDifference::FromSeconds(60);
+    if (start_time.AsFormat<JulianDate>() >
+        Time{DateTime(2022, 12, 30), TimeScale::kUTC}.AsFormat<JulianDate>()) {
+      break;
+    }
+  }
+
+  EXPECT_GT(num_passes, 8);
+}
+
+TEST_F(PassTest, PredictPasses) {
+  const std::vector<OrbitalState> orbital_states = {
+      // NOAA 15.
+      CreateOrbitalStateFromTLE(
+          "1 25338U 98030A   22362.54560834  .00000123  00000+0  69546-4 0  "
+          "9990",
+          "2 25338  98.6255  29.3628 0011429  91.9881 268.2609 "
+          "14.26213421280684"),
+      // ISS.
+      CreateOrbitalStateFromTLE(
+          "1 25544U 98067A   22360.45362469  .00010331  00000+0  19125-3 0  "
+          "9990",
+          "2 25544  51.6432 104.1404 0005590 189.8055 206.4927 "
+          "15.49615193375001"),
+  };
+
+  const Time geodetic_time{DateTime(2022, 12, 28), TimeScale::kUTC};
+  const std::vector<ITRF> site_positions = {
+      ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(50.0),
+                                       .longitude = DegreesToRadians(5.0),
+                                   }),
+                                   geodetic_time)),
+      ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(40.0),
+                                       .longitude = DegreesToRadians(-75.0),
+                                   }),
+                                   geodetic_time)),
+  };
+
+  // NOAA 15 is above the first site at the start time.
+  const Time start_time{DateTime(2022, 12, 28, 18, 20), TimeScale::kUTC};
+  const Time end_time{DateTime(2022, 12, 29, 18, 20), TimeScale::kUTC};
+
+  const PredictPassOptions options = {
+      .min_elevation = DegreesToRadians(5.0),
+  };
+
+  std::vector<SatelliteSitePass> passes;
+  PredictPasses(options,
+                orbital_states,
+                site_positions,
+                start_time,
+                end_time,
+                [&](const SatelliteSitePass& pass) { passes.push_back(pass); });
+
+  // The passes of the same satellite and site are expected to match the
+  // passes predicted one by one.
+  const double tolerance = 2 * double(options.time_tolerance.InSeconds());
+  int num_passes = 0;
+  for (int satellite_index = 0; satellite_index < orbital_states.size();
+       ++satellite_index) {
+    for (int site_index = 0; site_index < site_positions.size();
+         ++site_index) {
+      PredictPassOptions site_options = options;
+      site_options.site_position = site_positions[site_index];
+
+      Time pass_start_time = start_time;
+      for (const SatelliteSitePass& site_pass : passes) {
+        if (site_pass.satellite_index != satellite_index ||
+            site_pass.site_index != site_index) {
+          continue;
+        }
+
+        const SatellitePass& pass = site_pass.pass;
+        const SatellitePass expected_pass = PredictCurrentOrNextPass(
+            site_options, orbital_states[satellite_index], pass_start_time);
+
+        ASSERT_TRUE(expected_pass.aos);
+        ASSERT_TRUE(expected_pass.los);
+
+        if (pass.aos) {
+          EXPECT_NEAR(SecondsBetween(*pass.aos, *expected_pass.aos),
+                      0,
+                      tolerance);
+        } else {
+          EXPECT_LT(SecondsBetween(*expected_pass.aos, start_time), 0);
+        }
+
+        ASSERT_TRUE(pass.los);
+        EXPECT_NEAR(
+            SecondsBetween(*pass.los, *expected_pass.los), 0, tolerance);
+
+        EXPECT_NEAR(pass.max_elevation, expected_pass.max_elevation, 1e-6);
+
+        pass_start_time = *pass.los + TimeDifference::FromSeconds(60);
+        ++num_passes;
+      }
+    }
+  }
+
+  EXPECT_EQ(num_passes, passes.size());
+  EXPECT_GT(num_passes, 10);
+
+  // The first pass is the one in progress at the start time.
+  ASSERT_FALSE(passes.empty());
+  EXPECT_EQ(passes[0].satellite_index, 0);
+  EXPECT_EQ(passes[0].site_index, 0);
+  EXPECT_FALSE(passes[0].pass.aos);
+}
+
+TEST_F(PassTest, PredictPassesWithExecutor) {
+  const OrbitalState noaa15 = CreateOrbitalStateFromTLE(
+      "1 25338U 98030A   22362.54560834  .00000123  00000+0  69546-4 0  9990",
+      "2 25338  98.6255  29.3628 0011429  91.9881 268.2609 14.26213421280684");
+  const OrbitalState iss = CreateOrbitalStateFromTLE(
+      "1 25544U 98067A   22360.45362469  .00010331  00000+0  19125-3 0  9990",
+      "2 25544  51.6432 104.1404 0005590 189.8055 206.4927 15.49615193375001");
+
+  // Enough satellites for the prediction to be split into multiple blocks.
+  std::vector<OrbitalState> orbital_states;
+  for (int i = 0; i < 20; ++i) {
+    orbital_states.push_back(noaa15);
+    orbital_states.push_back(iss);
+  }
+
+  const Time geodetic_time{DateTime(2022, 12, 28), TimeScale::kUTC};
+  const std::vector<ITRF> site_positions = {
+      ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(50.0),
+                                       .longitude = DegreesToRadians(5.0),
+                                   }),
+                                   geodetic_time)),
+      ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(40.0),
+                                       .longitude = DegreesToRadians(-75.0),
+                                   }),
+                                   geodetic_time)),
+  };
+
+  const Time start_time{DateTime(2022, 12, 28, 18, 20), TimeScale::kUTC};
+  const Time end_time{DateTime(2022, 12, 29, 18, 20), TimeScale::kUTC};
+
+  const PredictPassOptions options = {
+      .min_elevation = DegreesToRadians(5.0),
+  };
+
+  std::vector<SatelliteSitePass> expected_passes;
+  PredictPasses(options,
+                orbital_states,
+                site_positions,
+                start_time,
+                end_time,
+                [&](const SatelliteSitePass& pass) {
+                  expected_passes.push_back(pass);
+                });
+  ASSERT_GT(expected_passes.size(), 100);
+
+  for (const int num_threads : {1, 3}) {
+    ThreadPool thread_pool(num_threads);
+
+    std::vector<SatelliteSitePass> passes;
+    PredictPasses(
+        options,
+        orbital_states,
+        site_positions,
+        start_time,
+        end_time,
+        thread_pool,
+        [&](const SatelliteSitePass& pass) { passes.push_back(pass); });
+
+    // The passes and their order are expected to be exactly the same as the
+    // ones of the serial prediction.
+    ASSERT_EQ(passes.size(), expected_passes.size());
+    for (int i = 0; i < passes.size(); ++i) {
+      const SatelliteSitePass& pass = passes[i];
+      const SatelliteSitePass& expected_pass = expected_passes[i];
+
+      EXPECT_EQ(pass.satellite_index, expected_pass.satellite_index);
+      EXPECT_EQ(pass.site_index, expected_pass.site_index);
+      EXPECT_EQ(pass.is_failed, expected_pass.is_failed);
+      EXPECT_EQ(pass.pass.is_always_visible,
+                expected_pass.pass.is_always_visible);
+      EXPECT_EQ(pass.pass.aos, expected_pass.pass.aos);
+      EXPECT_EQ(pass.pass.los, expected_pass.pass.los);
+      EXPECT_EQ(pass.pass.tca, expected_pass.pass.tca);
+      EXPECT_EQ(pass.pass.max_elevation, expected_pass.pass.max_elevation);
+    }
+  }
+}
+
+// The failure of the prediction of a satellite is reported, and does not stop
+// the prediction of other satellites.
+TEST_F(PassTest, PredictPassesFailure) {
+  const std::vector<OrbitalState> orbital_states = {
+      // ISS, which the SGP4 model decays long before the time window.
+      CreateOrbitalStateFromTLE(
+          "1 25544U 98067A   22360.45362469  .00010331  00000+0  19125-3 0  "
+          "9990",
+          "2 25544  51.6432 104.1404 0005590 189.8055 206.4927 "
+          "15.49615193375001"),
+      // NOAA 15.
+      CreateOrbitalStateFromTLE(
+          "1 25338U 98030A   22362.54560834  .00000123  00000+0  69546-4 0  "
+          "9990",
+          "2 25338  98.6255  29.3628 0011429  91.9881 268.2609 "
+          "14.26213421280684"),
+  };
+
+  const Time geodetic_time{DateTime(2022, 12, 28), TimeScale::kUTC};
+  const std::vector<ITRF> site_positions = {
+      ITRF::FromGeodetic(
+          Geodetic::FromGeographic(Geographic({
+                                       .latitude = DegreesToRadians(50.0),
+                                       .longitude = DegreesToRadians(5.0),
+                                   }),
+                                   geodetic_time)),
+  };
+
+  const Time start_time{DateTime(2032, 12, 28, 18, 20), TimeScale::kUTC};
+  const Time end_time{DateTime(2032, 12, 29, 18, 20), TimeScale::kUTC};
+
+  std::vector<SatelliteSitePass> passes;
+  PredictPasses({},
+                orbital_states,
+                site_positions,
+                start_time,
+                end_time,
+                [&](const SatelliteSitePass& pass) { passes.push_back(pass); });
+
+  ASSERT_GT(passes.size(), 1);
+
+  EXPECT_EQ(passes[0].satellite_index, 0);
+  EXPECT_EQ(passes[0].site_index, -1);
+  EXPECT_TRUE(passes[0].is_failed);
+
+  for (int i = 1; i < passes.size(); ++i) {
+    EXPECT_EQ(passes[i].satellite_index, 1);
+    EXPECT_EQ(passes[i].site_index, 0);
+    EXPECT_FALSE(passes[i].is_failed);
+  }
+}
+
 }  // namespace astro_core
@@ -1758,7 +1758,7 @@ namespace SGP4Funcs
 
 	bool sgp4
 		(
-		elsetrec& satrec, double tsince,
+		const elsetrec& satrec, elsetrec_state& state, double tsince,
 		double r[3], double v[3]
 		)
 	{
@@ -1775,6 +1775,10 @@ namespace SGP4Funcs
 			xmdf, xmx, xmy, nodedf, xnode, nodep, tc, dndt,
 			twopi, x2o3, vkmpersec, delmtemp;
 		int ktr;
+		// astro_core: coefficients which are re-calculated for deep space
+		// objects on every call, so that the satrec is not modified.
+		double aycof = satrec.aycof, xlcof = satrec.xlcof,
+			con41 = satrec.con41, x1mth2 = satrec.x1mth2, x7thm1 = satrec.x7thm1;
 
 		/* ------------------ set mathematical constants --------------- */
 		// sgp4fix divisor for divide by zero check on inclination
@@ -1788,24 +1792,24 @@ namespace SGP4Funcs
 		vkmpersec = satrec.radiusearthkm * satrec.xke / 60.0;
 
 		/* --------------------- clear sgp4 error flag ----------------- */
-		satrec.t = tsince;
-		satrec.error = 0;
+		state.t = tsince;
+		state.error = 0;
 
 		/* ------- update for secular gravity and atmospheric drag ----- */
-		xmdf = satrec.mo + satrec.mdot * satrec.t;
-		argpdf = satrec.argpo + satrec.argpdot * satrec.t;
-		nodedf = satrec.nodeo + satrec.nodedot * satrec.t;
+		xmdf = satrec.mo + satrec.mdot * state.t;
+		argpdf = satrec.argpo + satrec.argpdot * state.t;
+		nodedf = satrec.nodeo + satrec.nodedot * state.t;
 		argpm = argpdf;
 		mm = xmdf;
-		t2 = satrec.t * satrec.t;
+		t2 = state.t * state.t;
 		nodem = nodedf + satrec.nodecf * t2;
-		tempa = 1.0 - satrec.cc1 * satrec.t;
-		tempe = satrec.bstar * satrec.cc4 * satrec.t;
+		tempa = 1.0 - satrec.cc1 * state.t;
+		tempe = satrec.bstar * satrec.cc4 * state.t;
 		templ = satrec.t2cof * t2;
 
 		if (satrec.isimp != 1)
 		{
-			delomg = satrec.omgcof * satrec.t;
+			delomg = satrec.omgcof * state.t;
 			// sgp4fix use mutliply for speed instead of pow
 			delmtemp = 1.0 + satrec.eta * cos(xmdf);
 			delm = satrec.xmcof *
@@ -1814,14 +1818,14 @@ namespace SGP4Funcs
 			temp = delomg + delm;
 			mm = xmdf + temp;
 			argpm = argpdf - temp;
-			t3 = t2 * satrec.t;
-			t4 = t3 * satrec.t;
+			t3 = t2 * state.t;
+			t4 = t3 * state.t;
 			tempa = tempa - satrec.d2 * t2 - satrec.d3 * t3 -
 				satrec.d4 * t4;
 			tempe = tempe + satrec.bstar * satrec.cc5 * (sin(mm) -
 				satrec.sinmao);
 			templ = templ + satrec.t3cof * t3 + t4 * (satrec.t4cof +
-				satrec.t * satrec.t5cof);
+				state.t * satrec.t5cof);
 		}
 
 		nm = satrec.no_unkozai;
@@ -1829,7 +1833,7 @@ namespace SGP4Funcs
 		inclm = satrec.inclo;
 		if (satrec.method == 'd')
 		{
-			tc = satrec.t;
+			tc = state.t;
 			dspace
 				(
 				satrec.irez,
@@ -1839,10 +1843,10 @@ namespace SGP4Funcs
 				satrec.d5433, satrec.dedt, satrec.del1,
 				satrec.del2, satrec.del3, satrec.didt,
 				satrec.dmdt, satrec.dnodt, satrec.domdt,
-				satrec.argpo, satrec.argpdot, satrec.t, tc,
+				satrec.argpo, satrec.argpdot, state.t, tc,
 				satrec.gsto, satrec.xfact, satrec.xlamo,
-				satrec.no_unkozai, satrec.atime,
-				em, argpm, inclm, satrec.xli, mm, satrec.xni,
+				satrec.no_unkozai, state.atime,
+				em, argpm, inclm, state.xli, mm, state.xni,
 				nodem, dndt, nm
 				);
 		} // if method = d
@@ -1850,7 +1854,7 @@ namespace SGP4Funcs
 		if (nm <= 0.0)
 		{
 			//         printf("# error nm %f\n", nm);
-			satrec.error = 2;
+			state.error = 2;
 			// sgp4fix add return
 			return false;
 		}
@@ -1863,7 +1867,7 @@ namespace SGP4Funcs
 		if ((em >= 1.0) || (em < -0.001)/* || (am < 0.95)*/)
 		{
 			//         printf("# error em %f\n", em);
-			satrec.error = 1;
+			state.error = 1;
 			// sgp4fix to return if there is an error in eccentricity
 			return false;
 		}
@@ -1881,13 +1885,13 @@ namespace SGP4Funcs
 		mm = fmod(xlm - argpm - nodem, twopi);
 
 		// sgp4fix recover singly averaged mean elements
-		satrec.am = am;
-		satrec.em = em;
-		satrec.im = inclm;
-		satrec.Om = nodem;
-		satrec.om = argpm;
-		satrec.mm = mm;
-		satrec.nm = nm;
+		state.am = am;
+		state.em = em;
+		state.im = inclm;
+		state.Om = nodem;
+		state.om = argpm;
+		state.mm = mm;
+		state.nm = nm;
 
 		/* ----------------- compute extra mean quantities ------------- */
 		sinim = sin(inclm);
@@ -1911,7 +1915,7 @@ namespace SGP4Funcs
 				satrec.sgh2, satrec.sgh3, satrec.sgh4,
 				satrec.sh2, satrec.sh3, satrec.si2,
 				satrec.si3, satrec.sl2, satrec.sl3,
-				satrec.sl4, satrec.t, satrec.xgh2,
+				satrec.sl4, state.t, satrec.xgh2,
 				satrec.xgh3, satrec.xgh4, satrec.xh2,
 				satrec.xh3, satrec.xi2, satrec.xi3,
 				satrec.xl2, satrec.xl3, satrec.xl4,
@@ -1927,7 +1931,7 @@ namespace SGP4Funcs
 			if ((ep < 0.0) || (ep > 1.0))
 			{
 				//            printf("# error ep %f\n", ep);
-				satrec.error = 3;
+				state.error = 3;
 				// sgp4fix add return
 				return false;
 			}
@@ -1938,17 +1942,17 @@ namespace SGP4Funcs
 		{
 			sinip = sin(xincp);
 			cosip = cos(xincp);
-			satrec.aycof = -0.5*satrec.j3oj2*sinip;
+			aycof = -0.5*satrec.j3oj2*sinip;
 			// sgp4fix for divide by zero for xincp = 180 deg
 			if (fabs(cosip + 1.0) > 1.5e-12)
-				satrec.xlcof = -0.25 * satrec.j3oj2 * sinip * (3.0 + 5.0 * cosip) / (1.0 + cosip);
+				xlcof = -0.25 * satrec.j3oj2 * sinip * (3.0 + 5.0 * cosip) / (1.0 + cosip);
 			else
-				satrec.xlcof = -0.25 * satrec.j3oj2 * sinip * (3.0 + 5.0 * cosip) / temp4;
+				xlcof = -0.25 * satrec.j3oj2 * sinip * (3.0 + 5.0 * cosip) / temp4;
 		}
 		axnl = ep * cos(argpp);
 		temp = 1.0 / (am * (1.0 - ep * ep));
-		aynl = ep* sin(argpp) + temp * satrec.aycof;
-		xl = mp + argpp + nodep + temp * satrec.xlcof * axnl;
+		aynl = ep* sin(argpp) + temp * aycof;
+		xl = mp + argpp + nodep + temp * xlcof * axnl;
 
 		/* --------------------- solve kepler's equation --------------- */
 		u = fmod(xl - nodep, twopi);
@@ -1977,7 +1981,7 @@ namespace SGP4Funcs
 		if (pl < 0.0)
 		{
 			//         printf("# error pl %f\n", pl);
-			satrec.error = 4;
+			state.error = 4;
 			// sgp4fix add return
 			return false;
 		}
@@ -2001,18 +2005,18 @@ namespace SGP4Funcs
 			if (satrec.method == 'd')
 			{
 				cosisq = cosip * cosip;
-				satrec.con41 = 3.0*cosisq - 1.0;
-				satrec.x1mth2 = 1.0 - cosisq;
-				satrec.x7thm1 = 7.0*cosisq - 1.0;
+				con41 = 3.0*cosisq - 1.0;
+				x1mth2 = 1.0 - cosisq;
+				x7thm1 = 7.0*cosisq - 1.0;
 			}
-			mrt = rl * (1.0 - 1.5 * temp2 * betal * satrec.con41) +
-				0.5 * temp1 * satrec.x1mth2 * cos2u;
-			su = su - 0.25 * temp2 * satrec.x7thm1 * sin2u;
+			mrt = rl * (1.0 - 1.5 * temp2 * betal * con41) +
+				0.5 * temp1 * x1mth2 * cos2u;
+			su = su - 0.25 * temp2 * x7thm1 * sin2u;
 			xnode = nodep + 1.5 * temp2 * cosip * sin2u;
 			xinc = xincp + 1.5 * temp2 * cosip * sinip * cos2u;
-			mvt = rdotl - nm * temp1 * satrec.x1mth2 * sin2u / satrec.xke;
-			rvdot = rvdotl + nm * temp1 * (satrec.x1mth2 * cos2u +
-				1.5 * satrec.con41) / satrec.xke;
+			mvt = rdotl - nm * temp1 * x1mth2 * sin2u / satrec.xke;
+			rvdot = rvdotl + nm * temp1 * (x1mth2 * cos2u +
+				1.5 * con41) / satrec.xke;
 
 			/* --------------------- orientation vectors ------------------- */
 			sinsu = sin(su);
@@ -2043,7 +2047,7 @@ namespace SGP4Funcs
 		if (mrt < 1.0)
 		{
 			//         printf("# decay condition %11.6f \n",mrt);
-			satrec.error = 6;
+			state.error = 6;
 			return false;
 		}
 
@@ -2051,6 +2055,290 @@ namespace SGP4Funcs
 		return true;
 	}  // sgp4
 
+	bool sgp4
+		(
+		elsetrec& satrec, double tsince,
+		double r[3], double v[3]
+		)
+	{
+		// astro_core: the state of the satrec is updated with the state of the
+		// prediction to keep behavior of the original sgp4().
+		elsetrec_state state;
+		sgp4initstate(satrec, state);
+
+		const bool result = sgp4(satrec, state, tsince, r, v);
+
+		satrec.t = state.t;
+		satrec.error = state.error;
+		satrec.atime = state.atime;
+		satrec.xli = state.xli;
+		satrec.xni = state.xni;
+		satrec.am = state.am;
+		satrec.em = state.em;
+		satrec.im = state.im;
+		satrec.Om = state.Om;
+		satrec.om = state.om;
+		satrec.mm = state.mm;
+		satrec.nm = state.nm;
+
+		return result;
+	}  // sgp4
+
+	/* -----------------------------------------------------------------------------
+	*
+	*                           procedure sgp4initstate
+	*
+	*  astro_core: this procedure initializes the per-call state of the sgp4
+	*    prediction from the satrec initialized by the sgp4init(). the deep space
+	*    resonance integration of the state starts from the epoch.
+	*
+	*  inputs        :
+	*    satrec      - initialised structure from sgp4init() call.
+	*
+	*  outputs       :
+	*    state       - state of the prediction
+	---------------------------------------------------------------------------- */
+
+	void sgp4initstate
+		(
+		const elsetrec& satrec, elsetrec_state& state
+		)
+	{
+		state.t = satrec.t;
+		state.error = satrec.error;
+		state.atime = satrec.atime;
+		state.xli = satrec.xli;
+		state.xni = satrec.xni;
+		state.am = satrec.am;
+		state.em = satrec.em;
+		state.im = satrec.im;
+		state.Om = satrec.Om;
+		state.om = satrec.om;
+		state.mm = satrec.mm;
+		state.nm = satrec.nm;
+	}  // sgp4initstate
+
+
+
+	/* -----------------------------------------------------------------------------
+	*
+	*                           procedure sgp4nearearth
+	*
+	*  astro_core: this procedure is the sgp4 prediction of a near earth satellite
+	*    (method 'n') at many times. the secular gravity and drag update of a
+	*    block of times is done in one loop over plain arrays, and the periodics
+	*    of the block in another one. the terms which only depend on the satrec
+	*    are calculated once. the floating point operations are the same as in
+	*    the sgp4(), so are the results.
+	*
+	*  inputs        :
+	*    satrec	 - initialised structure from sgp4init() call, method 'n'.
+	*    n           - number of times
+	*    tsince	 - times since epoch (minutes)
+	*
+	*  outputs       :
+	*    r           - position vectors                    km
+	*    v           - velocities                          km/sec
+	*    error       - error code of the first failed prediction, see sgp4()
+	*  return code - number of times predicted before the first error.
+	---------------------------------------------------------------------------- */
+
+	int sgp4nearearth
+		(
+		const elsetrec& satrec, int n, const double tsince[],
+		double r[][3], double v[][3], int& error
+		)
+	{
+		// number of times of a block of the secular and periodic loops
+		const int blocksize = 64;
+
+		double am[blocksize], em[blocksize], argpm[blocksize],
+			nodem[blocksize], mm[blocksize], nm[blocksize];
+		double axnl, aynl, betal, cnod, cos2u, coseo1, cosi, cossu, cosu,
+			delm, delomg, ecose, el2, eo1, esine, argpdf, pl, mrt, mvt,
+			rdotl, rl, rvdot, rvdotl, sin2u, sineo1, sini, sinsu, sinu,
+			snod, su, t, t2, t3, t4, tem5, temp, temp1, temp2, tempa,
+			tempe, templ, u, ux, uy, uz, vx, vy, vz, xinc, xl, xlm, xmdf,
+			xmx, xmy, nodedf, xnode, delmtemp;
+		int ktr;
+
+		const double twopi = 2.0 * pi;
+		const double x2o3 = 2.0 / 3.0;
+		const double vkmpersec = satrec.radiusearthkm * satrec.xke / 60.0;
+
+		error = 0;
+
+		if (satrec.no_unkozai <= 0.0)
+		{
+			error = 2;
+			return 0;
+		}
+
+		/* ----------------- compute extra mean quantities ------------- */
+		const double sinim = sin(satrec.inclo);
+		const double cosim = cos(satrec.inclo);
+
+		for (int start = 0; start < n; start += blocksize)
+		{
+			int count = n - start < blocksize ? n - start : blocksize;
+
+			/* ------- update for secular gravity and atmospheric drag ----- */
+			for (int i = 0; i < count; ++i)
+			{
+				t = tsince[start + i];
+				xmdf = satrec.mo + satrec.mdot * t;
+				argpdf = satrec.argpo + satrec.argpdot * t;
+				nodedf = satrec.nodeo + satrec.nodedot * t;
+				argpm[i] = argpdf;
+				mm[i] = xmdf;
+				t2 = t * t;
+				nodem[i] = nodedf + satrec.nodecf * t2;
+				tempa = 1.0 - satrec.cc1 * t;
+				tempe = satrec.bstar * satrec.cc4 * t;
+				templ = satrec.t2cof * t2;
+
+				if (satrec.isimp != 1)
+				{
+					delomg = satrec.omgcof * t;
+					delmtemp = 1.0 + satrec.eta * cos(xmdf);
+					delm = satrec.xmcof *
+						(delmtemp * delmtemp * delmtemp -
+						satrec.delmo);
+					temp = delomg + delm;
+					mm[i] = xmdf + temp;
+					argpm[i] = argpdf - temp;
+					t3 = t2 * t;
+					t4 = t3 * t;
+					tempa = tempa - satrec.d2 * t2 - satrec.d3 * t3 -
+						satrec.d4 * t4;
+					tempe = tempe + satrec.bstar * satrec.cc5 * (sin(mm[i]) -
+						satrec.sinmao);
+					templ = templ + satrec.t3cof * t3 + t4 * (satrec.t4cof +
+						t * satrec.t5cof);
+				}
+
+				am[i] = pow((satrec.xke / satrec.no_unkozai), x2o3) * tempa * tempa;
+				nm[i] = satrec.xke / pow(am[i], 1.5);
+				em[i] = satrec.ecco - tempe;
+
+				if ((em[i] >= 1.0) || (em[i] < -0.001))
+				{
+					// the periodics are calculated for the times before the
+					// error
+					error = 1;
+					count = i;
+					break;
+				}
+				if (em[i] < 1.0e-6)
+					em[i] = 1.0e-6;
+				mm[i] = mm[i] + satrec.no_unkozai * templ;
+				xlm = mm[i] + argpm[i] + nodem[i];
+
+				nodem[i] = fmod(nodem[i], twopi);
+				argpm[i] = fmod(argpm[i], twopi);
+				xlm = fmod(xlm, twopi);
+				mm[i] = fmod(xlm - argpm[i] - nodem[i], twopi);
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				/* -------------------- long period periodics ------------------ */
+				axnl = em[i] * cos(argpm[i]);
+				temp = 1.0 / (am[i] * (1.0 - em[i] * em[i]));
+				aynl = em[i] * sin(argpm[i]) + temp * satrec.aycof;
+				xl = mm[i] + argpm[i] + nodem[i] + temp * satrec.xlcof * axnl;
+
+				/* --------------------- solve kepler's equation --------------- */
+				u = fmod(xl - nodem[i], twopi);
+				eo1 = u;
+				tem5 = 9999.9;
+				ktr = 1;
+				while ((fabs(tem5) >= 1.0e-12) && (ktr <= 10))
+				{
+					sineo1 = sin(eo1);
+					coseo1 = cos(eo1);
+					tem5 = 1.0 - coseo1 * axnl - sineo1 * aynl;
+					tem5 = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+					if (fabs(tem5) >= 0.95)
+						tem5 = tem5 > 0.0 ? 0.95 : -0.95;
+					eo1 = eo1 + tem5;
+					ktr = ktr + 1;
+				}
+
+				/* ------------- short period preliminary quantities ----------- */
+				ecose = axnl*coseo1 + aynl*sineo1;
+				esine = axnl*sineo1 - aynl*coseo1;
+				el2 = axnl*axnl + aynl*aynl;
+				pl = am[i]*(1.0 - el2);
+				if (pl < 0.0)
+				{
+					error = 4;
+					return start + i;
+				}
+
+				rl = am[i] * (1.0 - ecose);
+				rdotl = sqrt(am[i]) * esine / rl;
+				rvdotl = sqrt(pl) / rl;
+				betal = sqrt(1.0 - el2);
+				temp = esine / (1.0 + betal);
+				sinu = am[i] / rl * (sineo1 - aynl - axnl * temp);
+				cosu = am[i] / rl * (coseo1 - axnl + aynl * temp);
+				su = atan2(sinu, cosu);
+				sin2u = (cosu + cosu) * sinu;
+				cos2u = 1.0 - 2.0 * sinu * sinu;
+				temp = 1.0 / pl;
+				temp1 = 0.5 * satrec.j2 * temp;
+				temp2 = temp1 * temp;
+
+				/* -------------- update for short period periodics ------------ */
+				mrt = rl * (1.0 - 1.5 * temp2 * betal * satrec.con41) +
+					0.5 * temp1 * satrec.x1mth2 * cos2u;
+				su = su - 0.25 * temp2 * satrec.x7thm1 * sin2u;
+				xnode = nodem[i] + 1.5 * temp2 * cosim * sin2u;
+				xinc = satrec.inclo + 1.5 * temp2 * cosim * sinim * cos2u;
+				mvt = rdotl - nm[i] * temp1 * satrec.x1mth2 * sin2u / satrec.xke;
+				rvdot = rvdotl + nm[i] * temp1 * (satrec.x1mth2 * cos2u +
+					1.5 * satrec.con41) / satrec.xke;
+
+				/* --------------------- orientation vectors ------------------- */
+				sinsu = sin(su);
+				cossu = cos(su);
+				snod = sin(xnode);
+				cnod = cos(xnode);
+				sini = sin(xinc);
+				cosi = cos(xinc);
+				xmx = -snod * cosi;
+				xmy = cnod * cosi;
+				ux = xmx * sinsu + cnod * cossu;
+				uy = xmy * sinsu + snod * cossu;
+				uz = sini * sinsu;
+				vx = xmx * cossu - cnod * sinsu;
+				vy = xmy * cossu - snod * sinsu;
+				vz = sini * cossu;
+
+				/* --------- position and velocity (in km and km/sec) ---------- */
+				r[start + i][0] = (mrt * ux)* satrec.radiusearthkm;
+				r[start + i][1] = (mrt * uy)* satrec.radiusearthkm;
+				r[start + i][2] = (mrt * uz)* satrec.radiusearthkm;
+				v[start + i][0] = (mvt * ux + rvdot * vx) * vkmpersec;
+				v[start + i][1] = (mvt * uy + rvdot * vy) * vkmpersec;
+				v[start + i][2] = (mvt * uz + rvdot * vz) * vkmpersec;
+
+				// sgp4fix for decaying satellites
+				if (mrt < 1.0)
+				{
+					error = 6;
+					return start + i;
+				}
+			}
+
+			if (error != 0)
+				return start + count;
+		}
+
+		return n;
+	}  // sgp4nearearth
+
 
 
 
@@ -112,6 +112,22 @@ typedef struct elsetrec
 
 } elsetrec;
 
+// astro_core: state of a single sgp4 prediction.
+// Allows to use the same satrec from multiple threads: the satrec is only read
+// by the prediction, and all the values which are modified by the prediction
+// are stored in this structure.
+typedef struct elsetrec_state
+{
+  int    error;
+  double t;
+
+  /* Deep Space resonance integrator */
+  double atime  , xli    , xni;
+
+  // sgp4fix add singly averaged variables
+  double am     , em     , im     , Om       , om     , mm      , nm;
+} elsetrec_state;
+
 
 namespace SGP4Funcs
 {
@@ -134,6 +150,26 @@ namespace SGP4Funcs
 		double r[3], double v[3]
 		);
 
+	// astro_core: prediction which does not modify the satrec.
+	bool sgp4
+		(
+		const elsetrec& satrec, elsetrec_state& state, double tsince,
+		double r[3], double v[3]
+		);
+
+	// astro_core: initialize state of prediction from the satrec.
+	void sgp4initstate
+		(
+		const elsetrec& satrec, elsetrec_state& state
+		);
+
+	// astro_core: prediction of a near earth satellite at many times.
+	int sgp4nearearth
+		(
+		const elsetrec& satrec, int n, const double tsince[],
+		double r[][3], double v[][3], int& error
+		);
+
 	void getgravconst
 		(
 		gravconsttype whichconst,
@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <memory>
+#include <span>
+
 #include "astro_core/base/result.h"
 #include "astro_core/coordinate/teme.h"
 #include "astro_core/satellite/internal/sgp4/SGP4.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_scales.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
@@ -18,6 +22,10 @@ inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
 class TLE;
 
+namespace experimental {
+class CatalogPropagator;
+}  // namespace experimental
+
 class OrbitalState {
  public:
   enum class Error {
@@ -35,7 +43,24 @@ class OrbitalState {
 
   using PredictResult = Result<TEME, Error>;
 
-  OrbitalState() = default;
+  // Result of the prediction at multiple times.
+  //
+  // The value is the number of times for which the prediction succeeded. The
+  // prediction stops at the first failure, in which case the result has both
+  // the value and the error of the failed prediction.
+  using PredictManyResult = Result<size_t, Error>;
+
+  OrbitalState();
+
+  // Copying the orbital state of an object in resonance copies the checkpoints
+  // of its resonance integrator.
+  OrbitalState(const OrbitalState& other);
+  OrbitalState(OrbitalState&& other) noexcept;
+
+  ~OrbitalState();
+
+  auto operator=(const OrbitalState& other) -> OrbitalState&;
+  auto operator=(OrbitalState&& other) noexcept -> OrbitalState&;
 
   // Initialize the initial state of the model using data from TLE.
   //
@@ -45,11 +70,89 @@ class OrbitalState {
   auto InitializeFromTLE(const TLE& tle) -> bool;
 
   // Predict the position and velocity of this satellite at the given time.
+  //
+  // The prediction does not modify the orbital state, so it is safe to predict
+  // the same orbital state from multiple threads.
   auto Predict(const Time& time) const -> PredictResult;
 
+  // Predict the position and velocity of this satellite at the time of the
+  // given time scales.
+  //
+  // Allows to re-use the time scale conversion for other calculations at the
+  // same time, such as the TEME-to-ITRF transformation of the prediction.
+  auto Predict(const TimeScales& scales) const -> PredictResult;
+
+  // Predict the position and velocity of this satellite at the given times.
+  //
+  // The teme span is to be of the same size as the times span. The i-th element
+  // of the teme span receives the prediction at the i-th time. The result is the
+  // same as Predict() at every time.
+  //
+  // The times are converted to the time since the epoch of the model once,
+  // before the prediction. If all times are of the same UTC, TAI, or TT scale
+  // and no leap second happens between them, the conversion to UTC uses one
+  // UTC-minus-scale difference for all times. Otherwise every time is converted
+  // to UTC individually. For the near-Earth satellites the SGP4 model is
+  // evaluated for blocks of times, with the secular and the periodic terms
+  // calculated in separate loops.
+  auto PredictMany(std::span<const Time> times, std::span<TEME> teme) const
+      -> PredictManyResult;
+
+  // Predict the position and velocity of this satellite at the uniform time
+  // grid in the scale of the start time:
+  //   teme[i] = Predict(start_time + time_step * i)
+  //
+  // The time of the grid is calculated from the start for every sample rather
+  // than accumulated, and the observation time of the predictions is in the
+  // scale of the start time. The conversion to UTC is done in the same way as
+  // for the prediction at the given times.
+  auto PredictMany(const Time& start_time,
+                   const TimeDifference& time_step,
+                   std::span<TEME> teme) const -> PredictManyResult;
+
  private:
+  friend class experimental::CatalogPropagator;
+
+  // Convert error code of the SGP4 model to the Error.
+  static auto TranslateSGP4Error(int sgp4_error) -> Error;
+
+  // Predict the position and velocity of this satellite at the given time,
+  // which is expected to be in UTC scale.
+  //
+  // The observation time of the result is set to the observation_time.
+  auto PredictUTC(const Time& time_utc, const Time& observation_time) const
+      -> PredictResult;
+
+  // Predict the position and velocity of this satellite at the given time since
+  // the epoch in minutes.
+  //
+  // The initial_state is the state of the SGP4 model initialized from the
+  // satrec, it is not modified by the prediction. The observation time of the
+  // result is set to the observation_time.
+  auto PredictSinceEpoch(double time_since_epoch_min,
+                         const sgp_internal::elsetrec_state& initial_state,
+                         const Time& observation_time) const -> PredictResult;
+
+  // Predict the position and velocity of this satellite at the given times
+  // since the epoch in minutes.
+  //
+  // The observation time of the i-th element of the teme span is expected to
+  // be set by the caller, and is kept in its prediction.
+  auto PredictManySinceEpoch(std::span<const double> time_since_epoch_min,
+                             std::span<TEME> teme) const -> PredictManyResult;
+
+  // Checkpoints of the deep space resonance integrator.
+  // Defined in the implementation file, as it is only used by the predictions.
+  class ResonanceCheckpoints;
+
   // Internal state used for the SGP4 model.
+  // It is initialized once from the TLE and is not modified by predictions.
   sgp_internal::elsetrec sgp4_satrec_{};
+
+  // Checkpoints of the deep space resonance integrator, updated by the
+  // predictions. Only allocated for the deep space objects in resonance, which
+  // keeps the orbital state of other objects small and cheap to copy.
+  std::unique_ptr<ResonanceCheckpoints> resonance_checkpoints_;
 };
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
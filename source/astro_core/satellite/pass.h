@@ -9,16 +9,23 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <ostream>
+#include <span>
+#include <type_traits>
 
 #include "astro_core/coordinate/itrf.h"
+#include "astro_core/coordinate/observer_frame.h"
 #include "astro_core/time/time.h"
+#include "astro_core/time/time_difference.h"
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
+class Executor;
 class OrbitalState;
 class Time;
 class ITRF;
@@ -49,14 +56,59 @@ struct SatellitePass {
   std::optional<Time> aos;
   std::optional<Time> los;
 
+  // Time of closest approach (TCA): the time at which the satellite reaches
+  // its maximum elevation during the pass.
+  //
+  // When the pass is not entirely within the prediction time window the TCA is
+  // the time of the maximum elevation within the part of the pass which is
+  // inside of the window.
+  //
+  // Set to nullopt when the satellite is never visible.
+  std::optional<Time> tca;
+
   // Maximum elevation of the satellite during the pass, in radians.
   double max_elevation{0};
+
+  // Azimuth (in radians) and distance from the observer (in meters) of the
+  // satellite at the TCA.
+  double tca_azimuth{0};
+  double tca_distance{0};
 };
 
 auto operator<<(std::ostream& os, const SatellitePass& pass) -> std::ostream&;
 
+// Algorithm used to refine the approximate AOS and LOS times.
+//
+// The approximate times are found by sampling the satellite trajectory with a
+// coarse time step, and are then refined to the actual horizon crossing.
+enum class PassRefineMethod {
+  // Walk from the approximate time in 1 second steps until the satellite
+  // crosses the horizon.
+  //
+  // Requires up to a few hundreds of the satellite position predictions per
+  // AOS or LOS, and gives 1 second precision. The AOS is the last time point
+  // below the horizon before the satellite raises above it, and the LOS is the
+  // last time point above the horizon.
+  kStep,
+
+  // Root bracketing on the elevation function, combining Newton steps which
+  // use the elevation rate derived from the satellite velocity with the
+  // Illinois variant of the regula falsi.
+  //
+  // Typically requires a handful of the satellite position predictions per AOS
+  // or LOS. Both AOS and LOS are time points at which the satellite is above
+  // the horizon, and they are within time_tolerance from the actual horizon
+  // crossing.
+  kRootBracketing,
+};
+
 struct PredictPassOptions {
-  ITRF site_position{};
+  // Frame of the observer.
+  //
+  // Can be assigned from the ITRF position of the site. The frame caches the
+  // geodetic coordinate of the site and its horizontal frame, so constructing
+  // it once and re-using it for many predictions avoids re-calculating those.
+  ObserverFrame site_position{};
 
   // Minimum satellite elevation (in radians) at which the satellite is
   // considered to be visible.
@@ -70,6 +122,13 @@ struct PredictPassOptions {
   // This is also the number of days to look backward for AOS in cases when the
   // satellite is visible at the start time of prediction.
   int num_days_to_predict{7};
+
+  // Algorithm used to refine AOS and LOS.
+  PassRefineMethod refine_method{PassRefineMethod::kRootBracketing};
+
+  // Precision of the refined AOS and LOS.
+  // Only used by the PassRefineMethod::kRootBracketing.
+  TimeDifference time_tolerance{TimeDifference::FromSeconds(0.1)};
 };
 
 // Get prediction of the currently visible pass, or the next visible pass.
@@ -90,5 +149,111 @@ auto PredictNextPass(const PredictPassOptions& options,
                      const OrbitalState& orbital_state,
                      const Time& start_time) -> SatellitePass;
 
+// Pass of one of multiple satellites over one of multiple observer sites.
+struct SatelliteSitePass {
+  // Index of the satellite in the orbital_states, and index of the site in the
+  // site_positions passed to the PredictPasses().
+  int satellite_index{-1};
+  int site_index{-1};
+
+  SatellitePass pass;
+
+  // True if the prediction of the satellite has failed, for example because
+  // its orbit has decayed within the time window. In this case the site_index
+  // is -1 and the pass is empty.
+  bool is_failed{false};
+};
+
+namespace pass_internal {
+
+using PredictPassesCallback = void (*)(void* data,
+                                       const SatelliteSitePass& pass);
+
+void PredictPasses(const PredictPassOptions& options,
+                   std::span<const OrbitalState> orbital_states,
+                   std::span<const ITRF> site_positions,
+                   const Time& start_time,
+                   const Time& end_time,
+                   Executor* executor,
+                   PredictPassesCallback callback,
+                   void* callback_data);
+
+}  // namespace pass_internal
+
+// Predict all passes of the given satellites over the given observer sites
+// within the [start_time, end_time) time window.
+//
+// The callback is invoked with every pass as SatelliteSitePass. The passes are
+// grouped by satellite in the order of the orbital_states. The passes of a
+// satellite are ordered by the time at which they end (their LOS, or the end of
+// the time window), and passes which end within the same coarse time step are
+// ordered by the site index.
+//
+// All satellites and sites share the same coarse sampling of the time window,
+// and the Earth orientation is calculated once per sample. Every satellite is
+// propagated once per sample regardless of the number of sites. The AOS, LOS,
+// and TCA are refined the same way as in the PredictCurrentOrNextPass().
+//
+// A pass which started before the start_time has no AOS, and a pass which
+// did not end before the end_time has no LOS. A pass which lasts through the
+// entire time window is marked as always visible.
+//
+// Passes with the maximum elevation below the options.min_elevation are not
+// reported. The options.site_position and options.num_days_to_predict are
+// ignored: the sites and the time window are given explicitly.
+//
+// If the prediction of a satellite fails the callback is invoked once with the
+// is_failed set for it, and no more passes are reported for the satellite. The
+// passes reported for it before the failure are kept.
+template <class F>
+void PredictPasses(const PredictPassOptions& options,
+                   std::span<const OrbitalState> orbital_states,
+                   std::span<const ITRF> site_positions,
+                   const Time& start_time,
+                   const Time& end_time,
+                   F&& callback) {
+  using Callback = std::remove_reference_t<F>;
+
+  pass_internal::PredictPasses(
+      options,
+      orbital_states,
+      site_positions,
+      start_time,
+      end_time,
+      nullptr,
+      [](void* data, const SatelliteSitePass& pass) {
+        std::invoke(*static_cast<Callback*>(data), pass);
+      },
+      const_cast<void*>(static_cast<const void*>(std::addressof(callback))));
+}
+
+// Predict all passes of the given satellites over the given observer sites,
+// using the executor to predict passes of multiple satellites concurrently.
+//
+// The callback is invoked from the calling thread, with the same passes and in
+// the same order as the PredictPasses() without an executor.
+template <class F>
+void PredictPasses(const PredictPassOptions& options,
+                   std::span<const OrbitalState> orbital_states,
+                   std::span<const ITRF> site_positions,
+                   const Time& start_time,
+                   const Time& end_time,
+                   Executor& executor,
+                   F&& callback) {
+  using Callback = std::remove_reference_t<F>;
+
+  pass_internal::PredictPasses(
+      options,
+      orbital_states,
+      site_positions,
+      start_time,
+      end_time,
+      &executor,
+      [](void* data, const SatelliteSitePass& pass) {
+        std::invoke(*static_cast<Callback*>(data), pass);
+      },
+      const_cast<void*>(static_cast<const void*>(std::addressof(callback))));
+}
+
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
 }  // namespace astro_core
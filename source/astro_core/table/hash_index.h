@@ -0,0 +1,298 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// An index which maps an integer key to a value, implemented as a hash table
+// with open addressing.
+//
+// The rows of the index are stored in a single block of memory, and the lookup
+// of a key probes consecutive rows starting from the one its hash points to
+// (linear probing). The removal shifts the following rows of the probe
+// sequence back, so there are no tombstones and the lookup cost only depends
+// on the number of keys in the index.
+//
+// The block is re-allocated when the index grows, so pointers to the values
+// stored in the index are invalidated by insertion and removal of keys.
+//
+// Optimized for:
+//
+//   - Lookup of a key, regardless of the order in which keys were inserted.
+//
+//   - Small trivially copyable values, such as pointers to rows of a table.
+//
+// NOTE: This is an experimental API, it might get changed in the future.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+template <class Key, class T, template <class> class Allocator = std::allocator>
+class HashIndex {
+  static_assert(std::is_integral_v<Key>);
+
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using size_type = size_t;
+
+  HashIndex() = default;
+
+  ~HashIndex() { FreeRows(); }
+
+  HashIndex(HashIndex&& other) noexcept { MoveFrom(other); }
+
+  auto operator=(HashIndex&& other) noexcept -> HashIndex& {
+    if (this == &other) {
+      return *this;
+    }
+    FreeRows();
+    MoveFrom(other);
+    return *this;
+  }
+
+  // Copying of the index is not used, so it is not implemented.
+  HashIndex(const HashIndex& other) = delete;
+  auto operator=(const HashIndex& other) -> HashIndex& = delete;
+
+  // Get the number of keys in the index.
+  inline auto GetSize() const -> size_type { return num_keys_; }
+
+  // True if there are no keys in the index.
+  inline auto IsEmpty() const -> bool { return num_keys_ == 0; }
+
+  // Remove all keys from the index.
+  // Keeps the memory allocated for the rows, so that the index can be filled
+  // again without re-allocation.
+  void Clear() {
+    for (size_t i = 0; i < num_rows_; ++i) {
+      rows_[i].is_used = false;
+    }
+    num_keys_ = 0;
+  }
+
+  // Lookup value of the given key.
+  // Returns nullptr if the key does not exist in the index.
+  inline auto Lookup(const Key& key) -> T* {
+    const size_t index = FindRowIndex(key);
+    return index == kNotFound ? nullptr : &rows_[index].value;
+  }
+  inline auto Lookup(const Key& key) const -> const T* {
+    const size_t index = FindRowIndex(key);
+    return index == kNotFound ? nullptr : &rows_[index].value;
+  }
+
+  // Insert the key with the given value.
+  // If the key already exists in the index its value is kept unchanged and
+  // false is returned.
+  auto Insert(const Key& key, const T& value) -> bool {
+    ReserveForInsert();
+
+    Row& row = rows_[FindRowIndexForInsert(key)];
+    if (row.is_used) {
+      return false;
+    }
+
+    row.key = key;
+    row.value = value;
+    row.is_used = true;
+    ++num_keys_;
+
+    return true;
+  }
+
+  // Insert the key with the given value, or assign the value of the existing
+  // key.
+  void InsertOrAssign(const Key& key, const T& value) {
+    ReserveForInsert();
+
+    Row& row = rows_[FindRowIndexForInsert(key)];
+    if (!row.is_used) {
+      row.key = key;
+      row.is_used = true;
+      ++num_keys_;
+    }
+    row.value = value;
+  }
+
+  // Remove the key from the index.
+  // Returns false if the key does not exist in the index.
+  auto Erase(const Key& key) -> bool {
+    size_t index = FindRowIndex(key);
+    if (index == kNotFound) {
+      return false;
+    }
+
+    // Shift the rows of the probe sequence which follows the removed row back,
+    // so that their lookup does not stop at the emptied row.
+    const size_t mask = num_rows_ - 1;
+    size_t next_index = (index + 1) & mask;
+    while (rows_[next_index].is_used) {
+      const size_t home_index = GetHomeRowIndex(rows_[next_index].key);
+
+      // The row can only be moved if its home is not between the emptied row
+      // and the row itself (cyclically).
+      if (((next_index - home_index) & mask) >=
+          ((next_index - index) & mask)) {
+        rows_[index] = std::move(rows_[next_index]);
+        index = next_index;
+      }
+
+      next_index = (next_index + 1) & mask;
+    }
+
+    rows_[index].is_used = false;
+    --num_keys_;
+
+    return true;
+  }
+
+ private:
+  struct Row {
+    Key key{};
+    T value{};
+    bool is_used{false};
+  };
+
+  // The number of rows allocated when the first key is inserted.
+  static constexpr size_t kMinNumRows = 16;
+
+  static constexpr size_t kNotFound = ~size_t(0);
+
+  // Get index of the row which the probe sequence of the key starts at.
+  //
+  // The multiplicative (Fibonacci) hashing mixes all bits of the key into the
+  // high bits of the product, so the sequential keys are spread over the rows.
+  inline auto GetHomeRowIndex(const Key& key) const -> size_t {
+    const uint64_t hash =
+        uint64_t(key) * uint64_t(0x9e3779b97f4a7c15ULL);
+    return size_t(hash >> hash_shift_);
+  }
+
+  // Get index of the row which stores the given key, or kNotFound if the key
+  // does not exist in the index.
+  inline auto FindRowIndex(const Key& key) const -> size_t {
+    if (num_keys_ == 0) {
+      return kNotFound;
+    }
+
+    const size_t mask = num_rows_ - 1;
+    for (size_t index = GetHomeRowIndex(key);; index = (index + 1) & mask) {
+      const Row& row = rows_[index];
+      if (!row.is_used) {
+        return kNotFound;
+      }
+      if (row.key == key) {
+        return index;
+      }
+    }
+  }
+
+  // Get index of the row which stores the given key, or of the unused row at
+  // which the key is to be inserted.
+  // The index is expected to have at least one unused row.
+  inline auto FindRowIndexForInsert(const Key& key) const -> size_t {
+    const size_t mask = num_rows_ - 1;
+    for (size_t index = GetHomeRowIndex(key);; index = (index + 1) & mask) {
+      const Row& row = rows_[index];
+      if (!row.is_used || row.key == key) {
+        return index;
+      }
+    }
+  }
+
+  // Make sure the load factor stays below 3/4 after a key is inserted.
+  void ReserveForInsert() {
+    if ((num_keys_ + 1) * 4 <= num_rows_ * 3) {
+      return;
+    }
+    Rehash(num_rows_ == 0 ? kMinNumRows : num_rows_ * 2);
+  }
+
+  // Re-allocate the rows to the new number of rows, which is a power of two,
+  // and re-insert all keys.
+  void Rehash(const size_t new_num_rows) {
+    assert((new_num_rows & (new_num_rows - 1)) == 0);
+
+    Row* old_rows = rows_;
+    const size_t old_num_rows = num_rows_;
+
+    rows_ = row_allocator_.allocate(new_num_rows);
+    std::uninitialized_value_construct_n(rows_, new_num_rows);
+    num_rows_ = new_num_rows;
+
+    hash_shift_ = 64;
+    for (size_t n = new_num_rows; n > 1; n >>= 1) {
+      --hash_shift_;
+    }
+
+    for (size_t i = 0; i < old_num_rows; ++i) {
+      Row& old_row = old_rows[i];
+      if (old_row.is_used) {
+        rows_[FindRowIndexForInsert(old_row.key)] = std::move(old_row);
+      }
+    }
+
+    if (old_rows != nullptr) {
+      std::destroy_n(old_rows, old_num_rows);
+      row_allocator_.deallocate(old_rows, old_num_rows);
+    }
+  }
+
+  // Destroy the rows and deallocate their memory.
+  void FreeRows() {
+    if (rows_ == nullptr) {
+      return;
+    }
+
+    std::destroy_n(rows_, num_rows_);
+    row_allocator_.deallocate(rows_, num_rows_);
+
+    rows_ = nullptr;
+    num_rows_ = 0;
+    num_keys_ = 0;
+  }
+
+  // Take the storage of the other index, leaving it empty.
+  // The index is expected to have no storage allocated.
+  void MoveFrom(HashIndex& other) {
+    assert(rows_ == nullptr);
+
+    rows_ = other.rows_;
+    num_rows_ = other.num_rows_;
+    num_keys_ = other.num_keys_;
+    hash_shift_ = other.hash_shift_;
+
+    other.rows_ = nullptr;
+    other.num_rows_ = 0;
+    other.num_keys_ = 0;
+  }
+
+  Allocator<Row> row_allocator_;
+
+  // Rows of the hash table. The number of rows is a power of two.
+  Row* rows_{nullptr};
+  size_t num_rows_{0};
+
+  // The number of used rows.
+  size_t num_keys_{0};
+
+  // Shift of the 64-bit hash which gives the index of the home row of a key.
+  int hash_shift_{64};
+};
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
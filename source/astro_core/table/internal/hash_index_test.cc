@@ -0,0 +1,145 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/table/hash_index.h"
+
+#include <map>
+#include <random>
+#include <utility>
+
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+
+TEST(HashIndex, Empty) {
+  HashIndex<int, int> index;
+
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_EQ(index.GetSize(), 0);
+  EXPECT_EQ(index.Lookup(1), nullptr);
+  EXPECT_FALSE(index.Erase(1));
+}
+
+TEST(HashIndex, Insert) {
+  HashIndex<int, int> index;
+
+  EXPECT_TRUE(index.Insert(25338, 1));
+  EXPECT_TRUE(index.Insert(-1, 2));
+  EXPECT_TRUE(index.Insert(339999, 3));
+
+  // Existing key keeps its value.
+  EXPECT_FALSE(index.Insert(25338, 4));
+
+  EXPECT_EQ(index.GetSize(), 3);
+
+  ASSERT_NE(index.Lookup(25338), nullptr);
+  EXPECT_EQ(*index.Lookup(25338), 1);
+  ASSERT_NE(index.Lookup(-1), nullptr);
+  EXPECT_EQ(*index.Lookup(-1), 2);
+  ASSERT_NE(index.Lookup(339999), nullptr);
+  EXPECT_EQ(*index.Lookup(339999), 3);
+
+  EXPECT_EQ(index.Lookup(0), nullptr);
+
+  index.InsertOrAssign(25338, 5);
+  index.InsertOrAssign(28654, 6);
+  EXPECT_EQ(index.GetSize(), 4);
+  EXPECT_EQ(*index.Lookup(25338), 5);
+  EXPECT_EQ(*index.Lookup(28654), 6);
+
+  // Modification via the pointer.
+  *index.Lookup(28654) = 7;
+  EXPECT_EQ(*std::as_const(index).Lookup(28654), 7);
+}
+
+TEST(HashIndex, Erase) {
+  HashIndex<int, int> index;
+
+  for (int i = 0; i < 1000; ++i) {
+    index.Insert(i, i * 2);
+  }
+
+  for (int i = 0; i < 1000; i += 3) {
+    EXPECT_TRUE(index.Erase(i));
+  }
+  EXPECT_FALSE(index.Erase(0));
+
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 == 0) {
+      EXPECT_EQ(index.Lookup(i), nullptr);
+    } else {
+      ASSERT_NE(index.Lookup(i), nullptr) << i;
+      EXPECT_EQ(*index.Lookup(i), i * 2);
+    }
+  }
+}
+
+TEST(HashIndex, Clear) {
+  HashIndex<int, int> index;
+
+  for (int i = 0; i < 100; ++i) {
+    index.Insert(i, i);
+  }
+
+  index.Clear();
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_EQ(index.Lookup(10), nullptr);
+
+  EXPECT_TRUE(index.Insert(10, 20));
+  EXPECT_EQ(*index.Lookup(10), 20);
+}
+
+TEST(HashIndex, Move) {
+  HashIndex<int, int> index;
+  index.Insert(1, 2);
+
+  HashIndex<int, int> other(std::move(index));
+  EXPECT_EQ(*other.Lookup(1), 2);
+
+  index = std::move(other);
+  EXPECT_EQ(*index.Lookup(1), 2);
+  EXPECT_EQ(index.GetSize(), 1);
+}
+
+// Compare with the std::map for a random sequence of operations, which covers
+// the removal of keys from the middle of the probe sequences.
+TEST(HashIndex, Random) {
+  HashIndex<int, int> index;
+  std::map<int, int> reference;
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> key_distribution(0, 2000);
+
+  for (int i = 0; i < 20000; ++i) {
+    const int key = key_distribution(rng);
+
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(index.Erase(key), reference.erase(key) == 1);
+    } else {
+      index.InsertOrAssign(key, i);
+      reference[key] = i;
+    }
+  }
+
+  EXPECT_EQ(index.GetSize(), reference.size());
+
+  for (int key = 0; key <= 2000; ++key) {
+    const auto it = reference.find(key);
+    const int* value = index.Lookup(key);
+    if (it == reference.end()) {
+      EXPECT_EQ(value, nullptr);
+    } else {
+      ASSERT_NE(value, nullptr);
+      EXPECT_EQ(*value, it->second);
+    }
+  }
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,103 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/table/paged_table.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "astro_core/benchmark/benchmark.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace experimental {
+namespace {
+
+using benchmark::DoNotOptimize;
+
+// Typical row of a lookup table: a key followed with values.
+struct Row {
+  double key;
+  double values[3];
+};
+
+constexpr int kNumRows = 100'000;
+
+template <class Table>
+void FillTable(Table& table) {
+  for (int i = 0; i < kNumRows; ++i) {
+    table.push_back({.key = double(i) * 0.5, .values = {1, 2, 3}});
+  }
+}
+
+// Binary search of keys spread over the entire table.
+template <class Table>
+void BenchmarkLowerBound(benchmark::State& state, const Table& table) {
+  int i = 0;
+  for (auto _ : state) {
+    const double key = double((i++ * 7919) % kNumRows) * 0.5;
+    DoNotOptimize(*std::lower_bound(
+        table.begin(),
+        table.end(),
+        key,
+        [](const Row& row, const double value) { return row.key < value; }));
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+// Access to rows at random indices.
+template <class Table>
+void BenchmarkRandomAccess(benchmark::State& state, const Table& table) {
+  int i = 0;
+  for (auto _ : state) {
+    DoNotOptimize(table[(i++ * 7919) % kNumRows]);
+  }
+  state.SetNumItemsProcessed(state.GetNumIterations());
+}
+
+}  // namespace
+
+BENCHMARK(PagedTable, LowerBound_Paged) {
+  PagedTable<Row, 32> table;
+  FillTable(table);
+  BenchmarkLowerBound(state, table);
+}
+
+BENCHMARK(PagedTable, LowerBound_Frozen) {
+  PagedTable<Row, 32> table;
+  FillTable(table);
+  table.Freeze();
+  BenchmarkLowerBound(state, table);
+}
+
+BENCHMARK(PagedTable, LowerBound_Vector) {
+  std::vector<Row> table;
+  FillTable(table);
+  BenchmarkLowerBound(state, table);
+}
+
+BENCHMARK(PagedTable, RandomAccess_Paged) {
+  PagedTable<Row, 32> table;
+  FillTable(table);
+  BenchmarkRandomAccess(state, table);
+}
+
+BENCHMARK(PagedTable, RandomAccess_Frozen) {
+  PagedTable<Row, 32> table;
+  FillTable(table);
+  table.Freeze();
+  BenchmarkRandomAccess(state, table);
+}
+
+BENCHMARK(PagedTable, RandomAccess_Vector) {
+  std::vector<Row> table;
+  FillTable(table);
+  BenchmarkRandomAccess(state, table);
+}
+
+}  // namespace experimental
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "astro_core/base/exception.h"
 #include "astro_core/unittest/mock.h"
@@ -16,10 +17,6 @@
 // This is used to align the behavior of iterators and algorithms with the STL.
 #define USE_STD_VECTOR_REFERENCE 0
 
-#if USE_STD_VECTOR_REFERENCE
-#  include <vector>
-#endif
-
 // Note on iterator comparison:
 //
 // It seems that in MSVC the order of macro evaluation somehow matches the
@@ -448,10 +445,148 @@ TEST(PagedTable, Clear) {
       table, ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
 
 #if !USE_STD_VECTOR_REFERENCE
-  EXPECT_EQ(global_num_allocations, 1);
+  // A single page and the page directory, both re-used after the clear.
+  EXPECT_EQ(global_num_allocations, 2);
 #endif
 }
 
+TEST(PagedTable, RandomAccess) {
+  PagedTable<int, 16> table;
+  std::vector<int> reference;
+
+  for (int i = 0; i < 1000; ++i) {
+    table.push_back(i * 3);
+    reference.push_back(i * 3);
+  }
+
+  for (size_t i = 0; i < reference.size(); i += 7) {
+    EXPECT_EQ(table[i], reference[i]);
+    EXPECT_EQ(*(table.begin() + i), reference[i]);
+    EXPECT_EQ(table.begin()[i], reference[i]);
+    EXPECT_EQ(table.end() - (table.begin() + i), reference.size() - i);
+  }
+
+  for (int value = -1; value < 3001; value += 5) {
+    const auto it = std::lower_bound(table.begin(), table.end(), value);
+    const auto reference_it =
+        std::lower_bound(reference.begin(), reference.end(), value);
+    EXPECT_EQ(it - table.begin(), reference_it - reference.begin());
+  }
+}
+
+#if !USE_STD_VECTOR_REFERENCE
+
+TEST(PagedTable, Freeze) {
+  PagedTable<Row, 16> table;
+
+  EXPECT_FALSE(table.IsFrozen());
+
+  // Freezing an empty table is a no-op.
+  table.Freeze();
+  EXPECT_FALSE(table.IsFrozen());
+
+  for (int i = 0; i < 100; ++i) {
+    table.emplace_back(i, i * 2);
+  }
+
+  table.Freeze();
+  EXPECT_TRUE(table.IsFrozen());
+  EXPECT_EQ(table.size(), 100);
+
+  // The rows are stored contiguously.
+  EXPECT_EQ(&table[99] - &table[0], 99);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(table[i], Row(i, i * 2));
+    EXPECT_EQ(table.begin()[i], Row(i, i * 2));
+  }
+  EXPECT_EQ(table.front(), Row(0, 0));
+  EXPECT_EQ(table.back(), Row(99, 198));
+
+  const auto it = std::lower_bound(
+      table.begin(), table.end(), 42, [](const Row& row, const int value) {
+        return row.field_a < value;
+      });
+  EXPECT_EQ(it - table.begin(), 42);
+
+  // Freezing a frozen table is a no-op.
+  table.Freeze();
+  EXPECT_TRUE(table.IsFrozen());
+  EXPECT_EQ(table[42], Row(42, 84));
+}
+
+TEST(PagedTable, ModifyFrozen) {
+  {
+    PagedTable<int, 16> table;
+    for (int i = 0; i < 20; ++i) {
+      table.push_back(i);
+    }
+    table.Freeze();
+
+    table.push_back(20);
+    EXPECT_FALSE(table.IsFrozen());
+    EXPECT_EQ(table.size(), 21);
+    for (int i = 0; i < 21; ++i) {
+      EXPECT_EQ(table[i], i);
+    }
+  }
+
+  {
+    PagedTable<int, 4> table;
+    for (int i = 0; i < 6; ++i) {
+      table.push_back(i);
+    }
+
+    table.Freeze();
+    table.insert(table.begin() + 1, 10);
+    EXPECT_FALSE(table.IsFrozen());
+    EXPECT_THAT(table, ElementsAre(0, 10, 1, 2, 3, 4, 5));
+
+    table.Freeze();
+    table.erase(table.begin() + 2);
+    EXPECT_FALSE(table.IsFrozen());
+    EXPECT_THAT(table, ElementsAre(0, 10, 2, 3, 4, 5));
+
+    table.Freeze();
+    table.pop_back();
+    EXPECT_FALSE(table.IsFrozen());
+    EXPECT_THAT(table, ElementsAre(0, 10, 2, 3, 4));
+
+    table.Freeze();
+    table.clear();
+    EXPECT_FALSE(table.IsFrozen());
+    EXPECT_TRUE(table.empty());
+
+    table.push_back(1);
+    EXPECT_THAT(table, ElementsAre(1));
+  }
+}
+
+TEST(PagedTable, MoveFrozen) {
+  PagedTable<std::string, 4> table;
+  for (int i = 0; i < 10; ++i) {
+    table.push_back(std::to_string(i));
+  }
+  table.Freeze();
+
+  PagedTable<std::string, 4> other(std::move(table));
+  EXPECT_TRUE(other.IsFrozen());
+  EXPECT_EQ(other.size(), 10);
+  EXPECT_EQ(other[7], "7");
+
+  EXPECT_FALSE(table.IsFrozen());
+  EXPECT_TRUE(table.empty());
+
+  PagedTable<std::string, 4> assigned;
+  assigned.push_back("a");
+  assigned = std::move(other);
+  EXPECT_TRUE(assigned.IsFrozen());
+  EXPECT_EQ(assigned.size(), 10);
+  EXPECT_EQ(assigned.back(), "9");
+}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Maintenance.
 
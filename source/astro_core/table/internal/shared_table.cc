@@ -0,0 +1,94 @@
+// Copyright (c) 2022 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/table/shared_table.h"
+
+#include <algorithm>
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+namespace shared_table_internal {
+
+constinit thread_local ReaderState reader_state;
+
+// Start with a non-zero epoch, as zero is used to indicate a thread which is
+// not inside of a read section.
+std::atomic<uint64_t> global_epoch{1};
+
+namespace {
+
+// Head of the list of all allocated reader slots.
+std::atomic<ReaderSlot*> reader_slots{nullptr};
+
+// Release the reader slot of the thread when the thread finishes.
+class ReaderSlotReleaser {
+ public:
+  ~ReaderSlotReleaser() {
+    ReaderState& state = reader_state;
+    if (!state.slot) {
+      return;
+    }
+
+    state.slot->epoch.store(0, std::memory_order_relaxed);
+    state.slot->is_used.store(false, std::memory_order_release);
+    state.slot = nullptr;
+  }
+};
+
+}  // namespace
+
+auto AcquireReaderSlot() -> ReaderSlot* {
+  thread_local ReaderSlotReleaser releaser;
+
+  for (ReaderSlot* slot = reader_slots.load(std::memory_order_acquire); slot;
+       slot = slot->next) {
+    bool is_used = false;
+    if (slot->is_used.compare_exchange_strong(is_used,
+                                              true,
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed)) {
+      return slot;
+    }
+  }
+
+  ReaderSlot* slot = new ReaderSlot();
+  slot->is_used.store(true, std::memory_order_relaxed);
+
+  slot->next = reader_slots.load(std::memory_order_relaxed);
+  while (!reader_slots.compare_exchange_weak(slot->next,
+                                             slot,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+  }
+
+  return slot;
+}
+
+auto AdvanceEpoch() -> uint64_t {
+  return global_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+}
+
+auto GetMinReaderEpoch() -> uint64_t {
+  // Pairs with the fence in EnterReadSection(): either the epoch published by
+  // a reader is visible here, or the reader sees the new table pointer.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  uint64_t min_epoch = UINT64_MAX;
+  for (const ReaderSlot* slot = reader_slots.load(std::memory_order_acquire);
+       slot;
+       slot = slot->next) {
+    const uint64_t epoch = slot->epoch.load(std::memory_order_acquire);
+    if (epoch != 0) {
+      min_epoch = std::min(min_epoch, epoch);
+    }
+  }
+
+  return min_epoch;
+}
+
+}  // namespace shared_table_internal
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
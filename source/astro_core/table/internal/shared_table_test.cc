@@ -4,6 +4,11 @@
 
 #include "astro_core/table/shared_table.h"
 
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "astro_core/unittest/test.h"
 
 namespace astro_core {
@@ -35,4 +40,147 @@ TEST(SharedTable, Basic) {
   }
 }
 
+namespace {
+
+// Table which counts the number of alive instances.
+class CountedTable {
+ public:
+  explicit CountedTable(std::atomic<int>& num_alive, const int property)
+      : num_alive_(&num_alive), property_(property) {
+    ++*num_alive_;
+  }
+
+  CountedTable(CountedTable&& other) noexcept
+      : num_alive_(other.num_alive_), property_(other.property_) {
+    ++*num_alive_;
+  }
+
+  ~CountedTable() { --*num_alive_; }
+
+  auto operator=(CountedTable&& other) -> CountedTable& = delete;
+
+  auto GetProperty() const -> int { return property_; }
+
+ private:
+  std::atomic<int>* num_alive_;
+  int property_;
+};
+
+}  // namespace
+
+TEST(SharedTable, ReplaceWhileLoaded) {
+  std::atomic<int> num_alive{0};
+
+  {
+    SharedTable<CountedTable> shared_table;
+
+    shared_table.Set(CountedTable(num_alive, 1));
+    EXPECT_EQ(num_alive, 1);
+
+    {
+      const SharedTable<CountedTable>::LocalTable local_table =
+          shared_table.Load();
+
+      // The loaded table is kept alive while it is being accessed.
+      shared_table.Set(CountedTable(num_alive, 2));
+      EXPECT_EQ(num_alive, 2);
+      EXPECT_EQ(local_table->GetProperty(), 1);
+
+      // The new table is visible to the following loads.
+      EXPECT_EQ(shared_table.Load()->GetProperty(), 2);
+    }
+
+    // Nothing accesses the replaced tables anymore.
+    shared_table.Set(CountedTable(num_alive, 3));
+    EXPECT_EQ(num_alive, 1);
+    EXPECT_EQ(shared_table.Load()->GetProperty(), 3);
+  }
+
+  EXPECT_EQ(num_alive, 0);
+}
+
+TEST(SharedTable, Pin) {
+  std::atomic<int> num_alive{0};
+
+  SharedTable<CountedTable> shared_table;
+  shared_table.Set(CountedTable(num_alive, 1));
+
+  {
+    const SharedTablePin pin;
+
+    const int property = shared_table.Load()->GetProperty();
+    EXPECT_EQ(property, 1);
+
+    // The table loaded while the thread is pinned is kept alive until the pin
+    // is destroyed, even if the LocalTable is gone.
+    shared_table.Set(CountedTable(num_alive, 2));
+    EXPECT_EQ(num_alive, 2);
+
+    // Nested pin.
+    {
+      const SharedTablePin nested_pin;
+      EXPECT_EQ(shared_table.Load()->GetProperty(), 2);
+    }
+
+    shared_table.Set(CountedTable(num_alive, 3));
+    EXPECT_EQ(num_alive, 3);
+  }
+
+  shared_table.Set(CountedTable(num_alive, 4));
+  EXPECT_EQ(num_alive, 1);
+}
+
+TEST(SharedTable, ConcurrentReadAndReplace) {
+  constexpr int kNumReaders = 4;
+  constexpr int kNumReplacements = 1000;
+
+  std::atomic<int> num_alive{0};
+
+  SharedTable<CountedTable> shared_table;
+  shared_table.Set(CountedTable(num_alive, 0));
+
+  std::atomic<bool> is_done{false};
+  std::atomic<int> num_errors{0};
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kNumReaders; ++i) {
+    readers.emplace_back([&, i]() {
+      int last_property = 0;
+      while (!is_done.load(std::memory_order_relaxed)) {
+        // Alternate between pinned and non-pinned access.
+        std::optional<SharedTablePin> pin;
+        if (i % 2) {
+          pin.emplace();
+        }
+
+        for (int j = 0; j < 16; ++j) {
+          const SharedTable<CountedTable>::LocalTable local_table =
+              shared_table.Load();
+          const int property = local_table->GetProperty();
+          if (property < last_property || property > kNumReplacements) {
+            ++num_errors;
+          }
+          last_property = property;
+        }
+      }
+    });
+  }
+
+  for (int i = 1; i <= kNumReplacements; ++i) {
+    shared_table.Set(CountedTable(num_alive, i));
+  }
+
+  is_done = true;
+  for (std::thread& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(num_errors, 0);
+
+  // Once all readers are gone the replaced tables are reclaimed by the next
+  // replacement.
+  shared_table.Set(CountedTable(num_alive, kNumReplacements));
+  EXPECT_EQ(num_alive, 1);
+}
+
 }  // namespace astro_core
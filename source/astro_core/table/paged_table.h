@@ -3,13 +3,23 @@
 // SPDX-License-Identifier: MIT
 
 // A storage for table which stores data in pages of a fixed size. The pages are
-// organized in a list structure.
+// organized in a list structure, and are indexed by a page directory.
 //
 // On an API level this storage is very close to std::vector<>: it supports
 // random access iterator, which makes it possible to use algorithms from the
 // standard library. The benefit of using this data structure over the vector
 // is that when the table needs to grow it does not need to re-allocate the
-// entire storage.
+// entire storage: references to the rows stay valid when rows are added.
+//
+// All pages except the last one are full, so the row at the given index is
+// found in constant time via the page directory. This makes random element
+// access and iterator arithmetic O(1), and algorithms like std::lower_bound()
+// logarithmic.
+//
+// A table which is not modified after it has been created can be frozen. The
+// frozen table stores all rows in a single contiguous block of memory, which
+// makes lookups more cache-friendly. Modification of a frozen table moves the
+// rows back to pages.
 //
 // Optimized for:
 //
@@ -17,12 +27,12 @@
 //
 //   - Re-creation from scratch.
 //
+//   - Random element access.
+//
 // Not optimized for:
 //
 //   - Removal and insertion of rows.
 //
-//   - Random element access.
-//
 //   NOTE: While the table is not optimized for those operations, it does not
 //   mean they are impossible. It only means that the computational complexity
 //   is not very good.
@@ -39,6 +49,7 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "astro_core/base/exception.h"
 #include "astro_core/base/linked_list.h"
@@ -71,17 +82,15 @@ class PagedTable {
   //
   // Templated to de-duplicate implementation for regular and constant iterator.
   //
-  // The iterator is provided with the page and row index within the page to the
-  // element it corresponds to, as well as the global index within the table.
+  // The iterator is provided with the table and the index of the row within the
+  // table. The row is accessed via the page directory of the table, which makes
+  // all iterator arithmetic O(1).
   //
-  // Having the global index makes it possible to compare two iterators.
-  // having page and index with the page allows for a quick access of the row
-  // from the iterator.
-  //
-  // The end iterator is expected to be the last page with a row index past the
-  // actual rows of the page. This allows to go to the previous iterator from
-  // the end iterator. As in, `std::prev(table.end())` will point to the same
-  // element as `table.back()`.
+  // The iterator stays valid when rows are added to the table, same as
+  // references to the rows. The end iterator is the index past the last row of
+  // the table. This allows to go to the previous iterator from the end
+  // iterator. As in, `std::prev(table.end())` will point to the same element
+  // as `table.back()`.
   template <class ValueType>
   class Iterator {
    public:
@@ -94,12 +103,10 @@ class PagedTable {
     ////////////////////////////////////////////////////////////////////////////
     // Constructor.
 
-    Iterator(Page* page,
-             const size_t page_row_index,
-             const size_t table_row_index)
-        : page_(page),
-          page_row_index_(page_row_index),
-          table_row_index_(table_row_index) {}
+    Iterator() = default;
+
+    Iterator(const PagedTable* table, const size_t table_row_index)
+        : table_(table), table_row_index_(table_row_index) {}
 
     Iterator(const Iterator& other) = default;
     Iterator(Iterator&& other) noexcept = default;
@@ -110,9 +117,7 @@ class PagedTable {
                   std::is_const_v<ValueType> &&
                   std::is_same_v<OtherValueType, std::remove_cv_t<ValueType>>>>
     Iterator(const Iterator<OtherValueType>& other)
-        : page_(other.page_),
-          page_row_index_(other.page_row_index_),
-          table_row_index_(other.table_row_index_) {}
+        : table_(other.table_), table_row_index_(other.table_row_index_) {}
 
     ////////////////////////////////////////////////////////////////////////////
     // Assignment.
@@ -160,18 +165,8 @@ class PagedTable {
     }
 
     // Prefix.
-    inline auto operator++() -> Iterator {
-      assert(page_ != nullptr);
-
-      ++page_row_index_;
+    inline auto operator++() -> Iterator& {
       ++table_row_index_;
-
-      // Wrap to the next page, unless it is the last page.
-      if (page_row_index_ == page_->size() && page_->next) {
-        page_ = page_->next;
-        page_row_index_ = 0;
-      }
-
       return *this;
     }
 
@@ -183,17 +178,8 @@ class PagedTable {
     }
 
     // Prefix.
-    inline auto operator--() -> Iterator {
-      assert(page_ != nullptr);
-
-      if (page_row_index_ == 0) {
-        page_ = page_->prev;
-        page_row_index_ = page_->size();
-      }
-
-      --page_row_index_;
+    inline auto operator--() -> Iterator& {
       --table_row_index_;
-
       return *this;
     }
 
@@ -203,13 +189,12 @@ class PagedTable {
       result += rhs;
       return result;
     }
+    friend inline auto operator+(const difference_type lhs, const Iterator& rhs)
+        -> Iterator {
+      return rhs + lhs;
+    }
     inline auto operator+=(const difference_type rhs) -> Iterator& {
-      if (rhs > 0) {
-        AdvanceForward(rhs);
-      } else if (rhs < 0) {
-        AdvanceBackward(-rhs);
-      }
-
+      table_row_index_ += rhs;
       return *this;
     }
 
@@ -220,12 +205,7 @@ class PagedTable {
       return result;
     }
     inline auto operator-=(const difference_type rhs) -> Iterator& {
-      if (rhs > 0) {
-        AdvanceBackward(rhs);
-      } else if (rhs < 0) {
-        AdvanceForward(-rhs);
-      }
-
+      table_row_index_ -= rhs;
       return *this;
     }
 
@@ -242,10 +222,13 @@ class PagedTable {
     // Access.
 
     inline auto operator*() const -> reference {
-      return (*page_)[page_row_index_];
+      return table_->GetRow(table_row_index_);
     }
     inline auto operator->() const -> pointer {
-      return &(*page_)[page_row_index_];
+      return &table_->GetRow(table_row_index_);
+    }
+    inline auto operator[](const difference_type offset) const -> reference {
+      return table_->GetRow(table_row_index_ + offset);
     }
 
    private:
@@ -256,38 +239,8 @@ class PagedTable {
     // iterator in constructor.
     friend Iterator<const ValueType>;
 
-    void AdvanceForward(const difference_type count) {
-      assert(page_ != nullptr);
-
-      // Advance both indices.
-      page_row_index_ += count;
-      table_row_index_ += count;
-
-      // Wrap to the next pages util the page index is within the page size.
-      // Don't loop past the last page. This way advancing will move from the
-      // last element to the proper end() marker.
-      while (page_row_index_ >= page_->size() && page_->next) {
-        page_row_index_ -= page_->size();
-        page_ = page_->next;
-      }
-    }
-
-    void AdvanceBackward(const difference_type count) {
-      while (count > page_row_index_) {
-        page_ = page_->prev;
-        assert(page_ != nullptr);
-
-        const size_t page_size = page_->size();
-        page_row_index_ += page_size;
-      }
-
-      page_row_index_ -= count;
-      table_row_index_ -= count;
-    }
-
-    // Page and the index within the page which corresponds to this iterator.
-    Page* page_{nullptr};
-    size_t page_row_index_{0};
+    // Table to which the iterator belongs.
+    const PagedTable* table_{nullptr};
 
     // The index of the row within the table.
     size_t table_row_index_{0};
@@ -318,6 +271,7 @@ class PagedTable {
   PagedTable() = default;
 
   ~PagedTable() {
+    FreeFrozenRows();
     FreePageList(pages_);
     DeallocatePageList(allocated_pages_);
   }
@@ -327,22 +281,17 @@ class PagedTable {
   PagedTable(const PagedTable& other) = delete;
   auto operator=(const PagedTable& other) -> PagedTable& = delete;
 
-  PagedTable(PagedTable&& other) noexcept
-      : pages_(other.pages_), num_rows_(other.num_rows_) {
-    other.pages_.Clear();
-    other.num_rows_ = 0;
-  }
+  // The iterators of the moved table are invalidated, but the references to its
+  // rows are not.
+  PagedTable(PagedTable&& other) noexcept { MoveFrom(other); }
 
   auto operator=(PagedTable&& other) -> PagedTable& {
     if (this == &other) {
       return *this;
     }
 
-    pages_ = other.pages_;
-    num_rows_ = other.num_rows_;
-
-    other.pages_.Clear();
-    other.num_rows_ = 0;
+    clear();
+    MoveFrom(other);
 
     return *this;
   }
@@ -358,22 +307,23 @@ class PagedTable {
     if (index >= size()) {
       ThrowOrAbort<std::out_of_range>("index >= size()");
     }
-    return *(begin() + index);
+    return GetRow(index);
   }
   constexpr auto at(const size_t index) const -> const RowType& {
     if (index >= size()) {
       ThrowOrAbort<std::out_of_range>("index >= size()");
     }
-    return *(begin() + index);
+    return GetRow(index);
   }
 
   // Returns a reference to the row at specified index.
   // No bounds checking is performed. If pos >= size(), the behavior is
+  // undefined.
   constexpr auto operator[](const size_t index) -> reference {
-    return *(begin() + index);
+    return GetRow(index);
   }
   constexpr auto operator[](const size_t index) const -> const_reference {
-    return *(begin() + index);
+    return GetRow(index);
   }
 
   // Access the front (the oldest) element of the buffer.
@@ -381,11 +331,11 @@ class PagedTable {
   // Calling front on an empty buffer is undefined.
   inline auto front() -> RowType& {
     assert(!empty());
-    return GetHeadPage()->front();
+    return GetRow(0);
   }
   inline auto front() const -> const RowType& {
     assert(!empty());
-    return GetHeadPage()->front();
+    return GetRow(0);
   }
 
   // Access the back (the newest) element of the buffer.
@@ -393,11 +343,11 @@ class PagedTable {
   // Calling back on an empty buffer is undefined.
   inline auto back() -> RowType& {
     assert(!empty());
-    return GetTailPage()->back();
+    return GetRow(size() - 1);
   }
   inline auto back() const -> const RowType& {
     assert(!empty());
-    return GetTailPage()->back();
+    return GetRow(size() - 1);
   }
 
   //////////////////////////////////////////////////////////////////////////////
@@ -408,20 +358,16 @@ class PagedTable {
   // of *this.
   // cbegin() always returns a constant iterator. It is equivalent to
   // const_cast<const PagedTable&>(*this).begin().
-  inline auto begin() -> iterator { return iterator(GetHeadPage(), 0, 0); }
+  inline auto begin() -> iterator { return iterator(this, 0); }
   inline auto begin() const -> const_iterator {
-    return const_iterator(GetHeadPage(), 0, 0);
+    return const_iterator(this, 0);
   }
   constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
 
   // Returns an iterator to the row following the last row of the table.
-  inline auto end() -> iterator {
-    Page* tail_page = GetTailPage();
-    return iterator(tail_page, tail_page ? tail_page->size() : 0, size());
-  }
+  inline auto end() -> iterator { return iterator(this, size()); }
   inline auto end() const -> const_iterator {
-    Page* tail_page = GetTailPage();
-    return const_iterator(tail_page, tail_page ? tail_page->size() : 0, size());
+    return const_iterator(this, size());
   }
   constexpr auto cend() const noexcept -> const_iterator { return end(); }
 
@@ -461,11 +407,55 @@ class PagedTable {
   // Check whether the container is empty.
   inline auto empty() const -> bool { return size() == 0; }
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Storage mode.
+
+  // Move all rows into a single contiguous block of memory, and release the
+  // memory of the pages.
+  //
+  // This is intended for tables which are not modified after they have been
+  // created, such as lookup tables. The rows of the frozen table are accessed
+  // in the same way as the rows of a paged table, but are more cache-friendly.
+  //
+  // Invalidates all references to the rows of the table.
+  void Freeze() {
+    if (IsFrozen() || empty()) {
+      return;
+    }
+
+    const size_t num_rows = num_rows_;
+
+    RowType* rows = row_allocator_.allocate(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+      std::construct_at(rows + i, std::move(GetRow(i)));
+    }
+
+    FreePageList(pages_);
+    DeallocatePageList(allocated_pages_);
+
+    frozen_rows_ = rows;
+    num_frozen_rows_ = num_rows;
+
+    row_directory_.clear();
+    for (size_t i = 0; i < num_rows; i += kNumRowsPerPage) {
+      row_directory_.push_back(rows + i);
+    }
+  }
+
+  // Check whether the rows of the table are stored in a single contiguous
+  // block of memory.
+  inline auto IsFrozen() const -> bool { return frozen_rows_ != nullptr; }
+
   //////////////////////////////////////////////////////////////////////////////
   // Modification.
+  //
+  // Modification of a frozen table moves its rows back to pages, invalidating
+  // all references to the rows.
 
   // Clears the contents of the table.
   void clear() {
+    FreeFrozenRows();
+
     Page* page = GetHeadPage();
     while (page != nullptr) {
       Page* next_page = page->next;
@@ -477,6 +467,7 @@ class PagedTable {
     }
     pages_.Clear();
 
+    row_directory_.clear();
     num_rows_ = 0;
   }
 
@@ -535,6 +526,8 @@ class PagedTable {
   void pop_back() {
     assert(!empty());
 
+    Thaw();
+
     // Remove element from the last page.
     Page* last_page = GetTailPage();
     last_page->pop_back();
@@ -544,6 +537,7 @@ class PagedTable {
     if (last_page->empty()) {
       pages_.Remove(last_page);
       allocated_pages_.Append(last_page);
+      row_directory_.pop_back();
     }
 
     --num_rows_;
@@ -566,6 +560,16 @@ class PagedTable {
   // The list of pages.
   using PageList = LinkedList<Page>;
 
+  // Get row at the given index.
+  //
+  // All pages except the last one are full, so the page of the row and the
+  // index of the row within the page are known from the index of the row in
+  // the table. The frozen table uses the same layout of its contiguous block.
+  inline auto GetRow(const size_t index) const -> RowType& {
+    assert(index < size());
+    return row_directory_[index / kNumRowsPerPage][index % kNumRowsPerPage];
+  }
+
   // Allocate new page.
   //
   // The page has pre-allocated storage for the kNumRowsPerPage which is not
@@ -585,6 +589,7 @@ class PagedTable {
 
     Page* page = new (page_memory) Page();
     pages_.Append(page);
+    row_directory_.push_back(page->data());
     return page;
   }
 
@@ -616,6 +621,63 @@ class PagedTable {
     pages.Clear();
   }
 
+  // Destroy the rows of the frozen table and deallocate their memory.
+  // Does nothing if the table is not frozen.
+  void FreeFrozenRows() {
+    if (!IsFrozen()) {
+      return;
+    }
+
+    std::destroy_n(frozen_rows_, num_rows_);
+    row_allocator_.deallocate(frozen_rows_, num_frozen_rows_);
+
+    frozen_rows_ = nullptr;
+    num_frozen_rows_ = 0;
+  }
+
+  // Move the rows of the frozen table back to pages.
+  // Does nothing if the table is not frozen.
+  void Thaw() {
+    if (!IsFrozen()) {
+      return;
+    }
+
+    RowType* rows = frozen_rows_;
+    const size_t num_rows = num_rows_;
+    const size_t num_frozen_rows = num_frozen_rows_;
+
+    frozen_rows_ = nullptr;
+    num_frozen_rows_ = 0;
+    row_directory_.clear();
+    num_rows_ = 0;
+
+    for (size_t i = 0; i < num_rows; ++i) {
+      push_back(std::move(rows[i]));
+    }
+
+    std::destroy_n(rows, num_rows);
+    row_allocator_.deallocate(rows, num_frozen_rows);
+  }
+
+  // Take the storage of the other table, leaving it empty.
+  // The table is expected to be empty.
+  void MoveFrom(PagedTable& other) {
+    assert(empty());
+
+    // The free pages are kept by their own table, same as the allocators.
+    pages_ = other.pages_;
+    row_directory_ = std::move(other.row_directory_);
+    frozen_rows_ = other.frozen_rows_;
+    num_frozen_rows_ = other.num_frozen_rows_;
+    num_rows_ = other.num_rows_;
+
+    other.pages_.Clear();
+    other.row_directory_.clear();
+    other.frozen_rows_ = nullptr;
+    other.num_frozen_rows_ = 0;
+    other.num_rows_ = 0;
+  }
+
   // Get page which is at the head and tail of the pages list.
   auto GetHeadPage() const -> Page* { return pages_.GetHead(); }
   auto GetTailPage() const -> Page* { return pages_.GetTail(); }
@@ -623,6 +685,8 @@ class PagedTable {
   // Get page for emplace_back and push_back type of operations.
   // Will create a new page when needed.
   auto GetPageForPushBack() -> Page* {
+    Thaw();
+
     Page* page = GetTailPage();
     if (page == nullptr || page->full()) {
       page = AllocatePage();
@@ -642,36 +706,25 @@ class PagedTable {
     ++num_rows_;
 
     // Move the rest of the rows one position forward.
-    iterator dst_it = std::prev(end(), 2);
-    while (dst_it != pos) {
-      const iterator src_it = std::prev(dst_it);
-
-      *dst_it = std::move(*src_it);
-
-      dst_it = src_it;
+    const size_t pos_index = pos - cbegin();
+    for (size_t i = size() - 2; i > pos_index; --i) {
+      GetRow(i) = std::move(GetRow(i - 1));
     }
 
-    return dst_it;
+    return begin() + pos_index;
   }
 
   // Move the rows one position to the beginning of the table starting from the
   // given position. This will decrease the size of the table, leaving the
   // emptied row in a destroyed and non-initialized state.
   auto MoveRowsForward(const const_iterator pos) -> iterator {
-    // TODO(sergey): In theory it is possible to avoid looping through the
-    // iterator advance.
-    iterator start_it = begin() + std::distance(cbegin(), pos);
-
-    const iterator end_it = end();
+    Thaw();
 
     // Shift elements one position to the beginning.
-    iterator dst_it = start_it;
-    iterator src_it = dst_it + 1;
-    while (src_it != end_it) {
-      *dst_it = std::move(*src_it);
-
-      ++dst_it;
-      ++src_it;
+    const size_t pos_index = pos - cbegin();
+    const size_t num_rows = size();
+    for (size_t i = pos_index; i + 1 < num_rows; ++i) {
+      GetRow(i) = std::move(GetRow(i + 1));
     }
 
     // Pop the last element which is left in a moved-from state.
@@ -679,21 +732,33 @@ class PagedTable {
     // size.
     pop_back();
 
-    return start_it;
+    return begin() + pos_index;
   }
 
   // Pages of the table.
-  // This is where the actual content is stored.
+  // This is where the actual content is stored, unless the table is frozen.
   PageList pages_;
 
   // Pages which have been allocated but later destroyed.
   // This list contains memory which points to an uninitialized page objects.
   PageList allocated_pages_;
 
+  // Storage of the rows of every page, in the order of pages.
+  //
+  // For the frozen table the i-th element points to the i*kNumRowsPerPage-th
+  // row of the contiguous block.
+  std::vector<RowType*, Allocator<RowType*>> row_directory_;
+
+  // Contiguous storage of the rows of the frozen table, and the number of rows
+  // it has been allocated for.
+  RowType* frozen_rows_{nullptr};
+  size_t num_frozen_rows_{0};
+
   // The number of rows in the table.
   size_t num_rows_{0};
 
   Allocator<Page> page_allocator_;
+  Allocator<RowType> row_allocator_;
 };
 
 }  // namespace experimental
@@ -23,26 +23,204 @@
 //     raise error
 //   }
 //   local_table->LookupValue();
+//
+// The memory of the table is reclaimed using an epoch-based scheme. A reader
+// publishes the epoch at which it has entered a read section in a slot which
+// belongs to its thread, and the writer only deletes a replaced table once all
+// threads which might have seen it have left their read sections. Readers do
+// not perform any atomic read-modify-write operations and do not write to any
+// memory shared with other threads.
+//
+// A thread which performs many lookups, possibly from different tables, can pin
+// itself for the duration of a batch of work:
+//
+//   {
+//     const SharedTablePin pin;
+//     for (...) {
+//       ... = ITRFToGCRF(...);
+//     }
+//   }
+//
+// While the pin is alive every Load() on this thread only updates a counter
+// which is local to the thread.
 
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "astro_core/version/version.h"
 
 namespace astro_core {
 inline namespace ASTRO_CORE_VERSION_NAMESPACE {
 
+namespace shared_table_internal {
+
+// Slot in which a reader thread publishes the epoch of its read section.
+// The epoch of 0 means the thread is not inside of a read section.
+//
+// The slots are allocated once and are never freed: a slot of a finished
+// thread is re-used by a new thread.
+struct ReaderSlot {
+  std::atomic<uint64_t> epoch{0};
+  std::atomic<bool> is_used{false};
+  ReaderSlot* next{nullptr};
+};
+
+// State of the reader on the current thread.
+struct ReaderState {
+  ReaderSlot* slot{nullptr};
+
+  // Number of nested read sections on this thread.
+  int num_nested_sections{0};
+};
+
+extern constinit thread_local ReaderState reader_state;
+
+// Global epoch, advanced every time a table is replaced.
+extern std::atomic<uint64_t> global_epoch;
+
+// Allocate a slot for the current thread.
+// The slot is released when the thread finishes.
+auto AcquireReaderSlot() -> ReaderSlot*;
+
+// Advance the global epoch and return its new value.
+//
+// Readers which enter a read section after this call has returned publish an
+// epoch which is greater or equal to the returned value.
+auto AdvanceEpoch() -> uint64_t;
+
+// Get the smallest epoch published by the threads which are currently inside of
+// a read section. Returns UINT64_MAX if there are no such threads.
+auto GetMinReaderEpoch() -> uint64_t;
+
+inline void EnterReadSection() {
+  ReaderState& state = reader_state;
+  if (state.num_nested_sections++ != 0) {
+    return;
+  }
+
+  if (!state.slot) {
+    state.slot = AcquireReaderSlot();
+  }
+
+  // The fence orders the publishing of the epoch before the following loads of
+  // the table pointers. It pairs with the fence in GetMinReaderEpoch().
+  state.slot->epoch.store(global_epoch.load(std::memory_order_acquire),
+                          std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void LeaveReadSection() {
+  ReaderState& state = reader_state;
+  if (--state.num_nested_sections != 0) {
+    return;
+  }
+
+  state.slot->epoch.store(0, std::memory_order_release);
+}
+
+}  // namespace shared_table_internal
+
+// Scoped pin of the current thread to a read section of all shared tables.
+//
+// The tables loaded while the pin is alive are not deleted until the pin is
+// destroyed, even if they are replaced with a new table. A replacement of a
+// table is still visible to the Load() calls made while the pin is alive.
+//
+// Keeping the pin alive for a long time delays reclamation of memory of the
+// replaced tables, so it is better to pin a thread for a bounded batch of work.
+class SharedTablePin {
+ public:
+  SharedTablePin() { shared_table_internal::EnterReadSection(); }
+  ~SharedTablePin() { shared_table_internal::LeaveReadSection(); }
+
+  SharedTablePin(const SharedTablePin& other) = delete;
+  SharedTablePin(SharedTablePin&& other) noexcept = delete;
+
+  auto operator=(const SharedTablePin& other) -> SharedTablePin& = delete;
+  auto operator=(SharedTablePin&& other) -> SharedTablePin& = delete;
+};
+
 template <class Table>
 class SharedTable {
  public:
-  using LocalTable = std::shared_ptr<const Table>;
+  // Pointer-like object to a const Table.
+  //
+  // The table is guaranteed to stay alive for the lifetime of this object. The
+  // object is to be used on the thread which has created it.
+  class LocalTable {
+   public:
+    ~LocalTable() { shared_table_internal::LeaveReadSection(); }
+
+    LocalTable(const LocalTable& other) = delete;
+    LocalTable(LocalTable&& other) noexcept = delete;
+
+    auto operator=(const LocalTable& other) -> LocalTable& = delete;
+    auto operator=(LocalTable&& other) -> LocalTable& = delete;
+
+    explicit operator bool() const { return table_ != nullptr; }
+
+    auto operator*() const -> const Table& { return *table_; }
+    auto operator->() const -> const Table* { return table_; }
+
+   private:
+    friend class SharedTable;
+
+    // The table is only constructed by Load(), after it has entered the read
+    // section which the destructor leaves.
+    explicit LocalTable(const Table* table) : table_(table) {}
+
+    const Table* table_;
+  };
+
+  SharedTable() = default;
+
+  // The move is not thread-safe: it must not be called while there is a
+  // LocalTable loaded from either of the tables.
+  SharedTable(const SharedTable& other) = delete;
+  SharedTable(SharedTable&& other) noexcept
+      : table_(other.table_.exchange(nullptr, std::memory_order_relaxed)),
+        retired_tables_(std::move(other.retired_tables_)) {}
+
+  // Delete the table and all tables which were replaced by it.
+  // Must not be called while there is a LocalTable loaded from this table.
+  ~SharedTable() { delete table_.load(std::memory_order_relaxed); }
+
+  auto operator=(const SharedTable& other) -> SharedTable& = delete;
+  auto operator=(SharedTable&& other) noexcept -> SharedTable& {
+    if (this != &other) {
+      delete table_.exchange(
+          other.table_.exchange(nullptr, std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      retired_tables_ = std::move(other.retired_tables_);
+    }
+    return *this;
+  }
 
   // Set the underlying table.
   // This call does not conflict with possible reader threads.
+  //
+  // The replaced table is deleted once no reader thread can access it anymore,
+  // which happens during one of the following calls to Set() or when the
+  // SharedTable is destroyed.
   void Set(Table&& table) {
-    std::atomic_store(&table_, std::make_shared<Table>(std::move(table)));
+    const Table* new_table = new Table(std::move(table));
+
+    const std::lock_guard lock(mutex_);
+
+    const Table* old_table =
+        table_.exchange(new_table, std::memory_order_seq_cst);
+    if (old_table) {
+      retired_tables_.push_back(
+          {std::unique_ptr<const Table>(old_table),
+           shared_table_internal::AdvanceEpoch()});
+    }
+
+    ReclaimRetiredTables();
   }
 
   // Acquire a pointer to the table.
@@ -52,17 +230,40 @@ class SharedTable {
   // The result is a pointer-like object to a const Table.
   // If the table has never been set then the result object operator bool() will
   // give false.
-  auto Load() const -> LocalTable { return std::atomic_load(&table_); }
+  auto Load() const -> LocalTable {
+    shared_table_internal::EnterReadSection();
+    return LocalTable(table_.load(std::memory_order_acquire));
+  }
 
  private:
+  // Table which has been replaced by a newer one, but which might still be
+  // accessed by reader threads.
+  struct RetiredTable {
+    std::unique_ptr<const Table> table;
+
+    // Readers which have entered their read section at this epoch or later do
+    // not have access to the table.
+    uint64_t epoch;
+  };
+
+  void ReclaimRetiredTables() {
+    const uint64_t min_reader_epoch =
+        shared_table_internal::GetMinReaderEpoch();
+
+    std::erase_if(retired_tables_, [&](const RetiredTable& retired_table) {
+      return retired_table.epoch <= min_reader_epoch;
+    });
+  }
+
   // Actual table.
-  //
-  // Stored as a shared pointer to allow threads to have read-only access with
-  // the least amount of threading overhead, while allowing the main thread to
-  /// update the table.
-  //
-  // TODO(sergey): Find a solution which does not require heap allocations.
-  std::shared_ptr<Table> table_;
+  std::atomic<const Table*> table_{nullptr};
+
+  // Mutex which serializes writers.
+  std::mutex mutex_;
+
+  // Tables which have been replaced and are waiting for all readers to leave
+  // the read section in which they might have accessed them.
+  std::vector<RetiredTable> retired_tables_;
 };
 
 }  // namespace ASTRO_CORE_VERSION_NAMESPACE
@@ -170,77 +170,90 @@ struct FromTAI<TimeScale::kUTC> {
 ////////////////////////////////////////////////////////////////////////////////
 // UT1 time scale.
 
+// Convert the time from UT1 to UTC.
+inline auto ConvertUT1ToUTC(const Time& time) -> Time {
+  assert(time.GetScale() == TimeScale::kUT1);
+
+  // Start with estimating the UTC using UT1 to get an initial guess of the
+  // UT1-UTC correction. Then correct the UT1 guess with with UT1-UTC and
+  // repeat the process. This allows to more accurately estimate time at
+  // around leap second.
+  //
+  // This is similar to algorithm used in Astropy. The difference there is
+  // that the estimate around the leap second is corrected using ERFA. The
+  // algorithm used in ERFA is not really clear.
+  //
+  // It is also similar to the Skyfield. The difference there is that TT is
+  // used there instead of UTC.
+
+  ModifiedJulianDate utc_mjd_approx;
+  DoubleDouble ut1_minus_utc_sec_approx;
+
+  utc_mjd_approx = time.AsFormat<ModifiedJulianDate>();
+  ut1_minus_utc_sec_approx = GetUT1MinusUTCSecondsInUTCScale(utc_mjd_approx);
+
+  utc_mjd_approx =
+      utc_mjd_approx - ut1_minus_utc_sec_approx / constants::kNumSecondsInDay;
+  ut1_minus_utc_sec_approx = GetUT1MinusUTCSecondsInUTCScale(utc_mjd_approx);
+
+  utc_mjd_approx = time.AsFormat<ModifiedJulianDate>() -
+                   ut1_minus_utc_sec_approx / constants::kNumSecondsInDay;
+
+  return Time(utc_mjd_approx, TimeScale::kUTC);
+}
+
+// Convert the time from TAI to UT1, using the same time point in UTC scale.
+//
+// Allows to avoid the TAI to UTC conversion when the UTC time is already known.
+inline auto ConvertTAIToUT1(const Time& time_tai, const Time& time_utc)
+    -> Time {
+  assert(time_tai.GetScale() == TimeScale::kTAI);
+  assert(time_utc.GetScale() == TimeScale::kUTC);
+
+  const ModifiedJulianDate tai_mjd = time_tai.AsFormat<ModifiedJulianDate>();
+  const ModifiedJulianDate utc_mjd = time_utc.AsFormat<ModifiedJulianDate>();
+
+  // Look up the Earth orientation parameters.
+  const DoubleDouble ut1_minus_utc_sec =
+      GetUT1MinusUTCSecondsInUTCScale(utc_mjd);
+  const DoubleDouble ut1_minus_utc_jd =
+      ut1_minus_utc_sec / constants::kNumSecondsInDay;
+
+  // TAI-UTC.
+  //
+  // Calculate as the difference between input TAI time and its UTC
+  // complementary value. The difference is in Julian days.
+  const DoubleDouble tai_minus_utc_jd{tai_mjd - utc_mjd};
+
+  // Calculate the UT1-TAI from UT1-UTC and TAI-UTC:
+  // (UT1-UTC) - (TAI-UTC) = UT1 - UTC - TAI + UTC = UT1-TAI
+  const DoubleDouble ut1_minus_tai_jd = ut1_minus_utc_jd - tai_minus_utc_jd;
+
+  // UT1 = TAI + UT1-TAI
+  const DoubleDouble ut1_mjd{tai_mjd + ut1_minus_tai_jd};
+  return Time(ModifiedJulianDate(ut1_mjd), TimeScale::kUT1);
+}
+
 template <>
 struct ToTAI<TimeScale::kUT1> {
   static auto Convert(const Time& time) -> Time {
-    assert(time.GetScale() == TimeScale::kUT1);
-
-    // Start with estimating the UTC using UT1 to get an initial guess of the
-    // UT1-UTC correction. Then correct the UT1 guess with with UT1-UTC and
-    // repeat the process. This allows to more accurately estimate time at
-    // around leap second.
-    //
-    // This is similar to algorithm used in Astropy. The difference there is
-    // that the estimate around the leap second is corrected using ERFA. The
-    // algorithm used in ERFA is not really clear.
-    //
-    // It is also similar to the Skyfield. The difference there is that TT is
-    // used there instead of UTC.
-
-    ModifiedJulianDate utc_mjd_approx;
-    DoubleDouble ut1_minus_utc_sec_approx;
-
-    utc_mjd_approx = time.AsFormat<ModifiedJulianDate>();
-    ut1_minus_utc_sec_approx = GetUT1MinusUTCSecondsInUTCScale(utc_mjd_approx);
-
-    utc_mjd_approx =
-        utc_mjd_approx - ut1_minus_utc_sec_approx / constants::kNumSecondsInDay;
-    ut1_minus_utc_sec_approx = GetUT1MinusUTCSecondsInUTCScale(utc_mjd_approx);
-
-    utc_mjd_approx = time.AsFormat<ModifiedJulianDate>() -
-                     ut1_minus_utc_sec_approx / constants::kNumSecondsInDay;
-
-    return ToTAI<TimeScale::kUTC>::Convert(
-        Time(utc_mjd_approx, TimeScale::kUTC));
+    return ToTAI<TimeScale::kUTC>::Convert(ConvertUT1ToUTC(time));
   }
 };
 
 template <>
 struct FromTAI<TimeScale::kUT1> {
   static auto Convert(const Time& time) -> Time {
-    assert(time.GetScale() == TimeScale::kTAI);
-
-    const ModifiedJulianDate tai_mjd = time.AsFormat<ModifiedJulianDate>();
-
-    // Convert the input time to UTC and look up the Earth orientation
-    // parameters.
-
-    const Time time_utc = FromTAI<TimeScale::kUTC>::Convert(time);
-    const ModifiedJulianDate utc_mjd{time_utc.AsFormat<ModifiedJulianDate>()};
-
-    const DoubleDouble ut1_minus_utc_sec =
-        GetUT1MinusUTCSecondsInUTCScale(utc_mjd);
-    const DoubleDouble ut1_minus_utc_jd =
-        ut1_minus_utc_sec / constants::kNumSecondsInDay;
-
-    // TAI-UTC.
-    //
-    // Calculate as the difference between input TAI time and its UTC
-    // complementary value. The difference is in Julian days.
-    const DoubleDouble tai_minus_utc_jd{tai_mjd - utc_mjd};
-
-    // Calculate the UT1-TAI from UT1-UTC and TAI-UTC:
-    // (UT1-UTC) - (TAI-UTC) = UT1 - UTC - TAI + UTC = UT1-TAI
-    const DoubleDouble ut1_minus_tai_jd = ut1_minus_utc_jd - tai_minus_utc_jd;
-
-    // UT1 = TAI + UT1-TAI
-    const DoubleDouble ut1_mjd{tai_mjd + ut1_minus_tai_jd};
-    return Time(ModifiedJulianDate(ut1_mjd), TimeScale::kUT1);
+    return ConvertTAIToUT1(time, FromTAI<TimeScale::kUTC>::Convert(time));
   }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
-// TT(TAI0 time scale.
+// TT(TAI) time scale.
+
+// TT-TAI in days: TT(TAI) = TAI + 32.184s.
+inline constexpr DoubleDouble kTTMinusTAIInDays =
+    DoubleDouble(32.184) / constants::kNumSecondsInDay;
 
 template <>
 struct ToTAI<TimeScale::kTT> {
@@ -250,8 +263,7 @@ struct ToTAI<TimeScale::kTT> {
     const ModifiedJulianDate tt_mjd = time.AsFormat<ModifiedJulianDate>();
 
     const ModifiedJulianDate tai_mjd(DoubleDouble(tt_mjd) -
-                                     DoubleDouble(32.184) /
-                                         constants::kNumSecondsInDay);
+                                     kTTMinusTAIInDays);
 
     return Time(tai_mjd, TimeScale::kTAI);
   }
@@ -265,8 +277,7 @@ struct FromTAI<TimeScale::kTT> {
     const ModifiedJulianDate tai_mjd = time.AsFormat<ModifiedJulianDate>();
 
     const ModifiedJulianDate tt_mjd(DoubleDouble(tai_mjd) +
-                                    DoubleDouble(32.184) /
-                                        constants::kNumSecondsInDay);
+                                    kTTMinusTAIInDays);
 
     return Time(tt_mjd, TimeScale::kTT);
   }
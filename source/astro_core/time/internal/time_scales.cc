@@ -0,0 +1,65 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/time/time_scales.h"
+
+#include "astro_core/base/unreachable.h"
+#include "astro_core/time/internal/scale_convert.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+using time_internal::ConvertTAIToUT1;
+using time_internal::ConvertUT1ToUTC;
+using time_internal::FromTAI;
+using time_internal::ToTAI;
+
+TimeScales::TimeScales(const Time& time) : scale_(time.GetScale()) {
+  // Find the TAI and UTC first, looking up the leap seconds once. All other
+  // scales are derived from them without extra leap second lookups.
+  switch (scale_) {
+    case TimeScale::kTAI:
+      tai_ = time;
+      utc_ = FromTAI<TimeScale::kUTC>::Convert(tai_);
+      break;
+
+    case TimeScale::kUTC:
+      utc_ = time;
+      tai_ = ToTAI<TimeScale::kUTC>::Convert(utc_);
+      break;
+
+    case TimeScale::kUT1:
+      ut1_ = time;
+      utc_ = ConvertUT1ToUTC(ut1_);
+      tai_ = ToTAI<TimeScale::kUTC>::Convert(utc_);
+      break;
+
+    case TimeScale::kTT:
+      tt_ = time;
+      tai_ = ToTAI<TimeScale::kTT>::Convert(tt_);
+      utc_ = FromTAI<TimeScale::kUTC>::Convert(tai_);
+      break;
+  }
+
+  if (scale_ != TimeScale::kUT1) {
+    ut1_ = ConvertTAIToUT1(tai_, utc_);
+  }
+
+  if (scale_ != TimeScale::kTT) {
+    tt_ = FromTAI<TimeScale::kTT>::Convert(tai_);
+  }
+}
+
+auto TimeScales::Get(const TimeScale scale) const -> const Time& {
+  switch (scale) {
+    case TimeScale::kTAI: return tai_;
+    case TimeScale::kUTC: return utc_;
+    case TimeScale::kUT1: return ut1_;
+    case TimeScale::kTT: return tt_;
+  }
+  Unreachable();
+}
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
@@ -0,0 +1,70 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "astro_core/time/time_scales.h"
+
+#include "astro_core/earth/internal/earth_test_data.h"
+#include "astro_core/time/format/julian_date.h"
+#include "astro_core/time/format/modified_julian_date.h"
+#include "astro_core/unittest/mock.h"
+#include "astro_core/unittest/test.h"
+
+namespace astro_core {
+
+using testing::NearUsingAbsDifferenceMetric;
+
+class TimeScalesTest : public testing::Test {
+ protected:
+  void SetUp() override { test_data::SetTables(); }
+};
+
+TEST_F(TimeScalesTest, MatchesToScale) {
+  constexpr TimeScale kScales[] = {
+      TimeScale::kTAI, TimeScale::kUTC, TimeScale::kUT1, TimeScale::kTT};
+
+  // Dates around the leap second at the end of June 30, 2015, and away from
+  // it.
+  for (const double mjd : {57203.5, 57203.9999, 57204.0, 57204.5, 58849.25}) {
+    for (const TimeScale from_scale : kScales) {
+      const Time time(ModifiedJulianDate(mjd), from_scale);
+      const TimeScales scales(time);
+
+      EXPECT_EQ(scales.GetTime(), time);
+
+      for (const TimeScale to_scale : kScales) {
+        const Time expected = time.ToScale(to_scale);
+        const Time& actual = scales.Get(to_scale);
+
+        EXPECT_EQ(actual.GetScale(), to_scale);
+
+        // The UTC derived back from TAI in the ToScale() is subject to
+        // round-off, which affects the UT1 from UTC and the UTC from UT1.
+        if ((from_scale == TimeScale::kUTC && to_scale == TimeScale::kUT1) ||
+            (from_scale == TimeScale::kUT1 && to_scale == TimeScale::kUTC)) {
+          EXPECT_THAT(actual.AsFormat<JulianDate>(),
+                      NearUsingAbsDifferenceMetric(
+                          expected.AsFormat<JulianDate>(), 1e-15));
+        } else {
+          EXPECT_EQ(actual, expected);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TimeScalesTest, Get) {
+  const TimeScales scales(Time(ModifiedJulianDate(57204.5), TimeScale::kUTC));
+
+  EXPECT_EQ(&scales.Get<TimeScale::kTAI>(), &scales.GetTAI());
+  EXPECT_EQ(&scales.Get<TimeScale::kUTC>(), &scales.GetUTC());
+  EXPECT_EQ(&scales.Get<TimeScale::kUT1>(), &scales.GetUT1());
+  EXPECT_EQ(&scales.Get<TimeScale::kTT>(), &scales.GetTT());
+
+  EXPECT_EQ(scales.GetTAI().GetScale(), TimeScale::kTAI);
+  EXPECT_EQ(scales.GetUTC().GetScale(), TimeScale::kUTC);
+  EXPECT_EQ(scales.GetUT1().GetScale(), TimeScale::kUT1);
+  EXPECT_EQ(scales.GetTT().GetScale(), TimeScale::kTT);
+}
+
+}  // namespace astro_core
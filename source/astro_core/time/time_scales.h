@@ -0,0 +1,65 @@
+// Copyright (c) 2024 astro core authors
+//
+// SPDX-License-Identifier: MIT
+
+// A time point converted to all supported time scales at once.
+//
+// Algorithms such as frame transformations need the same time point in several
+// time scales: for example, the GCRF-to-ITRF transformation uses TT for the
+// precession-nutation, UT1 for the Earth rotation angle, and UTC for the polar
+// motion. Converting the time to each of the scales individually with
+// Time::ToScale() repeats the lookup of the leap seconds and the Earth
+// orientation parameters for every scale. The TimeScales performs the lookups
+// once and derives all scales from them:
+//
+//   const TimeScales scales(time);
+//
+//   const JulianDate jd_tt = scales.GetTT().AsFormat<JulianDate>();
+//   const JulianDate jd_ut1 = scales.GetUT1().AsFormat<JulianDate>();
+//
+// The converted times are bitwise identical to the result of Time::ToScale(),
+// except for the round-off of the DoubleDouble which happens in the latter when
+// the UTC is derived back from the TAI.
+
+#pragma once
+
+#include "astro_core/time/scale.h"
+#include "astro_core/time/time.h"
+#include "astro_core/version/version.h"
+
+namespace astro_core {
+inline namespace ASTRO_CORE_VERSION_NAMESPACE {
+
+class TimeScales {
+ public:
+  // Convert the given time to all time scales.
+  explicit TimeScales(const Time& time);
+
+  // Get the time from which the scales were calculated, in its own scale.
+  auto GetTime() const -> const Time& { return Get(scale_); }
+
+  // Get the time point in the given time scale.
+  auto Get(TimeScale scale) const -> const Time&;
+
+  template <TimeScale kScale>
+  auto Get() const -> const Time& {
+    return Get(kScale);
+  }
+
+  auto GetTAI() const -> const Time& { return tai_; }
+  auto GetUTC() const -> const Time& { return utc_; }
+  auto GetUT1() const -> const Time& { return ut1_; }
+  auto GetTT() const -> const Time& { return tt_; }
+
+ private:
+  // Scale of the time from which the scales were calculated.
+  TimeScale scale_;
+
+  Time tai_;
+  Time utc_;
+  Time ut1_;
+  Time tt_;
+};
+
+}  // namespace ASTRO_CORE_VERSION_NAMESPACE
+}  // namespace astro_core
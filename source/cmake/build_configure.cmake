@@ -64,6 +64,11 @@ enable_testing()
 
 include(target_test)
 
+################################################################################
+# Benchmarking.
+
+include(target_benchmark)
+
 ################################################################################
 # Installation.
 
@@ -0,0 +1,41 @@
+# Copyright (c) 2024 astro core authors
+#
+# SPDX-License-Identifier: MIT-0
+
+# Utility functions for defining benchmarks.
+#
+# All benchmarks are compiled into a single astro_core_benchmark executable.
+# The executable itself is defined after all benchmarks have been declared, in
+# the astro_core/benchmark folder.
+
+# Declare a benchmark.
+#
+# The benchmark is specified by the file name it is compiled from. The file is
+# added to the astro_core_benchmark executable.
+#
+# It is possible to pass additional linking libraries by specifying "LIBRARIES"
+# argument (the executable will be linked against all libraries listed after
+# the "LIBRARIES" keyword).
+#
+# Example:
+#
+#   astro_core_benchmark(internal/orbital_state_benchmark.cc
+#                        LIBRARIES astro_core_satellite)
+function(astro_core_benchmark FILENAME)
+  if(NOT WITH_BENCHMARKS)
+    return()
+  endif()
+
+  cmake_parse_arguments(
+    BENCHMARK
+    ""
+    ""
+    "LIBRARIES"
+    ${ARGN}
+  )
+
+  set_property(GLOBAL APPEND PROPERTY ASTRO_CORE_BENCHMARK_SOURCES
+               ${CMAKE_CURRENT_SOURCE_DIR}/${FILENAME})
+  set_property(GLOBAL APPEND PROPERTY ASTRO_CORE_BENCHMARK_LIBRARIES
+               ${BENCHMARK_LIBRARIES})
+endfunction()